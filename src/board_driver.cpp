@@ -73,6 +73,7 @@ void BoardDriver::begin() {
       sensorRaw[row][col] = false;
       sensorDebounceTime[row][col] = 0;
     }
+  sensorOccupancy = 0;
 
   // Initialize animation queue system
   instance = this;
@@ -614,6 +615,7 @@ void BoardDriver::readSensors() {
           sensorDebounceTime[logicalRow][logicalCol] = currentTime;
         } else if (currentTime - sensorDebounceTime[logicalRow][logicalCol] >= DEBOUNCE_MS) {
           sensorState[logicalRow][logicalCol] = newReading;
+          sensorOccupancy ^= 1ULL << (logicalRow * 8 + logicalCol);
         }
       } else {
         sensorRaw[logicalRow][logicalCol] = newReading;
@@ -646,6 +648,10 @@ void BoardDriver::acquireLEDs() {
   xSemaphoreTake(ledMutex, portMAX_DELAY);
 }
 
+bool BoardDriver::tryAcquireLEDs() {
+  return xSemaphoreTake(ledMutex, 0) == pdTRUE;
+}
+
 void BoardDriver::releaseLEDs() {
   xSemaphoreGive(ledMutex);
 }
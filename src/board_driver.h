@@ -141,6 +141,7 @@ class BoardDriver {
   bool sensorState[NUM_ROWS][NUM_COLS];
   bool sensorPrev[NUM_ROWS][NUM_COLS];
   bool sensorRaw[NUM_ROWS][NUM_COLS];
+  uint64_t sensorOccupancy; // Debounced sensorState as a bitboard (bit row * 8 + col)
   unsigned long sensorDebounceTime[NUM_ROWS][NUM_COLS];
   int lastEnabledCol; // Tracks last enabled column for efficient sequential shifting
 
@@ -188,12 +189,15 @@ class BoardDriver {
   bool getSensorState(int row, int col);
   bool getSensorPrev(int row, int col);
   void updateSensorPrev();
+  uint64_t getSensorOccupancy() const { return sensorOccupancy; }
 
   // LED Control (use acquireLEDs/releaseLEDs for multi-call sequences)
   void acquireLEDs(); // Block until LED strip available
   void releaseLEDs(); // Release LED strip
+  bool tryAcquireLEDs(); // Take LED strip only if no animation holds it
   void clearAllLEDs(bool show = true);
   void setSquareLED(int row, int col, LedRGB color);
+  LedRGB getSquareLED(int row, int col) const { return currentColors[row][col]; } // Color last set, before dimming
   void showLEDs();
 
   // Animation Functions (queued for async execution)
@@ -6,7 +6,32 @@
 #include "wifi_manager_esp32.h"
 #include <Arduino.h>
 
-ChessBot::ChessBot(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, MoveHistory* mh, BotConfig cfg) : ChessGame(bd, ce, wm, mh), botConfig(cfg), currentEvaluation(0.0) {}
+uint32_t ChessBot::ponderHits = 0;
+uint32_t ChessBot::ponderMisses = 0;
+
+ChessBot::ChessBot(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, MoveHistory* mh, BotConfig cfg) : ChessGame(bd, ce, wm, mh), botConfig(cfg), engineRequestId(0), thinkingAnimation(nullptr), ponderRequestId(0), ponderMove(""), premoveFrom(-1), premoveTo(-1), premoveCaptureSquare(-1), premoveCaptured(' '), premoveShown(false), currentEvaluation(0.0) {}
+
+ChessBot::~ChessBot() {
+  cancelPendingActions();
+}
+
+void ChessBot::cancelPendingActions() {
+  if (engineRequestId) {
+    Serial.println("Cancelling pending engine request");
+    EngineWorker::cancel(engineRequestId);
+    engineRequestId = 0;
+  }
+  if (ponderRequestId) {
+    EngineWorker::cancel(ponderRequestId);
+    ponderRequestId = 0;
+  }
+  ponderMove = "";
+  if (thinkingAnimation) {
+    thinkingAnimation->store(true);
+    thinkingAnimation = nullptr;
+  }
+  clearPremove();
+}
 
 void ChessBot::begin() {
   Serial.println("=== Starting Chess Bot Mode ===");
@@ -45,121 +70,139 @@ void ChessBot::update() {
   // Check for physical resign/draw gesture (both kings lifted)
   if (checkPhysicalResignOrDraw()) return;
 
-  if ((botConfig.playerIsWhite && currentTurn == 'w') || (!botConfig.playerIsWhite && currentTurn == 'b')) {
-    // Player's turn
+  // A premove made while the bot thinks puts the board ahead of the game on purpose
+  char playerColor = botConfig.playerIsWhite ? 'w' : 'b';
+  bool premoveInHand = (currentTurn != playerColor || premoveInProgress()) && trackPremove(playerColor);
+
+  // Hold move acceptance while the physical board disagrees with the game position
+  if (!premoveInHand && !checkBoardConsistency()) {
+    boardDriver->updateSensorPrev();
+    return;
+  }
+
+  if (currentTurn == playerColor) {
+    // Player's turn: a stored premove goes first
     int fromRow, fromCol, toRow, toCol;
     char piece;
-    if (tryPlayerMove(currentTurn, fromRow, fromCol, toRow, toCol)) {
+    if (takePremove(playerColor, fromRow, fromCol, toRow, toCol) || tryPlayerMove(currentTurn, fromRow, fromCol, toRow, toCol)) {
       applyMove(fromRow, fromCol, toRow, toCol);
+      resolvePondering();
       updateGameStatus();
       wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), currentEvaluation);
       sendUiState();
     }
-  } else {
-    // Bot's turn
-    makeBotMove();
+  } else if (updateBotMove()) {
+    // Bot's turn: the engine runs in the background, sensors and UI stay live until its move arrives
     updateGameStatus();
     wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), currentEvaluation);
     sendUiState();
+    startPondering();
   }
 
   boardDriver->updateSensorPrev();
 }
 
-String ChessBot::makeStockfishRequest(const String& fen) {
-  WiFiSSLClient client;
-  // Set insecure mode for SSL (or add proper certificate validation)
-  client.setInsecure();
-  String path = StockfishAPI::buildRequestURL(fen, botConfig.stockfishSettings.depth);
-  Serial.println("Stockfish request: " STOCKFISH_API_URL + path);
-  // Retry logic
-  for (int attempt = 1; attempt <= botConfig.stockfishSettings.maxRetries; attempt++) {
-    if (attempt > 1)
-      Serial.println("Attempt: " + String(attempt) + "/" + String(botConfig.stockfishSettings.maxRetries));
-    if (client.connect(STOCKFISH_API_URL, STOCKFISH_API_PORT)) {
-      client.println("GET " + path + " HTTP/1.1");
-      client.println("Host: " STOCKFISH_API_URL);
-      client.println("Connection: close");
-      client.println();
-      // Wait for response
-      unsigned long startTime = millis();
-      String response = "";
-      bool gotResponse = false;
-      while (client.connected() && (millis() - startTime < botConfig.stockfishSettings.timeoutMs)) {
-        if (client.available()) {
-          response = client.readString();
-          gotResponse = true;
-          break;
-        }
-        delay(10);
-      }
-      client.stop();
-
-      if (gotResponse && response.length() > 0)
-        return response;
-    }
-
-    Serial.println("API request timeout or empty response");
-    if (attempt < botConfig.stockfishSettings.maxRetries) {
-      Serial.println("Retrying...");
-      delay(500);
-    }
+bool ChessBot::updateBotMove() {
+  if (engineRequestId == 0) {
+    Serial.println("=== BOT MOVE CALCULATION ===");
+    engineRequestId = EngineWorker::submit(ChessUtils::boardToFEN(board, currentTurn, chessEngine), botConfig.stockfishSettings);
+    if (engineRequestId == 0)
+      return false;
   }
 
-  Serial.println("All API request attempts failed");
-  return "";
-}
-
-bool ChessBot::parseStockfishResponse(const String& response, String& bestMove, float& evaluation) {
-  StockfishResponse stockfishResp;
-  if (!StockfishAPI::parseResponse(response, stockfishResp)) {
-    Serial.printf("Failed to parse Stockfish response: %s\n", stockfishResp.errorMessage.c_str());
+  // A ponder hit may already be answered, then the bot replies without any thinking animation
+  StockfishResponse response;
+  EngineJobStatus status = EngineWorker::poll(engineRequestId, response);
+  if (status == EngineJobStatus::PENDING) {
+    if (!thinkingAnimation && !hasPremove())
+      thinkingAnimation = boardDriver->startThinkingAnimation();
     return false;
   }
-  bestMove = stockfishResp.bestMove;
-  if (stockfishResp.hasMate) {
-    Serial.printf("Mate in %d moves\n", stockfishResp.mateInMoves);
+  engineRequestId = 0;
+  if (thinkingAnimation) {
+    thinkingAnimation->store(true);
+    thinkingAnimation = nullptr;
+  }
+  // On failure the next update() submits a fresh request
+  return status == EngineJobStatus::DONE && applyBotMove(response);
+}
+
+bool ChessBot::applyBotMove(const StockfishResponse& response) {
+  String bestMove = response.bestMove;
+  ponderMove = response.ponderMove;
+  if (response.hasMate) {
+    Serial.printf("Mate in %d moves\n", response.mateInMoves);
     // Convert mate to a large evaluation (positive or negative based on direction)
-    evaluation = stockfishResp.mateInMoves > 0 ? 100.0f : -100.0f;
+    currentEvaluation = response.mateInMoves > 0 ? 100.0f : -100.0f;
   } else {
     // Regular evaluation (already in pawns from API)
-    evaluation = stockfishResp.evaluation;
+    currentEvaluation = response.evaluation;
+  }
+  Serial.println("=== STOCKFISH EVALUATION ===");
+  Serial.printf("%s advantage: %.2f pawns\n", currentEvaluation > 0 ? "White" : "Black", currentEvaluation);
+
+  int fromRow, fromCol, toRow, toCol;
+  char promotion;
+  if (!ChessUtils::parseUCIMove(bestMove, fromRow, fromCol, toRow, toCol, promotion)) {
+    Serial.println("Failed to parse Stockfish UCI move: " + bestMove);
+    return false;
   }
+  Serial.printf("Stockfish UCI move: %s = (%d,%d) -> (%d,%d)%s%c\n", bestMove.c_str(), fromRow, fromCol, toRow, toCol, promotion == ' ' ? "" : " Promotion to: ", promotion);
+  Serial.println("============================");
+  // Verify the move is from the correct color piece
+  char piece = board[fromRow][fromCol];
+  bool botPlaysWhite = !botConfig.playerIsWhite;
+  bool isBotPiece = (botPlaysWhite && piece >= 'A' && piece <= 'Z') || (!botPlaysWhite && piece >= 'a' && piece <= 'z');
+  if (!isBotPiece) {
+    Serial.printf("ERROR: Bot tried to move a %s piece, but bot plays %s. Piece at source: %c\n", (piece >= 'A' && piece <= 'Z') ? "WHITE" : "BLACK", botPlaysWhite ? "WHITE" : "BLACK", piece);
+    return false;
+  }
+  if (piece == ' ') {
+    Serial.println("ERROR: Bot tried to move from an empty square!");
+    return false;
+  }
+  dropConflictingPremove(fromRow, fromCol, toRow, toCol);
+  applyMove(fromRow, fromCol, toRow, toCol, (bestMove.length() >= 5) ? bestMove[4] : ' ', true);
   return true;
 }
 
-void ChessBot::makeBotMove() {
-  Serial.println("=== BOT MOVE CALCULATION ===");
-  std::atomic<bool>* stopAnimation = boardDriver->startThinkingAnimation();
-  String bestMove;
-  String response = makeStockfishRequest(ChessUtils::boardToFEN(board, currentTurn, chessEngine));
-  if (stopAnimation) stopAnimation->store(true);
-  if (parseStockfishResponse(response, bestMove, currentEvaluation)) {
-    Serial.println("=== STOCKFISH EVALUATION ===");
-    Serial.printf("%s advantage: %.2f pawns\n", currentEvaluation > 0 ? "White" : "Black", currentEvaluation);
+void ChessBot::startPondering() {
+  int fromRow, fromCol, toRow, toCol;
+  char promotion;
+  if (gameOver || ponderMove.length() < 4 || !ChessUtils::parseUCIMove(ponderMove, fromRow, fromCol, toRow, toCol, promotion)) {
+    ponderMove = "";
+    return;
+  }
+  // Only ponder a move the player can actually make here
+  ensureLegalMoves();
+  if (!(legalMoveMasks[fromRow * 8 + fromCol] & (1ULL << (toRow * 8 + toCol)))) {
+    ponderMove = "";
+    return;
+  }
+
+  char lookahead[8][8];
+  memcpy(lookahead, board, sizeof(lookahead));
+  ChessEngine scratch = *chessEngine;
+  scratch.playMove(lookahead, fromRow, fromCol, toRow, toCol, promotion);
+  ponderRequestId = EngineWorker::submit(ChessUtils::boardToFEN(lookahead, currentTurn == 'w' ? 'b' : 'w', &scratch), botConfig.stockfishSettings);
+  if (ponderRequestId)
+    Serial.printf("Pondering on expected reply %s\n", ponderMove.c_str());
+}
 
-    int fromRow, fromCol, toRow, toCol;
-    char promotion;
-    if (ChessUtils::parseUCIMove(bestMove, fromRow, fromCol, toRow, toCol, promotion)) {
-      Serial.printf("Stockfish UCI move: %s = (%d,%d) -> (%d,%d)%s%c\n", bestMove.c_str(), fromRow, fromCol, toRow, toCol, promotion == ' ' ? "" : " Promotion to: ", promotion);
-      Serial.println("============================");
-      // Verify the move is from the correct color piece
-      char piece = board[fromRow][fromCol];
-      bool botPlaysWhite = !botConfig.playerIsWhite;
-      bool isBotPiece = (botPlaysWhite && piece >= 'A' && piece <= 'Z') || (!botPlaysWhite && piece >= 'a' && piece <= 'z');
-      if (!isBotPiece) {
-        Serial.printf("ERROR: Bot tried to move a %s piece, but bot plays %s. Piece at source: %c\n", (piece >= 'A' && piece <= 'Z') ? "WHITE" : "BLACK", botPlaysWhite ? "WHITE" : "BLACK", piece);
-        return;
-      }
-      if (piece == ' ') {
-        Serial.println("ERROR: Bot tried to move from an empty square!");
-        return;
-      }
-      applyMove(fromRow, fromCol, toRow, toCol, (bestMove.length() >= 5) ? bestMove[4] : ' ', true);
+void ChessBot::resolvePondering() {
+  if (ponderRequestId) {
+    bool hit = (lastUciMove == ponderMove);
+    if (hit) {
+      ponderHits++;
+      engineRequestId = ponderRequestId; // The bot's turn picks up the speculative request
     } else {
-      Serial.println("Failed to parse Stockfish UCI move: " + bestMove);
+      ponderMisses++;
+      EngineWorker::cancel(ponderRequestId);
     }
+    Serial.printf("Ponder %s (expected %s, played %s), hit rate %u/%u\n", hit ? "hit" : "miss", ponderMove.c_str(), lastUciMove.c_str(), ponderHits, ponderHits + ponderMisses);
   }
+  ponderRequestId = 0;
+  ponderMove = "";
 }
 
 void ChessBot::waitForRemoteMoveCompletion(int fromRow, int fromCol, int toRow, int toCol, bool isCapture, bool isEnPassant, int enPassantCapturedPawnRow) {
@@ -219,4 +262,175 @@ void ChessBot::waitForRemoteMoveCompletion(int fromRow, int fromCol, int toRow,
 
   boardDriver->clearAllLEDs();
   boardDriver->releaseLEDs();
-}
\ No newline at end of file
+}
+
+bool ChessBot::trackPremove(char playerColor) {
+  if (premoveTo >= 0) {
+    if (!premoveShown)
+      showPremove();
+    return false;
+  }
+  uint64_t sensors = boardDriver->getSensorOccupancy();
+  if (premoveFrom < 0) {
+    // The piece to capture may come off first; it counts until it is put back
+    if (premoveCaptureSquare >= 0 && (sensors & (1ULL << premoveCaptureSquare)))
+      premoveCaptureSquare = -1;
+    // One of the player's pieces lifted while the opponent is to move
+    uint64_t lifted = boardOccupancy & ~sensors;
+    if (premoveCaptureSquare >= 0)
+      lifted &= ~(1ULL << premoveCaptureSquare);
+    if (lifted == 0 || (lifted & (lifted - 1)))
+      return premoveCaptureSquare >= 0;
+    int sq = __builtin_ctzll(lifted);
+    if (ChessUtils::getPieceColor(board[sq / 8][sq % 8]) != playerColor) {
+      if (premoveCaptureSquare < 0)
+        premoveCaptureSquare = sq;
+      return true;
+    }
+    premoveFrom = sq;
+    return true;
+  }
+  if (sensors & (1ULL << premoveFrom)) {
+    premoveFrom = -1; // Put back
+    return false;
+  }
+
+  // An opponent piece lifted meanwhile is the one being captured
+  uint64_t lifted = boardOccupancy & ~sensors & ~(1ULL << premoveFrom);
+  if (lifted && !(lifted & (lifted - 1))) {
+    int sq = __builtin_ctzll(lifted);
+    if (ChessUtils::getPieceColor(board[sq / 8][sq % 8]) != playerColor)
+      premoveCaptureSquare = sq;
+  }
+  int to = -1;
+  uint64_t placed = sensors & ~boardOccupancy;
+  if (placed && !(placed & (placed - 1)))
+    to = __builtin_ctzll(placed);
+  else if (!placed && premoveCaptureSquare >= 0 && (sensors & (1ULL << premoveCaptureSquare)))
+    to = premoveCaptureSquare;
+  if (to < 0)
+    return true;
+
+  int fromRow = premoveFrom / 8, fromCol = premoveFrom % 8;
+  if (ChessUtils::isCastlingMove(fromRow, fromCol, to / 8, to % 8, board[fromRow][fromCol])) {
+    // Castling moves two pieces, the board cannot tell a half-made one apart
+    Serial.println("Castling cannot be premoved, put the king back and castle on your turn");
+    premoveFrom = -1;
+    return false;
+  }
+  premoveTo = to;
+  premoveCaptured = board[to / 8][to % 8];
+  // A premove capture leaves its square occupied
+  premoveOccupancyFlip = (1ULL << premoveFrom) | (premoveCaptured == ' ' ? 1ULL << premoveTo : 0);
+  Serial.printf("Premove %c%d -> %c%d stored, played as soon as the opponent has moved\n", (char)('a' + fromCol), 8 - fromRow, (char)('a' + to % 8), 8 - to / 8);
+  if (thinkingAnimation) {
+    thinkingAnimation->store(true);
+    thinkingAnimation = nullptr;
+  }
+  showPremove();
+  return false;
+}
+
+void ChessBot::showPremove() {
+  if (!boardDriver->tryAcquireLEDs())
+    return; // The thinking animation may still hold the strip, retry next scan
+  boardDriver->clearAllLEDs(false);
+  boardDriver->setSquareLED(premoveFrom / 8, premoveFrom % 8, LedColors::Magenta);
+  boardDriver->setSquareLED(premoveTo / 8, premoveTo % 8, LedColors::Magenta);
+  boardDriver->showLEDs();
+  boardDriver->releaseLEDs();
+  premoveShown = true;
+}
+
+void ChessBot::clearPremove() {
+  if (premoveShown && boardDriver->tryAcquireLEDs()) {
+    boardDriver->clearAllLEDs();
+    boardDriver->releaseLEDs();
+  }
+  premoveFrom = -1;
+  premoveTo = -1;
+  premoveCaptureSquare = -1;
+  premoveCaptured = ' ';
+  premoveShown = false;
+  premoveOccupancyFlip = 0;
+}
+
+void ChessBot::dropConflictingPremove(int fromRow, int fromCol, int toRow, int toCol) {
+  if (premoveFrom < 0) {
+    premoveCaptureSquare = -1; // Only a target in hand: trackPremove records it again if it still is
+    return;
+  }
+  if (premoveTo < 0) {
+    // Still in hand: trackPremove finishes it as the player's next move
+    return;
+  }
+  // Squares the opponent's move changes
+  char piece = board[fromRow][fromCol];
+  uint64_t touched = (1ULL << (fromRow * 8 + fromCol)) | (1ULL << (toRow * 8 + toCol));
+  if (ChessUtils::isEnPassantMove(fromRow, fromCol, toRow, toCol, piece, board[toRow][toCol]))
+    touched |= 1ULL << (ChessUtils::getEnPassantCapturedPawnRow(toRow, piece) * 8 + toCol);
+  if (ChessUtils::isCastlingMove(fromRow, fromCol, toRow, toCol, piece))
+    touched |= (1ULL << (fromRow * 8 + (toCol > fromCol ? 7 : 0))) | (1ULL << (fromRow * 8 + (toCol > fromCol ? 5 : 3)));
+  if (touched & ((1ULL << premoveFrom) | (1ULL << premoveTo)))
+    undoPremove();
+}
+
+void ChessBot::undoPremove() {
+  int fromRow = premoveFrom / 8, fromCol = premoveFrom % 8;
+  int toRow = premoveTo / 8, toCol = premoveTo % 8;
+  char captured = premoveCaptured;
+  premoveShown = false; // The LEDs are redrawn below
+  clearPremove();
+  Serial.println("The opponent's move runs into the premove, put the piece back first...");
+
+  boardDriver->acquireLEDs();
+  int shownStep = -1;
+  while (true) {
+    boardDriver->readSensors();
+    bool originBack = boardDriver->getSensorState(fromRow, fromCol);
+    bool destinationBack = boardDriver->getSensorState(toRow, toCol) == (captured != ' ');
+    if (originBack && destinationBack)
+      break;
+    int step = originBack ? 1 : 0;
+    if (step != shownStep) {
+      boardDriver->clearAllLEDs(false);
+      if (step == 0) {
+        // Own piece back from the destination to its origin
+        boardDriver->setSquareLED(toRow, toCol, LedColors::Cyan);
+        boardDriver->setSquareLED(fromRow, fromCol, LedColors::White);
+      } else {
+        // Then the captured piece back, lit in its own color
+        boardDriver->setSquareLED(toRow, toCol, captured != ' ' ? ChessUtils::colorLed(ChessUtils::getPieceColor(captured)) : LedColors::Red);
+      }
+      boardDriver->showLEDs();
+      shownStep = step;
+    }
+    delay(SENSOR_READ_DELAY_MS);
+    boardDriver->updateSensorPrev();
+  }
+  boardDriver->clearAllLEDs();
+  boardDriver->releaseLEDs();
+}
+
+bool ChessBot::takePremove(char playerColor, int& fromRow, int& fromCol, int& toRow, int& toCol) {
+  if (premoveTo < 0)
+    return false;
+  fromRow = premoveFrom / 8;
+  fromCol = premoveFrom % 8;
+  toRow = premoveTo / 8;
+  toCol = premoveTo % 8;
+  char piece = board[fromRow][fromCol];
+  char target = board[toRow][toCol];
+  ensureLegalMoves();
+  // The squares must still hold what the player saw: an empty target stays empty, a captured piece is still there
+  bool legal = piece != ' ' && ChessUtils::getPieceColor(piece) == playerColor && (legalMoveMasks[premoveFrom] & (1ULL << premoveTo)) && (target == ' ') == (premoveCaptured == ' ') && !ChessUtils::isEnPassantMove(fromRow, fromCol, toRow, toCol, piece, target);
+  String uci = ChessUtils::toUCIMove(fromRow, fromCol, toRow, toCol, ' ');
+  clearPremove();
+  if (!legal) {
+    // The board consistency check then lights the squares to put back
+    Serial.println("Premove " + uci + " is not legal after the opponent's move, discarded");
+    return false;
+  }
+  Serial.println("Playing premove " + uci);
+  return true;
+}
@@ -3,8 +3,10 @@
 
 #include "chess_game.h"
 #include "chess_utils.h"
+#include "engine_worker.h"
 #include "stockfish_api.h"
 #include "stockfish_settings.h"
+#include <atomic>
 
 // ESP32 WiFi includes
 #include <WiFi.h>
@@ -15,12 +17,31 @@ class ChessBot : public ChessGame {
  private:
   BotConfig botConfig;
 
-  // WiFi and API (Stockfish-specific)
-  String makeStockfishRequest(const String& fen);
-  bool parseStockfishResponse(const String& response, String& bestMove, float& evaluation);
+  // Engine request for the bot's turn, running on the EngineWorker task (0 = none)
+  uint32_t engineRequestId;
+  std::atomic<bool>* thinkingAnimation;
+
+  // Pondering: while the player thinks, the engine already answers the move it predicted for them
+  uint32_t ponderRequestId;
+  String ponderMove; // Predicted player move (UCI), empty if none
+  static uint32_t ponderHits;
+  static uint32_t ponderMisses;
 
   // Game flow (Stockfish-specific)
-  void makeBotMove();
+  bool updateBotMove(); // Non-blocking, returns true once the bot's move has been applied
+  bool applyBotMove(const StockfishResponse& response);
+  void startPondering();
+  void resolvePondering(); // After the player's move: adopt the speculative request or drop it
+
+  // Premove: the player's next move, made on the board while the opponent thinks
+  int premoveFrom;          // Square (row * 8 + col) the piece was lifted from, -1 if none
+  int premoveTo;            // Square it was placed on, -1 while it is in hand
+  int premoveCaptureSquare; // Opponent piece lifted for a capturing premove (before or after ours), -1 if none
+  char premoveCaptured;     // Piece taken off premoveTo, ' ' if none
+  bool premoveShown;
+
+  void showPremove();
+  void undoPremove();
 
  protected:
   float currentEvaluation; // Evaluation (in pawns, positive = White advantage)
@@ -28,13 +49,27 @@ class ChessBot : public ChessGame {
   // Remote move hooks (LED indicator + physical move wait)
   void waitForRemoteMoveCompletion(int fromRow, int fromCol, int toRow, int toCol, bool isCapture, bool isEnPassant = false, int enPassantCapturedPawnRow = -1) override;
 
+  // Premove hooks for the opponent's turn and the player's next turn
+  bool trackPremove(char playerColor); // True while the premoved piece is in hand
+  bool hasPremove() const { return premoveTo >= 0; }
+  bool premoveInProgress() const { return premoveFrom >= 0 || premoveCaptureSquare >= 0; } // Stored or still in hand
+  void clearPremove(); // Forget it without guidance (the consistency lights show what to fix)
+  void dropConflictingPremove(int fromRow, int fromCol, int toRow, int toCol); // Before the opponent's move is applied
+  bool takePremove(char playerColor, int& fromRow, int& fromCol, int& toRow, int& toCol); // False if none or illegal now
+
  public:
   ChessBot(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, MoveHistory* mh, BotConfig cfg);
+  ~ChessBot() override;
   void begin() override;
   void update() override;
+  void cancelPendingActions() override;
 
   // Get current evaluation
   float getEvaluation() const { return currentEvaluation; }
+
+  // Ponder statistics since boot (hit = player played the predicted move)
+  static uint32_t getPonderHits() { return ponderHits; }
+  static uint32_t getPonderMisses() { return ponderMisses; }
 };
 
 #endif // CHESS_BOT_H
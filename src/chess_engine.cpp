@@ -1,5 +1,6 @@
 #include "chess_engine.h"
 #include "chess_utils.h"
+#include "cuckoo_tables.h"
 #include "zobrist_keys.h"
 #include <Arduino.h>
 
@@ -85,6 +86,86 @@ bool ChessEngine::isThreefoldRepetition() const {
   return false;
 }
 
+int ChessEngine::findRepetitionMoves(const char board[8][8], char sideToMove, int moves[][4], int maxMoves) const {
+  // The earliest position one move could return to is 3 plies back (our previous move undone)
+  if (positionHistoryCount < 4)
+    return 0;
+
+  static const char* pieces = "PNBRQKpnbrqk";
+  uint64_t current = positionHistory[positionHistoryCount - 1];
+  int count = 0;
+  for (int i = positionHistoryCount - 4; i >= 0 && count < maxMoves; i -= 2) {
+    // Current and earlier position differ by exactly one reversible move iff their XOR is a cuckoo key
+    uint64_t moveKey = current ^ positionHistory[i];
+    int slot = moveKey & 0x1FFF;
+    if (CUCKOO_KEYS[slot] != moveKey) {
+      slot = (moveKey >> 16) & 0x1FFF;
+      if (CUCKOO_KEYS[slot] != moveKey)
+        continue;
+    }
+
+    uint16_t entry = CUCKOO_MOVES[slot];
+    char piece = pieces[entry >> 12];
+    int sq1 = (entry >> 6) & 0x3F;
+    int sq2 = entry & 0x3F;
+    // Both directions share one entry: the piece must stand on one square with the other one empty
+    int from, to;
+    if (board[sq1 / 8][sq1 % 8] == piece && board[sq2 / 8][sq2 % 8] == ' ') {
+      from = sq1;
+      to = sq2;
+    } else if (board[sq2 / 8][sq2 % 8] == piece && board[sq1 / 8][sq1 % 8] == ' ') {
+      from = sq2;
+      to = sq1;
+    } else {
+      continue;
+    }
+    if (ChessUtils::getPieceColor(piece) != sideToMove)
+      continue;
+
+    int fromRow = from / 8, fromCol = from % 8, toRow = to / 8, toCol = to % 8;
+    // Sliders need a clear path (knight and king entries are never more than one step apart on a line)
+    if (toupper(piece) != 'N') {
+      int dr = (toRow > fromRow) - (toRow < fromRow);
+      int dc = (toCol > fromCol) - (toCol < fromCol);
+      bool pathClear = true;
+      for (int r = fromRow + dr, c = fromCol + dc; r != toRow || c != toCol; r += dr, c += dc)
+        if (board[r][c] != ' ') {
+          pathClear = false;
+          break;
+        }
+      if (!pathClear)
+        continue;
+    }
+
+    // A move that gives up a castling right changes the hash, so it can't repeat the earlier position
+    uint8_t ownRights = (sideToMove == 'w') ? 0x03 : 0x0C;
+    int homeRow = (sideToMove == 'w') ? 7 : 0;
+    if (toupper(piece) == 'K' && (castlingRights & ownRights))
+      continue;
+    if (toupper(piece) == 'R' && fromRow == homeRow && ((fromCol == 7 && hasCastlingRight(sideToMove, true)) || (fromCol == 0 && hasCastlingRight(sideToMove, false))))
+      continue;
+
+    if (wouldMoveLeaveKingInCheck(board, fromRow, fromCol, toRow, toCol))
+      continue;
+
+    bool duplicate = false;
+    for (int m = 0; m < count; m++)
+      if (moves[m][0] == fromRow && moves[m][1] == fromCol && moves[m][2] == toRow && moves[m][3] == toCol) {
+        duplicate = true;
+        break;
+      }
+    if (duplicate)
+      continue;
+
+    moves[count][0] = fromRow;
+    moves[count][1] = fromCol;
+    moves[count][2] = toRow;
+    moves[count][3] = toCol;
+    count++;
+  }
+  return count;
+}
+
 void ChessEngine::setCastlingRights(uint8_t rights) {
   castlingRights = rights;
 }
@@ -145,6 +226,53 @@ void ChessEngine::incrementFullmoveClock(char sideJustMoved) {
     fullmoveClock++;
 }
 
+void ChessEngine::updateCastlingRights(int fromRow, int fromCol, int toRow, int toCol, char movedPiece, char capturedPiece) {
+  uint8_t rights = castlingRights;
+
+  // King moved => lose both rights for that color
+  if (movedPiece == 'K')
+    rights &= ~(0x01 | 0x02);
+  else if (movedPiece == 'k')
+    rights &= ~(0x04 | 0x08);
+
+  // Rook moved from corner => lose that side's right
+  if (movedPiece == 'R') {
+    if (fromRow == 7 && fromCol == 7) rights &= ~0x01;
+    if (fromRow == 7 && fromCol == 0) rights &= ~0x02;
+  } else if (movedPiece == 'r') {
+    if (fromRow == 0 && fromCol == 7) rights &= ~0x04;
+    if (fromRow == 0 && fromCol == 0) rights &= ~0x08;
+  }
+
+  // Rook captured on corner => lose that side's right
+  if (capturedPiece == 'R') {
+    if (toRow == 7 && toCol == 7) rights &= ~0x01;
+    if (toRow == 7 && toCol == 0) rights &= ~0x02;
+  } else if (capturedPiece == 'r') {
+    if (toRow == 0 && toCol == 7) rights &= ~0x04;
+    if (toRow == 0 && toCol == 0) rights &= ~0x08;
+  }
+
+  castlingRights = rights;
+}
+
+void ChessEngine::playMove(char board[8][8], int fromRow, int fromCol, int toRow, int toCol, char promotion) {
+  char piece = board[fromRow][fromCol];
+  char capturedPiece;
+  makeMove(board, fromRow, fromCol, toRow, toCol, capturedPiece);
+  if (toupper(piece) == 'P' && abs(toRow - fromRow) == 2)
+    setEnPassantTarget((fromRow + toRow) / 2, fromCol);
+  else
+    clearEnPassantTarget();
+  updateHalfmoveClock(piece, capturedPiece);
+  updateCastlingRights(fromRow, fromCol, toRow, toCol, piece, capturedPiece);
+  incrementFullmoveClock(ChessUtils::getPieceColor(piece));
+  if (isPawnPromotion(piece, toRow)) {
+    char promoted = (promotion == ' ') ? 'q' : promotion;
+    board[toRow][toCol] = ChessUtils::isWhitePiece(piece) ? toupper(promoted) : tolower(promoted);
+  }
+}
+
 // Generate pseudo-legal moves (without check filtering)
 void ChessEngine::getPseudoLegalMoves(const char board[8][8], int row, int col, int& moveCount, int moves[][2], bool includeCastling) const {
   moveCount = 0;
@@ -655,4 +783,143 @@ bool ChessEngine::isInsufficientMaterial(const char board[8][8]) const {
     return true;
 
   return false;
-}
\ No newline at end of file
+}
+// ---------------------------
+// Gives-Check Detection
+// ---------------------------
+
+// Index into CheckInfo::checkSquares (P, N, B, R, Q, K), -1 for empty squares
+int ChessEngine::pieceTypeIndex(char piece) {
+  switch (toupper(piece)) {
+    case 'P': return 0;
+    case 'N': return 1;
+    case 'B': return 2;
+    case 'R': return 3;
+    case 'Q': return 4;
+    case 'K': return 5;
+    default: return -1;
+  }
+}
+
+// Squares reached from (row, col) along the given rays, up to and including the first occupied square
+uint64_t ChessEngine::rayAttacks(const char board[8][8], int row, int col, const int directions[][2], int directionCount) const {
+  uint64_t attacks = 0;
+  for (int d = 0; d < directionCount; d++) {
+    int r = row + directions[d][0];
+    int c = col + directions[d][1];
+    while (isValidSquare(r, c)) {
+      attacks |= 1ULL << (r * 8 + c);
+      if (board[r][c] != ' ') break;
+      r += directions[d][0];
+      c += directions[d][1];
+    }
+  }
+  return attacks;
+}
+
+void ChessEngine::computeCheckInfo(const char board[8][8], char sideToMove, CheckInfo& info) const {
+  static const int diagonals[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+  static const int orthogonals[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+  static const int knightOffsets[8][2] = {{2, 1}, {1, 2}, {-1, 2}, {-2, 1}, {-2, -1}, {-1, -2}, {1, -2}, {2, -1}};
+
+  info.sideToMove = sideToMove;
+  info.kingSquare = -1;
+  info.discoveredBlockers = 0;
+  for (int i = 0; i < 6; i++)
+    info.checkSquares[i] = 0;
+
+  char enemyColor = (sideToMove == 'w') ? 'b' : 'w';
+  int kingRow, kingCol;
+  if (!findKingPosition(board, enemyColor, kingRow, kingCol))
+    return;
+  info.kingSquare = kingRow * 8 + kingCol;
+
+  // Pawns attack one row forward, so a checking pawn stands one row behind the king (from the mover's view)
+  int pawnRow = kingRow - ((sideToMove == 'w') ? -1 : 1);
+  for (int dc = -1; dc <= 1; dc += 2)
+    if (isValidSquare(pawnRow, kingCol + dc))
+      info.checkSquares[0] |= 1ULL << (pawnRow * 8 + kingCol + dc);
+
+  for (int i = 0; i < 8; i++) {
+    int r = kingRow + knightOffsets[i][0];
+    int c = kingCol + knightOffsets[i][1];
+    if (isValidSquare(r, c))
+      info.checkSquares[1] |= 1ULL << (r * 8 + c);
+  }
+
+  info.checkSquares[2] = rayAttacks(board, kingRow, kingCol, diagonals, 4);
+  info.checkSquares[3] = rayAttacks(board, kingRow, kingCol, orthogonals, 4);
+  info.checkSquares[4] = info.checkSquares[2] | info.checkSquares[3];
+  // A king can never give check (checkSquares[5] stays empty); castling is handled in givesCheck()
+
+  // Discovered-check blockers: walk each ray from the king, an own piece followed by an own slider of the matching kind
+  for (int d = 0; d < 8; d++) {
+    bool diagonal = d < 4;
+    int dr = diagonal ? diagonals[d][0] : orthogonals[d - 4][0];
+    int dc = diagonal ? diagonals[d][1] : orthogonals[d - 4][1];
+    int blocker = -1;
+    for (int r = kingRow + dr, c = kingCol + dc; isValidSquare(r, c); r += dr, c += dc) {
+      char piece = board[r][c];
+      if (piece == ' ') continue;
+      if (ChessUtils::getPieceColor(piece) != sideToMove) break;
+      if (blocker < 0) {
+        blocker = r * 8 + c;
+        continue;
+      }
+      char type = toupper(piece);
+      if (type == 'Q' || type == (diagonal ? 'B' : 'R'))
+        info.discoveredBlockers |= 1ULL << blocker;
+      break;
+    }
+  }
+}
+
+bool ChessEngine::givesCheck(const char board[8][8], const CheckInfo& info, int fromRow, int fromCol, int toRow, int toCol, char promotion) const {
+  if (info.kingSquare < 0)
+    return false;
+
+  char piece = board[fromRow][fromCol];
+  char type = toupper(piece);
+  int kingRow = info.kingSquare / 8;
+  int kingCol = info.kingSquare % 8;
+
+  // Castling, en passant and promotion change more than the two move squares: settle them on a board copy
+  bool isCastling = type == 'K' && fromRow == toRow && abs(toCol - fromCol) == 2;
+  bool isEnPassant = type == 'P' && fromCol != toCol && board[toRow][toCol] == ' ';
+  bool isPromotion = type == 'P' && (toRow == 0 || toRow == 7);
+  if (isCastling || isEnPassant || isPromotion) {
+    char testBoard[8][8];
+    for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+        testBoard[r][c] = board[r][c];
+    char capturedPiece;
+    makeMove(testBoard, fromRow, fromCol, toRow, toCol, capturedPiece);
+    if (isPromotion) {
+      char promoted = (promotion == ' ') ? 'q' : promotion;
+      testBoard[toRow][toCol] = (info.sideToMove == 'w') ? toupper(promoted) : tolower(promoted);
+    }
+    return isSquareUnderAttack(testBoard, kingRow, kingCol, (info.sideToMove == 'w') ? 'b' : 'w');
+  }
+
+  // Direct check: the moved piece attacks the king from its destination
+  int typeIndex = pieceTypeIndex(piece);
+  if (typeIndex >= 0 && (info.checkSquares[typeIndex] & (1ULL << (toRow * 8 + toCol))))
+    return true;
+
+  // Discovered check: a blocker leaves the line between an own slider and the king
+  if (info.discoveredBlockers & (1ULL << (fromRow * 8 + fromCol))) {
+    bool staysOnLine = (fromRow - kingRow) * (toCol - kingCol) == (fromCol - kingCol) * (toRow - kingRow);
+    if (!staysOnLine)
+      return true;
+  }
+
+  return false;
+}
+
+uint64_t ChessEngine::getCheckingMoves(const char board[8][8], const CheckInfo& info, int fromRow, int fromCol, const int moves[][2], int moveCount) const {
+  uint64_t checking = 0;
+  for (int i = 0; i < moveCount; i++)
+    if (givesCheck(board, info, fromRow, fromCol, moves[i][0], moves[i][1]))
+      checking |= 1ULL << (moves[i][0] * 8 + moves[i][1]);
+  return checking;
+}
@@ -3,6 +3,16 @@
 
 #include <stdint.h>
 
+// Per-position data for cheap gives-check tests. Computed once for the side to move
+// so every candidate move can be tested with a couple of mask lookups instead of
+// making the move and scanning for attacks.
+struct CheckInfo {
+  char sideToMove;             // Color of the side whose moves are being tested
+  int kingSquare;              // Enemy king square (row * 8 + col), -1 if not on the board
+  uint64_t checkSquares[6];    // Squares from which a P, N, B, R, Q, K of sideToMove would attack the enemy king
+  uint64_t discoveredBlockers; // Own pieces that are the only blocker between an own slider and the enemy king
+};
+
 // ---------------------------
 // Chess Engine Class
 // ---------------------------
@@ -57,6 +67,10 @@ class ChessEngine {
   bool wouldMoveLeaveKingInCheck(const char board[8][8], int fromRow, int fromCol, int toRow, int toCol) const;
   void makeMove(char board[8][8], int fromRow, int fromCol, int toRow, int toCol, char& capturedPiece) const;
 
+  // Gives-check helpers
+  static int pieceTypeIndex(char piece);
+  uint64_t rayAttacks(const char board[8][8], int row, int col, const int directions[][2], int directionCount) const;
+
  public:
   ChessEngine();
 
@@ -90,11 +104,21 @@ class ChessEngine {
   void setFullmoveClock(int clock);
   void incrementFullmoveClock(char sideJustMoved);
 
+  // Drop castling rights lost by a king/rook move or a rook capture on its corner
+  void updateCastlingRights(int fromRow, int fromCol, int toRow, int toCol, char movedPiece, char capturedPiece);
+
+  // Play a move on a scratch board, updating castling rights, en passant and clocks like a game move
+  // (no position history). For lookahead positions on a copy of the game's engine.
+  void playMove(char board[8][8], int fromRow, int fromCol, int toRow, int toCol, char promotion = ' ');
+
   // Threefold repetition detection (Zobrist hash-based)
   uint64_t computeZobristHash(const char board[8][8], char sideToMove) const;
   void recordPosition(const char board[8][8], char sideToMove);
   void clearPositionHistory();
   bool isThreefoldRepetition() const;
+  // Upcoming repetition (cuckoo tables): legal reversible moves of sideToMove that recreate a position
+  // already in the history. Fills moves[][4] = {fromRow, fromCol, toRow, toCol}, returns the count.
+  int findRepetitionMoves(const char board[8][8], char sideToMove, int moves[][4], int maxMoves) const;
 
   // Main move generation function
   void getPossibleMoves(const char board[8][8], int row, int col, int& moveCount, int moves[][2]);
@@ -110,6 +134,12 @@ class ChessEngine {
   bool isCheckmate(const char board[8][8], char kingColor);
   bool isStalemate(const char board[8][8], char colorToMove);
   bool isInsufficientMaterial(const char board[8][8]) const;
+
+  // Gives-check detection without making the move (compute CheckInfo once per position)
+  void computeCheckInfo(const char board[8][8], char sideToMove, CheckInfo& info) const;
+  bool givesCheck(const char board[8][8], const CheckInfo& info, int fromRow, int fromCol, int toRow, int toCol, char promotion = ' ') const;
+  // Bitmask of destination squares (row * 8 + col) in moves[] that give check
+  uint64_t getCheckingMoves(const char board[8][8], const CheckInfo& info, int fromRow, int fromCol, const int moves[][2], int moveCount) const;
 };
 
 #endif // CHESS_ENGINE_H
\ No newline at end of file
@@ -16,7 +16,10 @@ const char ChessGame::INITIAL_BOARD[8][8] = {
     {'R', 'N', 'B', 'Q', 'K', 'B', 'N', 'R'}  // row 7 = rank 1 (White pieces, bottom row)
 };
 
-ChessGame::ChessGame(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, MoveHistory* mh) : boardDriver(bd), chessEngine(ce), wifiManager(wm), moveHistory(mh), currentTurn('w'), gameOver(false), replaying(false), lastUciMove("") {}
+ChessGame::ChessGame(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, MoveHistory* mh) : boardDriver(bd), chessEngine(ce), wifiManager(wm), moveHistory(mh), currentTurn('w'), gameOver(false), replaying(false), lastUciMove(""), repetitionMoveCount(0), legalMovesKey(0), boardOccupancy(0), captureTargetsMask(0), occupancyMismatchShown(0), premoveOccupancyFlip(0), occupancyMismatchSince(0), occupancyMismatchPending(false) {
+  memset(legalMoveMasks, 0, sizeof(legalMoveMasks));
+  memset(checkingMoveMasks, 0, sizeof(checkingMoveMasks));
+}
 
 void ChessGame::initializeBoard() {
   currentTurn = 'w';
@@ -25,6 +28,8 @@ void ChessGame::initializeBoard() {
   memcpy(board, INITIAL_BOARD, sizeof(INITIAL_BOARD));
   chessEngine->reset();
   chessEngine->recordPosition(board, currentTurn);
+  refreshLegalMoves();
+  updateRepetitionWarning();
   wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
   sendUiState();
 }
@@ -117,7 +122,7 @@ void ChessGame::applyMove(int fromRow, int fromCol, int toRow, int toCol, char p
   if (isCastling)
     applyCastling(fromRow, fromCol, toRow, toCol, piece, isRemoteMove);
 
-  updateCastlingRightsAfterMove(fromRow, fromCol, toRow, toCol, piece, capturedPiece);
+  chessEngine->updateCastlingRights(fromRow, fromCol, toRow, toCol, piece, capturedPiece);
 
   if (capturedPiece != ' ') {
     if (!replaying) boardDriver->captureAnimation(toRow, toCol);
@@ -195,28 +200,33 @@ bool ChessGame::tryPlayerMove(char playerColor, int& fromRow, int& fromCol, int&
 
       Serial.printf("Piece pickup from %c%d\n", (char)('a' + col), 8 - row);
 
-      // Generate possible moves
-      int moveCount = 0;
-      int moves[28][2];
-      chessEngine->getPossibleMoves(board, row, col, moveCount, moves);
+      // Legal destinations were generated when the turn began
+      ensureLegalMoves();
+      uint64_t destinations = legalMoveMasks[row * 8 + col];
 
       // Light up current square and possible move squares
       boardDriver->setSquareLED(row, col, LedColors::Cyan);
 
-      // Highlight possible move squares (different colors for empty vs capture)
-      for (int i = 0; i < moveCount; i++) {
-        int r = moves[i][0];
-        int c = moves[i][1];
+      // Highlight possible move squares (different colors for empty vs capture, quiet checks in yellow)
+      uint64_t checking = checkingMoveMasks[row * 8 + col];
+      for (uint64_t m = destinations; m; m &= m - 1) {
+        int sq = __builtin_ctzll(m);
+        int r = sq / 8;
+        int c = sq % 8;
 
         bool isEnPassantCapture = ChessUtils::isEnPassantMove(row, col, r, c, piece, board[r][c]);
         if (board[r][c] == ' ' && !isEnPassantCapture) {
-          boardDriver->setSquareLED(r, c, LedColors::White);
+          boardDriver->setSquareLED(r, c, (checking >> sq) & 1 ? LedColors::Yellow : LedColors::White);
         } else {
           boardDriver->setSquareLED(r, c, LedColors::Red);
           if (isEnPassantCapture)
             boardDriver->setSquareLED(ChessUtils::getEnPassantCapturedPawnRow(r, piece), c, LedColors::Purple);
         }
       }
+      // Warn about destinations that would repeat an earlier position
+      for (int i = 0; i < repetitionMoveCount; i++)
+        if (repetitionMoves[i][0] == row && repetitionMoves[i][1] == col)
+          boardDriver->setSquareLED(repetitionMoves[i][2], repetitionMoves[i][3], LedColors::Orange);
       boardDriver->showLEDs();
 
       // Wait for piece placement - handle both normal moves and captures
@@ -234,67 +244,53 @@ bool ChessGame::tryPlayerMove(char playerColor, int& fromRow, int& fromCol, int&
           break;
         }
 
-        // Then check all squares for a regular move or capture initiation
-        for (int r2 = 0; r2 < 8; r2++) {
-          for (int c2 = 0; c2 < 8; c2++) {
-            // Skip the original square which was already checked
-            if (r2 == row && c2 == col)
-              continue;
-
-            // Check if this would be a legal move
-            bool isLegalMove = false;
-            for (int i = 0; i < moveCount; i++)
-              if (moves[i][0] == r2 && moves[i][1] == c2) {
-                isLegalMove = true;
+        // Then check the legal destinations for a regular move or capture initiation
+        for (uint64_t m = destinations; m; m &= m - 1) {
+          int sq = __builtin_ctzll(m);
+          int r2 = sq / 8;
+          int c2 = sq % 8;
+
+          // For capture moves: detect when the target square is empty (captured piece removed)
+          // This works whether the piece was just removed or was already removed before pickup
+          bool isEnPassantCapture = ChessUtils::isEnPassantMove(row, col, r2, c2, piece, board[r2][c2]);
+          int enPassantCapturedPawnRow = ChessUtils::getEnPassantCapturedPawnRow(r2, piece);
+          auto isCapturedPiecePickedUp = [&]() -> bool {
+            if (isEnPassantCapture)
+              return !boardDriver->getSensorState(enPassantCapturedPawnRow, c2);
+            else
+              return !boardDriver->getSensorState(r2, c2);
+          };
+          if ((board[r2][c2] != ' ' || isEnPassantCapture) && isCapturedPiecePickedUp()) {
+            Serial.printf("Capture initiated at %c%d\n", (char)('a' + c2), 8 - r2);
+            // Store the target square and wait for the capturing piece to be placed there
+            targetRow = r2;
+            targetCol = c2;
+            piecePlaced = true;
+            if (isEnPassantCapture)
+              boardDriver->setSquareLED(enPassantCapturedPawnRow, c2, LedColors::Off);
+            // Blink the capture square to indicate waiting for piece placement
+            boardDriver->blinkSquare(r2, c2, LedColors::Red, 1, false);
+            // Wait for the capturing piece to be placed (or returned to origin to cancel)
+            while (!boardDriver->getSensorState(r2, c2)) {
+              boardDriver->readSensors();
+              // Allow cancellation by placing the piece back to its original position
+              if (boardDriver->getSensorState(row, col)) {
+                Serial.println("Capture cancelled");
+                targetRow = row;
+                targetCol = col;
                 break;
               }
-
-            // If not a legal move, no need to check further
-            if (!isLegalMove)
-              continue;
-
-            // For capture moves: detect when the target square is empty (captured piece removed)
-            // This works whether the piece was just removed or was already removed before pickup
-            bool isEnPassantCapture = ChessUtils::isEnPassantMove(row, col, r2, c2, piece, board[r2][c2]);
-            int enPassantCapturedPawnRow = ChessUtils::getEnPassantCapturedPawnRow(r2, piece);
-            auto isCapturedPiecePickedUp = [&]() -> bool {
-              if (isEnPassantCapture)
-                return !boardDriver->getSensorState(enPassantCapturedPawnRow, c2);
-              else
-                return !boardDriver->getSensorState(r2, c2);
-            };
-            if ((board[r2][c2] != ' ' || isEnPassantCapture) && isCapturedPiecePickedUp()) {
-              Serial.printf("Capture initiated at %c%d\n", (char)('a' + c2), 8 - r2);
-              // Store the target square and wait for the capturing piece to be placed there
-              targetRow = r2;
-              targetCol = c2;
-              piecePlaced = true;
-              if (isEnPassantCapture)
-                boardDriver->setSquareLED(enPassantCapturedPawnRow, c2, LedColors::Off);
-              // Blink the capture square to indicate waiting for piece placement
-              boardDriver->blinkSquare(r2, c2, LedColors::Red, 1, false);
-              // Wait for the capturing piece to be placed (or returned to origin to cancel)
-              while (!boardDriver->getSensorState(r2, c2)) {
-                boardDriver->readSensors();
-                // Allow cancellation by placing the piece back to its original position
-                if (boardDriver->getSensorState(row, col)) {
-                  Serial.println("Capture cancelled");
-                  targetRow = row;
-                  targetCol = col;
-                  break;
-                }
-                delay(SENSOR_READ_DELAY_MS);
-              }
-              break;
+              delay(SENSOR_READ_DELAY_MS);
             }
+            break;
+          }
 
-            // For normal non-capture moves: detect when a piece is placed on an empty square
-            if ((board[r2][c2] == ' ' && !isEnPassantCapture) && boardDriver->getSensorState(r2, c2)) {
-              targetRow = r2;
-              targetCol = c2;
-              piecePlaced = true;
-              break;
-            }
+          // For normal non-capture moves: detect when a piece is placed on an empty square
+          if ((board[r2][c2] == ' ' && !isEnPassantCapture) && boardDriver->getSensorState(r2, c2)) {
+            targetRow = r2;
+            targetCol = c2;
+            piecePlaced = true;
+            break;
           }
         }
 
@@ -307,14 +303,7 @@ bool ChessGame::tryPlayerMove(char playerColor, int& fromRow, int& fromCol, int&
         return false;
       }
 
-      bool legalMove = false;
-      for (int i = 0; i < moveCount; i++)
-        if (moves[i][0] == targetRow && moves[i][1] == targetCol) {
-          legalMove = true;
-          break;
-        }
-
-      if (!legalMove) {
+      if (!(destinations & (1ULL << (targetRow * 8 + targetCol)))) {
         Serial.println("Illegal move, reverting");
         boardDriver->clearAllLEDs();
         return false;
@@ -340,8 +329,13 @@ void ChessGame::advanceTurn() {
 
 void ChessGame::updateGameStatus() {
   advanceTurn();
+  refreshLegalMoves();
+  updateRepetitionWarning();
 
-  if (chessEngine->isCheckmate(board, currentTurn)) {
+  bool inCheck = chessEngine->isKingInCheck(board, currentTurn);
+  bool hasMove = hasAnyLegalMove();
+
+  if (inCheck && !hasMove) {
     char winnerColor = (currentTurn == 'w') ? 'b' : 'w';
     Serial.printf("CHECKMATE! %s wins!\n", ChessUtils::colorName(winnerColor));
     boardDriver->fireworkAnimation(ChessUtils::colorLed(winnerColor));
@@ -350,7 +344,7 @@ void ChessGame::updateGameStatus() {
     return;
   }
 
-  if (chessEngine->isStalemate(board, currentTurn)) {
+  if (!inCheck && !hasMove) {
     Serial.println("STALEMATE! Game is a draw.");
     boardDriver->fireworkAnimation(LedColors::Cyan);
     gameOver = true;
@@ -382,7 +376,7 @@ void ChessGame::updateGameStatus() {
     return;
   }
 
-  if (chessEngine->isKingInCheck(board, currentTurn)) {
+  if (inCheck) {
     Serial.printf("%s is in CHECK!\n", ChessUtils::colorName(currentTurn));
     boardDriver->clearAllLEDs(false);
 
@@ -395,9 +389,123 @@ void ChessGame::updateGameStatus() {
   Serial.printf("It's %s's turn !\n", ChessUtils::colorName(currentTurn));
 }
 
+void ChessGame::refreshLegalMoves() {
+  for (int sq = 0; sq < 64; sq++) {
+    legalMoveMasks[sq] = 0;
+    checkingMoveMasks[sq] = 0;
+  }
+  CheckInfo checkInfo;
+  chessEngine->computeCheckInfo(board, currentTurn, checkInfo);
+  for (int row = 0; row < 8; row++)
+    for (int col = 0; col < 8; col++) {
+      char piece = board[row][col];
+      if (piece == ' ' || ChessUtils::getPieceColor(piece) != currentTurn)
+        continue;
+      int moveCount = 0;
+      int moves[28][2];
+      chessEngine->getPossibleMoves(board, row, col, moveCount, moves);
+      for (int i = 0; i < moveCount; i++)
+        legalMoveMasks[row * 8 + col] |= 1ULL << (moves[i][0] * 8 + moves[i][1]);
+      checkingMoveMasks[row * 8 + col] = chessEngine->getCheckingMoves(board, checkInfo, row, col, moves, moveCount);
+    }
+
+  boardOccupancy = 0;
+  captureTargetsMask = 0;
+  for (int row = 0; row < 8; row++)
+    for (int col = 0; col < 8; col++)
+      if (board[row][col] != ' ')
+        boardOccupancy |= 1ULL << (row * 8 + col);
+  for (int sq = 0; sq < 64; sq++) {
+    char piece = board[sq / 8][sq % 8];
+    for (uint64_t m = legalMoveMasks[sq]; m; m &= m - 1) {
+      int to = __builtin_ctzll(m);
+      if (ChessUtils::isEnPassantMove(sq / 8, sq % 8, to / 8, to % 8, piece, board[to / 8][to % 8]))
+        captureTargetsMask |= 1ULL << (ChessUtils::getEnPassantCapturedPawnRow(to / 8, piece) * 8 + to % 8);
+      else
+        captureTargetsMask |= 1ULL << to;
+    }
+  }
+  captureTargetsMask &= boardOccupancy;
+  occupancyMismatchShown = 0; // Position changed, any lit diff was drawn against the old one
+
+  legalMovesKey = chessEngine->computeZobristHash(board, currentTurn);
+  wifiManager->updateLegalMoves(legalMoveMasks);
+}
+
+void ChessGame::ensureLegalMoves() {
+  // Cheap staleness guard for paths that change the position without starting a turn (e.g. Lichess sync)
+  if (legalMovesKey != chessEngine->computeZobristHash(board, currentTurn))
+    refreshLegalMoves();
+}
+
+bool ChessGame::hasAnyLegalMove() const {
+  for (int sq = 0; sq < 64; sq++)
+    if (legalMoveMasks[sq])
+      return true;
+  return false;
+}
+
+uint64_t ChessGame::occupancyDiff() const {
+  uint64_t diff = boardDriver->getSensorOccupancy() ^ boardOccupancy ^ premoveOccupancyFlip;
+  // A single captured piece lifted before the capturing piece moves is a normal capture
+  if ((diff & (diff - 1)) == 0 && (diff & captureTargetsMask))
+    return 0;
+  return diff;
+}
+
+bool ChessGame::checkBoardConsistency() {
+  uint64_t diff = occupancyDiff();
+  if (diff && !occupancyMismatchPending) {
+    // Expected occupancy may be stale if the position changed without starting a turn
+    ensureLegalMoves();
+    diff = occupancyDiff();
+    occupancyMismatchPending = diff != 0;
+    occupancyMismatchSince = millis();
+  }
+
+  if (diff == 0) {
+    occupancyMismatchPending = false;
+    if (occupancyMismatchShown && boardDriver->tryAcquireLEDs()) {
+      boardDriver->clearAllLEDs();
+      boardDriver->releaseLEDs();
+      occupancyMismatchShown = 0;
+    }
+    return true;
+  }
+
+  if (millis() - occupancyMismatchSince < OCCUPANCY_MISMATCH_MS)
+    return true;
+
+  if (diff != occupancyMismatchShown) {
+    if (!boardDriver->tryAcquireLEDs())
+      return false; // An animation owns the strip, retry next scan
+    Serial.printf("Board mismatch on %d square(s), waiting for correction...\n", __builtin_popcountll(diff));
+    boardDriver->clearAllLEDs(false);
+    for (uint64_t m = diff; m; m &= m - 1) {
+      int sq = __builtin_ctzll(m);
+      char piece = board[sq / 8][sq % 8];
+      // Extra piece on an empty square in red, missing piece in its own color
+      boardDriver->setSquareLED(sq / 8, sq % 8, piece == ' ' ? LedColors::Red : ChessUtils::colorLed(ChessUtils::getPieceColor(piece)));
+    }
+    boardDriver->showLEDs();
+    boardDriver->releaseLEDs();
+    occupancyMismatchShown = diff;
+  }
+  return false;
+}
+
+void ChessGame::updateRepetitionWarning() {
+  repetitionMoveCount = chessEngine->findRepetitionMoves(board, currentTurn, repetitionMoves, MAX_REPETITION_MOVES);
+  wifiManager->setRepetitionWarning(repetitionMoveCount > 0);
+  if (repetitionMoveCount > 0)
+    Serial.printf("Repetition warning: %d move(s) would repeat an earlier position\n", repetitionMoveCount);
+}
+
 void ChessGame::setBoardStateFromFEN(const String& fen) {
   ChessUtils::fenToBoard(fen, board, currentTurn, chessEngine);
   chessEngine->recordPosition(board, currentTurn);
+  refreshLegalMoves();
+  updateRepetitionWarning();
   if (moveHistory && moveHistory->isRecording())
     moveHistory->addFen(fen);
   wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
@@ -409,6 +517,7 @@ void ChessGame::setBoardStateFromFEN(const String& fen) {
 
 void ChessGame::resignGame(char resigningColor) {
   if (gameOver) return;
+  cancelPendingActions();
   char winnerColor = (resigningColor == 'w') ? 'b' : 'w';
   Serial.printf("RESIGNATION! %s resigns. %s wins!\n", ChessUtils::colorName(resigningColor), ChessUtils::colorName(winnerColor));
   boardDriver->fireworkAnimation(ChessUtils::colorLed(winnerColor));
@@ -418,6 +527,7 @@ void ChessGame::resignGame(char resigningColor) {
 
 void ChessGame::drawGame() {
   if (gameOver) return;
+  cancelPendingActions();
   Serial.println("DRAW by mutual agreement!");
   boardDriver->fireworkAnimation(LedColors::Cyan);
   gameOver = true;
@@ -453,36 +563,6 @@ bool ChessGame::checkPhysicalResignOrDraw() {
   return false;
 }
 
-void ChessGame::updateCastlingRightsAfterMove(int fromRow, int fromCol, int toRow, int toCol, char movedPiece, char capturedPiece) {
-  uint8_t rights = chessEngine->getCastlingRights();
-
-  // King moved => lose both rights for that color
-  if (movedPiece == 'K')
-    rights &= ~(0x01 | 0x02);
-  else if (movedPiece == 'k')
-    rights &= ~(0x04 | 0x08);
-
-  // Rook moved from corner => lose that side's right
-  if (movedPiece == 'R') {
-    if (fromRow == 7 && fromCol == 7) rights &= ~0x01;
-    if (fromRow == 7 && fromCol == 0) rights &= ~0x02;
-  } else if (movedPiece == 'r') {
-    if (fromRow == 0 && fromCol == 7) rights &= ~0x04;
-    if (fromRow == 0 && fromCol == 0) rights &= ~0x08;
-  }
-
-  // Rook captured on corner => lose that side's right
-  if (capturedPiece == 'R') {
-    if (toRow == 7 && toCol == 7) rights &= ~0x01;
-    if (toRow == 7 && toCol == 0) rights &= ~0x02;
-  } else if (capturedPiece == 'r') {
-    if (toRow == 0 && toCol == 7) rights &= ~0x04;
-    if (toRow == 0 && toCol == 0) rights &= ~0x08;
-  }
-
-  chessEngine->setCastlingRights(rights);
-}
-
 void ChessGame::applyCastling(int kingFromRow, int kingFromCol, int kingToRow, int kingToCol, char kingPiece, bool waitForKingCompletion) {
   int deltaCol = kingToCol - kingFromCol;
   if (kingFromRow != kingToRow) return;
@@ -561,4 +641,6 @@ void ChessGame::confirmSquareCompletion(int row, int col) {
 void ChessGame::sendUiState() {
   String fen = ChessUtils::boardToFEN(board, currentTurn, chessEngine);
   UIComm::sendStateUpdate(fen, lastUciMove);
+  ensureLegalMoves();
+  UIComm::sendLegalMoves(legalMoveMasks);
 }
\ No newline at end of file
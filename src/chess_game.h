@@ -27,6 +27,25 @@ class ChessGame {
   bool replaying;     // True while replaying moves during resume (suppresses LEDs and physical move waits)
   String lastUciMove; // Last move in UCI format (e.g. "e2e4") for UI slave display
 
+  // Moves of the side to move that would repeat an earlier position (refreshed every turn)
+  static const int MAX_REPETITION_MOVES = 8;
+  int repetitionMoves[MAX_REPETITION_MOVES][4];
+  int repetitionMoveCount;
+
+  // Legal destinations per origin square (bit row * 8 + col), generated once when a turn begins
+  uint64_t legalMoveMasks[64];
+  uint64_t checkingMoveMasks[64]; // The destinations among them that give check
+  uint64_t legalMovesKey; // Zobrist key of the position the masks were generated for
+
+  // Sensor-vs-board consistency: expected occupancy is refreshed with the legal moves, every scan is one XOR
+  static const unsigned long OCCUPANCY_MISMATCH_MS = 1000;
+  uint64_t boardOccupancy;
+  uint64_t captureTargetsMask; // Squares whose piece may be lifted first as part of a legal capture
+  uint64_t occupancyMismatchShown; // Differing squares currently lit (0 = none)
+  uint64_t premoveOccupancyFlip;   // Squares a premove already changed on the physical board (see ChessBot)
+  unsigned long occupancyMismatchSince;
+  bool occupancyMismatchPending;
+
   // Standard initial chess board setup
   static const char INITIAL_BOARD[8][8];
 
@@ -40,9 +59,14 @@ class ChessGame {
   bool tryPlayerMove(char playerColor, int& fromRow, int& fromCol, int& toRow, int& toCol);
   void updateGameStatus();
   void sendUiState(); // Send current FEN + last move to UI slave display
+  void updateRepetitionWarning();
+  void refreshLegalMoves();
+  void ensureLegalMoves();
+  bool hasAnyLegalMove() const;
+  uint64_t occupancyDiff() const;
+  bool checkBoardConsistency(); // False while a debounced mismatch pauses move acceptance
 
   // Chess rule helpers
-  void updateCastlingRightsAfterMove(int fromRow, int fromCol, int toRow, int toCol, char movedPiece, char capturedPiece);
   void applyCastling(int kingFromRow, int kingFromCol, int kingToRow, int kingToCol, char kingPiece, bool waitForKingCompletion = false);
   void confirmSquareCompletion(int row, int col);
 
@@ -54,6 +78,8 @@ class ChessGame {
 
   virtual void begin() = 0;
   virtual void update() = 0;
+  // Abort background work (engine requests, thinking animation) before the game is left or ended
+  virtual void cancelPendingActions() {}
 
   void setBoardStateFromFEN(const String& fen);
   bool isGameOver() const { return gameOver; }
@@ -1,6 +1,10 @@
 #include "chess_lichess.h"
 #include "chess_utils.h"
+#include "http_pool.h"
 #include "led_colors.h"
+#include "lichess_games.h"
+#include "lichess_move_sender.h"
+#include "net_telemetry.h"
 #include "wifi_manager_esp32.h"
 #include <Arduino.h>
 
@@ -13,8 +17,17 @@ ChessLichess::ChessLichess(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* w
       currentGameId(""),
       myColor('w'),
       lastKnownMoves(""),
+      knownMovesLength(0),
+      localPly(0),
+      resyncRequested(false),
       lastSentMove(""),
-      lastPollTime(0),
+      moveRequestId(0),
+      serverPly(0),
+      initialFen(""),
+      linkBlinkAt(0),
+      linkLedsOn(false),
+      linkLedColor(LedColors::Off),
+      gamesRefreshedAt(0),
       stopAnimation(nullptr) {}
 
 void ChessLichess::begin() {
@@ -55,18 +68,39 @@ void ChessLichess::begin() {
 void ChessLichess::waitForLichessGame() {
   Serial.println("Searching for active Lichess games...");
   std::atomic<bool>* stopAnimation = boardDriver->startWaitingAnimation();
+  // Lichess announces every ongoing game on connect, and new ones as they start.
+  // Take the first game where it is our turn, or the first game once the burst is over.
+  LichessGames::clear();
+  eventStream.open("/api/stream/event");
   LichessEvent event;
-  event.type = LichessEventType::UNKNOWN;
+  String line;
+  unsigned long firstGameAt = 0;
   while (!gameOver) {
-    if (!LichessAPI::pollForGameEvent(event) || event.type != LichessEventType::GAME_START) {
-      delay(2000);
+    if (!eventStream.poll(line)) {
+      if (firstGameAt != 0 && millis() - firstGameAt > LICHESS_GAME_SETTLE_MS)
+        break;
+      delay(10);
       continue;
     }
-    break;
+    if (!LichessAPI::parseEventStreamLine(line, event))
+      continue;
+    handleAccountEvent(event);
+    if (event.type != LichessEventType::GAME_START)
+      continue;
+    if (firstGameAt == 0)
+      firstGameAt = millis();
+    if (event.isMyTurn)
+      break;
   }
   if (stopAnimation) stopAnimation->store(true);
-  currentGameId = event.gameId;
-  myColor = event.myColor;
+  LichessGameSummary game;
+  if (gameOver || !LichessGames::pick(game))
+    return;
+  currentGameId = game.gameId;
+  myColor = game.myColor;
+  LichessGames::setCurrent(currentGameId);
+  if (LichessGames::count() > 1)
+    Serial.printf("%d ongoing Lichess games, switch between them from the board page\n", LichessGames::count());
 
   Serial.println("=== Game Found! ===");
   Serial.println("Game ID: " + currentGameId);
@@ -76,23 +110,40 @@ void ChessLichess::waitForLichessGame() {
   LichessGameState state;
   state.myColor = myColor;
   state.gameId = currentGameId;
-  state.fen = event.fen; // Use FEN from initial event as fallback
+  state.fen = game.fen; // Use FEN from initial event as fallback
+  state.lastMove = "";
+  state.moveCount = 0;
+  state.movesLength = 0;
+  state.newMoves = "";
+  state.diverged = false;
+  state.whiteTimeMs = -1;
+  state.blackTimeMs = -1;
 
-  if (LichessAPI::pollGameStream(currentGameId, state)) {
+  // Keep the game stream open for the whole game; its first event is gameFull
+  gameStream.open("/api/board/game/stream/" + currentGameId);
+  bool gotState = false;
+  unsigned long deadline = millis() + 15000;
+  while (!gotState && !gameOver && (long)(deadline - millis()) > 0) {
+    if (gameStream.poll(line))
+      gotState = LichessAPI::parseGameStreamLine(line, state);
+    else
+      delay(10);
+  }
+
+  if (gotState) {
     Serial.println("Got full game state from stream");
   } else {
     // Fallback: Use data from the initial event
     Serial.println("Warning: Could not get full game state, using initial event data");
     state.gameStarted = true;
     state.gameEnded = false;
-    state.lastMove = "";
     // Determine turn from FEN (6th field) or assume White starts
-    if (event.fen.length() > 0) {
+    if (state.fen.length() > 0) {
       int spaceCount = 0;
-      for (size_t i = 0; i < event.fen.length(); i++) {
-        if (event.fen[i] == ' ') spaceCount++;
+      for (size_t i = 0; i < state.fen.length(); i++) {
+        if (state.fen[i] == ' ') spaceCount++;
         if (spaceCount == 1) {
-          state.isMyTurn = (event.fen[i + 1] == 'w' && myColor == 'w') || (event.fen[i + 1] == 'b' && myColor == 'b');
+          state.isMyTurn = (state.fen[i + 1] == 'w' && myColor == 'w') || (state.fen[i + 1] == 'b' && myColor == 'b');
           break;
         }
       }
@@ -103,6 +154,10 @@ void ChessLichess::waitForLichessGame() {
 
   // Sync the board with the current game state
   syncBoardWithLichess(state);
+  sendClockToUi(state);
+  // The event FEN is only the current position; rebuild from the moves once the stream delivers them
+  if (!gotState)
+    resyncRequested = true;
 
   // Wait for board setup with the current position
   waitForBoardSetup(board);
@@ -117,17 +172,62 @@ void ChessLichess::syncBoardWithLichess(const LichessGameState& state) {
 
   myColor = state.myColor;
   currentGameId = state.gameId;
+  initialFen = state.fen;
 
-  // If FEN is provided, use it directly
+  // Start from the initial position and replay the moves list, checking every move
   if (state.fen.length() > 0 && state.fen != "startpos")
     setBoardStateFromFEN(state.fen);
   else
     Serial.println("No FEN provided, assuming starting position");
+  localPly = 0;
+  replaying = true;
+  bool replayed = true;
+  int start = 0;
+  while (replayed && start < (int)state.newMoves.length()) {
+    int end = state.newMoves.indexOf(' ', start);
+    if (end < 0)
+      end = state.newMoves.length();
+    if (end > start)
+      replayed = playLichessMove(state.newMoves.substring(start, end));
+    start = end + 1;
+  }
+  replaying = false;
+  refreshLegalMoves();
+  updateRepetitionWarning();
+  wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
+  sendUiState();
+
+  lastKnownMoves = state.lastMove;
+  knownMovesLength = state.movesLength;
+  serverPly = state.moveCount;
+  // A position from the game cache already includes the moves of its cursor
+  localPly = state.moveCount;
+  resyncRequested = false;
+  if (!replayed) {
+    Serial.println("ERROR: Lichess moves are not legal on this board, ending game!");
+    boardDriver->flashBoardAnimation(LedColors::Red);
+    gameOver = true;
+    return;
+  }
 
-  lastKnownMoves = "";
-  currentTurn = state.isMyTurn ? myColor : (myColor == 'w' ? 'b' : 'w');
+  Serial.printf("My color: %s, Is my turn: %s, Plies: %d\n", myColor == 'w' ? "White" : "Black", currentTurn == myColor ? "Yes" : "No", localPly);
+}
 
-  Serial.printf("My color: %s, Is my turn: %s\n", myColor == 'w' ? "White" : "Black", state.isMyTurn ? "Yes" : "No");
+ChessLichess::~ChessLichess() {
+  cancelPendingActions();
+}
+
+void ChessLichess::cancelPendingActions() {
+  gameStream.close();
+  eventStream.close();
+  // Free the sender entry of a move still in flight; nothing will poll it now
+  LichessMoveSender::forget(moveRequestId);
+  moveRequestId = 0;
+  if (stopAnimation) {
+    stopAnimation->store(true);
+    stopAnimation = nullptr;
+  }
+  ChessBot::cancelPendingActions();
 }
 
 void ChessLichess::update() {
@@ -139,11 +239,26 @@ void ChessLichess::update() {
   // Check for physical resign/draw gesture (both kings lifted)
   if (checkPhysicalResignOrDraw()) return;
 
+  // A premove made while the opponent thinks puts the board ahead of the game on purpose
+  bool premoveInHand = (currentTurn != myColor || premoveInProgress()) && trackPremove(myColor);
+
+  // Hold move acceptance while the physical board disagrees with the game position (remote moves still sync)
+  bool boardConsistent = premoveInHand || checkBoardConsistency();
+
+  // Another ongoing game picked on the board page
+  String switchTo;
+  if (LichessGames::takeSwitchRequest(switchTo) && switchTo != currentGameId) {
+    switchToGame(switchTo);
+    return;
+  }
+
+  updateLink();
+
   int fromRow, fromCol, toRow, toCol;
   char promotion = ' ';
 
-  if ((currentTurn == myColor) && tryPlayerMove(myColor, fromRow, fromCol, toRow, toCol)) {
-    // Player's turn - handle physical move
+  if ((currentTurn == myColor) && boardConsistent && (takePremove(myColor, fromRow, fromCol, toRow, toCol) || tryPlayerMove(myColor, fromRow, fromCol, toRow, toCol))) {
+    // Player's turn - handle physical move (a stored premove goes first)
     // Check if this will be a promotion BEFORE applyMove modifies the board
     bool isPromotion = chessEngine->isPawnPromotion(board[fromRow][fromCol], toRow);
     // Promotion is handled inside applyMove: if web client is connected, it waits for user choice, otherwise it defaults to queen.
@@ -152,69 +267,285 @@ void ChessLichess::update() {
     if (isPromotion)
       promotion = tolower(board[toRow][toCol]);
     updateGameStatus();
+    localPly++;
     wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
     sendUiState();
-    // Then send move to Lichess (blocking)
+    // Then queue the move for Lichess; it is posted in the background
     sendMoveToLichess(fromRow, fromCol, toRow, toCol, promotion);
+    cacheCurrentGame();
     boardDriver->updateSensorPrev();
   }
 
-  // Start thinking animation when it's remote player's turn and not already running
-  if (currentTurn != myColor && stopAnimation == nullptr && !gameOver)
+  // Start thinking animation when it's remote player's turn and not already running; a premove's LEDs replace it
+  if (hasPremove() && stopAnimation) {
+    stopAnimation->store(true);
+    stopAnimation = nullptr;
+  }
+  if (currentTurn != myColor && stopAnimation == nullptr && !gameOver && !hasPremove() && link.online())
     stopAnimation = boardDriver->startThinkingAnimation();
 
-  // Polling interval check
-  if ((currentTurn == myColor) || millis() - lastPollTime < POLL_INTERVAL_MS) {
-    boardDriver->updateSensorPrev();
+  checkPendingMove();
+
+  // Apply whatever the streams delivered since the last loop
+  String line;
+  LichessEvent event;
+  while (!gameOver && eventStream.poll(line))
+    if (LichessAPI::parseEventStreamLine(line, event))
+      handleAccountEvent(event);
+  while (!gameOver && gameStream.poll(line)) {
+    LichessGameState state;
+    state.myColor = myColor;
+    state.gameId = currentGameId;
+    state.gameEnded = false;
+    state.fen = initialFen;
+    // Parse only the moves beyond the known ones, or all of them for a resync
+    state.lastMove = resyncRequested ? "" : lastKnownMoves;
+    state.moveCount = resyncRequested ? 0 : serverPly;
+    state.movesLength = resyncRequested ? 0 : knownMovesLength;
+    if (LichessAPI::parseGameStreamLine(line, state)) {
+      initialFen = state.fen; // Only gameFull carries it
+      handleStreamState(state);
+      if (link.stateReceived()) {
+        Serial.println("Lichess: Back in sync with game " + currentGameId);
+        linkChanged();
+      }
+    }
+  }
+  if (!gameOver)
+    refreshOtherGames();
+  boardDriver->updateSensorPrev();
+}
+
+void ChessLichess::handleStreamState(const LichessGameState& state) {
+  // Before anything that waits for the player, so the clock is corrected as soon as the event arrives
+  sendClockToUi(state);
+  reconcilePendingMove(state);
+  if (gameOver)
+    return;
+  if (state.gameEnded) {
+    Serial.println("Game ended! Status: " + state.status);
+    if (state.winner.length() > 0)
+      Serial.println("Winner: " + state.winner);
+    if (stopAnimation) {
+      stopAnimation->store(true);
+      stopAnimation = nullptr;
+    }
+    gameStream.close();
+    eventStream.close();
+    LichessGames::remove(currentGameId);
+    if (state.status == "draw" || state.status == "stalemate" || state.winner == "draw")
+      boardDriver->fireworkAnimation(LedColors::Cyan);
+    else
+      boardDriver->fireworkAnimation(ChessUtils::colorLed((state.winner == "white") ? 'w' : 'b'));
+    gameOver = true;
+    return;
+  }
+  if (state.diverged || resyncRequested) {
+    Serial.println(state.diverged ? "Lichess: Moves no longer match the board (takeback?), resyncing" : "Lichess: Resyncing board");
+    if (stopAnimation) {
+      stopAnimation->store(true);
+      stopAnimation = nullptr;
+    }
+    // The board is rebuilt from Lichess' moves; an own move it does not have is dropped
+    pendingMove.dropIfMissing(state.moveCount);
+    syncBoardWithLichess(state);
+    cacheCurrentGame();
     return;
   }
-  lastPollTime = millis();
 
-  // Remote player's turn - poll Lichess for updates
-  LichessGameState state;
-  state.myColor = myColor;
-  state.gameId = currentGameId;
-  if (LichessAPI::pollGameStream(currentGameId, state)) {
-    if (state.gameEnded) {
-      Serial.println("Game ended! Status: " + state.status);
-      if (state.winner.length() > 0)
-        Serial.println("Winner: " + state.winner);
-      if (stopAnimation) {
-        stopAnimation->store(true);
-        stopAnimation = nullptr;
+  int ply = serverPly;
+  lastKnownMoves = state.lastMove;
+  knownMovesLength = state.movesLength;
+  serverPly = state.moveCount;
+  int start = 0;
+  while (start < (int)state.newMoves.length()) {
+    int end = state.newMoves.indexOf(' ', start);
+    if (end < 0)
+      end = state.newMoves.length();
+    String move = state.newMoves.substring(start, end);
+    start = end + 1;
+    if (move.length() == 0)
+      continue;
+    ply++;
+    // Skip moves already on the board (the echo of our own move)
+    if (ply <= localPly) {
+      if (move != lastSentMove) {
+        requestResync("Echoed move differs from the board");
+        return;
       }
-      if (state.status == "draw" || state.status == "stalemate" || state.winner == "draw")
-        boardDriver->fireworkAnimation(LedColors::Cyan);
-      else
-        boardDriver->fireworkAnimation(ChessUtils::colorLed((state.winner == "white") ? 'w' : 'b'));
-      gameOver = true;
-      return;
+      Serial.println("Skipping own move echo: " + move);
+      continue;
     }
-    // Check if there's a new move
-    if (state.lastMove.length() > 0 && state.lastMove != lastKnownMoves) {
-      lastKnownMoves = state.lastMove;
-      // Skip if this is the move we just sent (avoid processing our own move)
-      if (state.lastMove == lastSentMove) {
-        Serial.println("Skipping own move echo: " + state.lastMove);
-      } else {
-        Serial.println("Lichess move received: " + state.lastMove);
-        if (ChessUtils::parseUCIMove(state.lastMove, fromRow, fromCol, toRow, toCol, promotion)) {
-          if (stopAnimation) {
-            stopAnimation->store(true);
-            stopAnimation = nullptr;
-          }
-          Serial.printf("Lichess UCI move: %s = (%d,%d) -> (%d,%d)%s%c\n", state.lastMove.c_str(), fromRow, fromCol, toRow, toCol, promotion == ' ' ? "" : " Promotion to: ", promotion);
-          applyMove(fromRow, fromCol, toRow, toCol, promotion, true);
-          updateGameStatus();
-          wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
-          sendUiState();
-        } else {
-          Serial.println("Failed to parse Lichess UCI move: " + state.lastMove);
-        }
-      }
+    Serial.println("Lichess move received: " + move);
+    if (stopAnimation) {
+      stopAnimation->store(true);
+      stopAnimation = nullptr;
     }
+    if (!playLichessMove(move)) {
+      requestResync("Received move is not legal here");
+      return;
+    }
+    wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
+    sendUiState();
+    if (gameOver)
+      return;
+  }
+  cacheCurrentGame();
+}
+
+void ChessLichess::cacheCurrentGame() {
+  LichessGameSummary game;
+  memset(&game, 0, sizeof(game));
+  strncpy(game.gameId, currentGameId.c_str(), LICHESS_GAME_ID_LEN);
+  strncpy(game.fen, ChessUtils::boardToFEN(board, currentTurn, chessEngine).c_str(), LICHESS_FEN_MAX - 1);
+  strncpy(game.lastMove, lastUciMove.c_str(), sizeof(game.lastMove) - 1);
+  game.myColor = myColor;
+  game.isMyTurn = currentTurn == myColor;
+  // An own move Lichess has not echoed yet is on the board but not in the cursor
+  game.hasCursor = localPly == serverPly;
+  game.moveCount = serverPly;
+  game.movesLength = knownMovesLength;
+  LichessGames::update(game);
+}
+
+void ChessLichess::switchToGame(const String& gameId) {
+  LichessGameSummary game;
+  if (pendingMove.active() || !LichessGames::get(gameId, game)) {
+    Serial.println("Lichess: Cannot switch to game " + gameId + " now");
+    return;
+  }
+  Serial.println("=== Switching to Lichess game " + gameId + " ===");
+  cacheCurrentGame();
+  gameStream.close();
+  if (stopAnimation) {
+    stopAnimation->store(true);
+    stopAnimation = nullptr;
+  }
+  LichessMoveSender::forget(moveRequestId);
+  moveRequestId = 0;
+  pendingMove.clear();
+  lastSentMove = "";
+  clearPremove(); // It was made for the game being left
+
+  // Set the board up from the cache right away; the stream's gameFull then only adds
+  // moves made since, or rebuilds the position if the cache has no moves cursor
+  LichessGameState state;
+  state.gameId = gameId;
+  state.myColor = game.myColor;
+  state.fen = game.fen;
+  state.lastMove = game.hasCursor ? game.lastMove : "";
+  state.moveCount = game.hasCursor ? game.moveCount : 0;
+  state.movesLength = game.hasCursor ? game.movesLength : 0;
+  state.newMoves = "";
+  syncBoardWithLichess(state);
+  resyncRequested = !game.hasCursor;
+  LichessGames::setCurrent(currentGameId);
+  gameStream.open("/api/board/game/stream/" + currentGameId);
+
+  waitForBoardSetup(board);
+  Serial.println("Board synchronized! Game " + currentGameId + " resumed");
+  wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
+  sendUiState();
+}
+
+bool ChessLichess::playLichessMove(const String& uciMove) {
+  int fromRow, fromCol, toRow, toCol;
+  char promotion = ' ';
+  if (!ChessUtils::parseUCIMove(uciMove, fromRow, fromCol, toRow, toCol, promotion)) {
+    Serial.println("Failed to parse Lichess UCI move: " + uciMove);
+    return false;
+  }
+  // Lichess only sends legal moves, so a rejected one means the board lost track of the game
+  char piece = board[fromRow][fromCol];
+  if (piece == ' ' || ChessUtils::getPieceColor(piece) != currentTurn || !chessEngine->isValidMove(board, fromRow, fromCol, toRow, toCol)) {
+    Serial.println("Lichess move " + uciMove + " is not legal in the current position");
+    return false;
+  }
+  if (!replaying)
+    Serial.printf("Lichess UCI move: %s = (%d,%d) -> (%d,%d)%s%c\n", uciMove.c_str(), fromRow, fromCol, toRow, toCol, promotion == ' ' ? "" : " Promotion to: ", promotion);
+  if (!replaying)
+    dropConflictingPremove(fromRow, fromCol, toRow, toCol);
+  applyMove(fromRow, fromCol, toRow, toCol, promotion, true);
+  if (replaying)
+    advanceTurn();
+  else
+    updateGameStatus();
+  localPly++;
+  return true;
+}
+
+void ChessLichess::sendClockToUi(const LichessGameState& state) {
+  if (state.whiteTimeMs < 0 || state.blackTimeMs < 0)
+    return;
+  // Side to move on Lichess, from the ply count and the side to move in the initial position
+  bool blackStarts = initialFen.indexOf(" b ") > 0;
+  char active = ((state.moveCount % 2 == 1) != blackStarts) ? 'b' : 'w';
+  // Lichess starts the clocks once both sides have moved
+  bool running = state.moveCount >= 2 && !state.gameEnded;
+  long whiteMs = state.whiteTimeMs;
+  long blackMs = state.blackTimeMs;
+  if (running) {
+    // The times were taken when the event left the server; the running clock has lost
+    // the one-way delay since. Half the median request round trip on the pooled
+    // Lichess connections estimates it.
+    NetEndpointStats stats;
+    NetTelemetry::getStats(NetEndpoint::LICHESS, stats);
+    if (stats.samples == 0)
+      NetTelemetry::getStats(NetEndpoint::LICHESS_STREAM, stats);
+    long oneWayMs = stats.firstByte.p50 / 2;
+    if (active == 'w')
+      whiteMs = max(0L, whiteMs - oneWayMs);
+    else
+      blackMs = max(0L, blackMs - oneWayMs);
+  }
+  UIComm::sendClock(whiteMs, blackMs, active, running);
+}
+
+void ChessLichess::requestResync(const char* reason) {
+  Serial.printf("Lichess: %s, reloading the game\n", reason);
+  resyncRequested = true;
+  // A fresh connection starts with gameFull and its complete moves list
+  gameStream.reconnect();
+}
+
+void ChessLichess::handleAccountEvent(const LichessEvent& event) {
+  switch (event.type) {
+    case LichessEventType::GAME_START:
+      // The game on the board is cached from its own stream
+      if (event.gameId == currentGameId)
+        break;
+      LichessGames::update(event);
+      if (currentGameId.length() > 0)
+        Serial.println("Lichess: Game " + event.gameId + " is ongoing, switch to it from the board page");
+      break;
+    case LichessEventType::GAME_FINISH:
+      // The game stream reports the end of the current game with its result
+      LichessGames::remove(event.gameId);
+      if (event.gameId != currentGameId)
+        Serial.println("Lichess: Game " + event.gameId + " finished");
+      break;
+    case LichessEventType::CHALLENGE:
+      Serial.println("Lichess: Challenge from " + event.challenger + " (" + event.gameId + "), accept it on lichess.org to play here");
+      break;
+    case LichessEventType::CHALLENGE_CANCELED:
+    case LichessEventType::CHALLENGE_DECLINED:
+      Serial.println("Lichess: Challenge " + event.gameId + " is off");
+      break;
+    default:
+      break;
   }
-  boardDriver->updateSensorPrev();
+}
+
+void ChessLichess::refreshOtherGames() {
+  // Only the game on the board has a stream; the others are polled so their turn and FEN stay current
+  if (millis() - gamesRefreshedAt < LICHESS_GAMES_REFRESH_MS || LichessGames::count() < 2)
+    return;
+  // The request takes the pool slot kept for moves: only while the opponent is to move
+  // and no move of ours is in flight, so it is normally done before we play again
+  if (!link.online() || currentTurn == myColor || pendingMove.active() || moveRequestId != 0)
+    return;
+  if (LichessGames::refreshInBackground())
+    gamesRefreshedAt = millis();
 }
 
 void ChessLichess::sendMoveToLichess(int fromRow, int fromCol, int toRow, int toCol, char promotion) {
@@ -223,25 +554,117 @@ void ChessLichess::sendMoveToLichess(int fromRow, int fromCol, int toRow, int to
 
   // Track this move so we don't process it as a remote move when it echoes back
   lastSentMove = uciMove;
+  if (pendingMove.queue(uciMove, localPly, link.online()) == LichessMoveAction::POST)
+    postPendingMove();
+  else
+    Serial.println("Lichess: Offline, move " + uciMove + " queued until the game stream is back");
+}
 
-  // Retry up to 3 times if sending fails
-  const int maxRetries = 3;
-  int attempt = 0;
-  bool sent = false;
-  while (attempt < maxRetries && !sent) {
-    if (LichessAPI::makeMove(currentGameId, uciMove)) {
-      sent = true;
-      break;
-    } else {
-      Serial.printf("ERROR: Failed to send move to Lichess! Attempt %d/%d\n", attempt + 1, maxRetries);
-      delay(500);
-      attempt++;
+void ChessLichess::postPendingMove() {
+  // A result nobody collected (the stream confirmed the last move first) is not needed anymore
+  LichessMoveSender::forget(moveRequestId);
+  pendingMove.posting();
+  moveRequestId = LichessMoveSender::submit(currentGameId, pendingMove.move());
+  // Queue full: let the next streamed state decide, as for a failed POST
+  if (moveRequestId == 0 && pendingMove.postResult(false, true) == LichessMoveAction::RECONNECT)
+    gameStream.reconnect();
+}
+
+void ChessLichess::checkPendingMove() {
+  if (moveRequestId == 0)
+    return;
+  LichessMoveStatus status = LichessMoveSender::poll(moveRequestId);
+  if (status == LichessMoveStatus::PENDING)
+    return;
+  moveRequestId = 0;
+  bool online = link.online() && WiFi.status() == WL_CONNECTED;
+  LichessMoveAction action = pendingMove.postResult(status == LichessMoveStatus::SENT, online);
+  if (action == LichessMoveAction::RECONNECT) {
+    Serial.println("Lichess: Move " + pendingMove.move() + " not confirmed, checking the game state");
+    gameStream.reconnect();
+  } else if (status != LichessMoveStatus::SENT && pendingMove.active()) {
+    Serial.println("Lichess: Move " + pendingMove.move() + " kept until the connection is back");
+  }
+}
+
+void ChessLichess::updateLink() {
+  bool wifiUp = WiFi.status() == WL_CONNECTED;
+  LichessLinkActions actions = link.update(wifiUp, gameStream.isConnected(), millis());
+  if (actions.reopenStreams) {
+    Serial.println("Lichess: WiFi is back, reopening the streams");
+    HttpPool::closeIdle();
+    gameStream.reconnect();
+    eventStream.reconnect();
+  }
+  if (actions.retryWifi)
+    WiFi.reconnect();
+  if (actions.changed) {
+    if (link.state() == LichessLink::OFFLINE)
+      Serial.println(wifiUp ? "Lichess: Game stream lost, moves are kept until it is back" : "Lichess: WiFi lost, moves are kept until it is back");
+    else
+      Serial.println("Lichess: Game stream reopened, resyncing");
+    linkChanged();
+  }
+
+  // Blink while not online, and give the corners back once it is
+  if ((!link.online() || linkLedsOn) && millis() - linkBlinkAt >= LICHESS_LINK_BLINK_MS)
+    showLinkLeds(!link.online() && !linkLedsOn);
+}
+
+void ChessLichess::linkChanged() {
+  // The corner lights replace the thinking animation until the game is back in sync
+  if (!link.online() && stopAnimation) {
+    stopAnimation->store(true);
+    stopAnimation = nullptr;
+  }
+  showLinkLeds(!link.online());
+}
+
+void ChessLichess::showLinkLeds(bool on) {
+  static const int corners[4][2] = {{0, 0}, {0, 7}, {7, 0}, {7, 7}};
+  linkBlinkAt = millis();
+  if (!boardDriver->tryAcquireLEDs())
+    return; // An animation still owns the strip, retry on the next blink
+  LedRGB color = link.state() == LichessLink::OFFLINE ? LedColors::Red : LedColors::Lime;
+  // Only the corners, and what they showed comes back in the dark phase, so move,
+  // premove and consistency lights stay as they are
+  for (int i = 0; i < 4; i++) {
+    int row = corners[i][0];
+    int col = corners[i][1];
+    LedRGB shown = boardDriver->getSquareLED(row, col);
+    if (on) {
+      if (!linkLedsOn)
+        linkSavedColors[i] = shown;
+      boardDriver->setSquareLED(row, col, color);
+    } else if (linkLedsOn && shown.r == linkLedColor.r && shown.g == linkLedColor.g && shown.b == linkLedColor.b) {
+      // Unless something else lit the square in the meantime
+      boardDriver->setSquareLED(row, col, linkSavedColors[i]);
     }
   }
-  if (!sent) {
-    gameOver = true;
-    Serial.println("ERROR: All attempts to send move to Lichess failed, ending game!");
-    boardDriver->flashBoardAnimation(LedColors::Red);
-    lastSentMove = "";
+  boardDriver->showLEDs();
+  boardDriver->releaseLEDs();
+  linkLedsOn = on;
+  if (on)
+    linkLedColor = color;
+}
+
+void ChessLichess::reconcilePendingMove(const LichessGameState& state) {
+  // A resync rebuilds the board from Lichess' moves and drops the move instead
+  bool resendAllowed = !state.gameEnded && !state.diverged && !resyncRequested;
+  switch (pendingMove.stateReceived(state.moveCount, resendAllowed)) {
+    case LichessMoveAction::POST:
+      postPendingMove();
+      Serial.printf("Lichess: Resending move %s, attempt %d/%d\n", pendingMove.move().c_str(), pendingMove.getAttempts(), LICHESS_MOVE_MAX_ATTEMPTS);
+      break;
+    case LichessMoveAction::GIVE_UP:
+      gameOver = true;
+      Serial.println("ERROR: All attempts to send move to Lichess failed, ending game!");
+      gameStream.close();
+      eventStream.close();
+      boardDriver->flashBoardAnimation(LedColors::Red);
+      lastSentMove = "";
+      break;
+    default:
+      break;
   }
 }
@@ -2,9 +2,19 @@
 #define CHESS_LICHESS_H
 
 #include "chess_bot.h"
+#include "lichess_games.h"
 #include "lichess_api.h"
+#include "lichess_link.h"
+#include "lichess_stream.h"
 #include <atomic>
 
+// On start, how long to wait for more ongoing games once the first is announced
+#define LICHESS_GAME_SETTLE_MS 1500
+// Blink period of the corner LEDs while offline (red) or resyncing (lime)
+#define LICHESS_LINK_BLINK_MS 500
+// How often the ongoing games not on the board are polled for the board page's list
+#define LICHESS_GAMES_REFRESH_MS 30000
+
 // Lichess game configuration
 struct LichessConfig {
   String apiToken;
@@ -16,14 +26,32 @@ class ChessLichess : public ChessBot {
   String currentGameId;
   char myColor; // 'w' or 'b' - the color we play as
 
-  // Last known state from Lichess
-  String lastKnownMoves;
+  // Moves known from the Lichess stream (the cursor for incremental parsing)
+  String lastKnownMoves; // Last move of the known list
+  size_t knownMovesLength;
+  int localPly;         // Plies played on the board, including own moves Lichess has not echoed yet
+  bool resyncRequested; // Rebuild the board from the full moves list on the next streamed state
   // Track last move we sent to avoid processing it as remote move
   String lastSentMove;
 
-  // Polling state
-  unsigned long lastPollTime;
-  static const unsigned long POLL_INTERVAL_MS = 500;
+  // Own move not yet seen on the game stream, and its LichessMoveSender request
+  LichessPendingMove pendingMove;
+  uint32_t moveRequestId; // Sender id, 0 once its result was collected
+  int serverPly;          // Ply count of the last streamed state
+  String initialFen;      // Start position of the game, empty for the standard one
+
+  // Link state across WiFi drops
+  LichessLinkMonitor link;
+  unsigned long linkBlinkAt;
+  bool linkLedsOn;
+  LedRGB linkLedColor;       // Color of the link lights while on
+  LedRGB linkSavedColors[4]; // What the corners showed before the link lights went on
+
+  unsigned long gamesRefreshedAt; // Last poll of the other ongoing games
+
+  // Persistent /api/stream/event and /api/board/game/stream/{id} connections
+  LichessStream eventStream;
+  LichessStream gameStream;
 
   // Animation stop flag for remote turn thinking animation
   std::atomic<bool>* stopAnimation;
@@ -31,12 +59,28 @@ class ChessLichess : public ChessBot {
   // Game flow
   void waitForLichessGame();
   void syncBoardWithLichess(const LichessGameState& state);
+  void handleStreamState(const LichessGameState& state);
+  bool playLichessMove(const String& uciMove);
+  void sendClockToUi(const LichessGameState& state);
+  void requestResync(const char* reason);
+  void cacheCurrentGame();
+  void switchToGame(const String& gameId);
+  void handleAccountEvent(const LichessEvent& event);
+  void refreshOtherGames();
   void sendMoveToLichess(int fromRow, int fromCol, int toRow, int toCol, char promotion = ' ');
+  void postPendingMove();
+  void checkPendingMove();
+  void reconcilePendingMove(const LichessGameState& state);
+  void updateLink();
+  void linkChanged();
+  void showLinkLeds(bool on);
 
  public:
   ChessLichess(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, LichessConfig cfg);
+  ~ChessLichess() override;
   void begin() override;
   void update() override;
+  void cancelPendingActions() override;
 };
 
 #endif // CHESS_LICHESS_H
@@ -30,6 +30,12 @@ void ChessMoves::update() {
   // Check for physical resign/draw gesture (both kings lifted)
   if (checkPhysicalResignOrDraw()) return;
 
+  // Hold move acceptance while the physical board disagrees with the game position
+  if (!checkBoardConsistency()) {
+    boardDriver->updateSensorPrev();
+    return;
+  }
+
   int fromRow, fromCol, toRow, toCol;
   if (tryPlayerMove(currentTurn, fromRow, fromCol, toRow, toCol)) {
     applyMove(fromRow, fromCol, toRow, toCol);
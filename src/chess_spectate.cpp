@@ -0,0 +1,217 @@
+#include "chess_spectate.h"
+#include "chess_utils.h"
+#include "led_colors.h"
+#include "wifi_manager_esp32.h"
+#include <Arduino.h>
+
+// Piece placement field of a FEN
+static String placementOf(const String& fen) {
+  int space = fen.indexOf(' ');
+  return space > 0 ? fen.substring(0, space) : fen;
+}
+
+ChessSpectate::ChessSpectate(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, const String& target)
+    : ChessGame(bd, ce, wm, nullptr),
+      target(target),
+      streamGameId(""),
+      streamFinished(false),
+      guideMask(0),
+      guideShown(false),
+      guideFrom(-1),
+      guideTo(-1),
+      guideRookFrom(-1),
+      guideRookTo(-1),
+      guideEnPassant(-1),
+      guideCapture(false) {}
+
+void ChessSpectate::begin() {
+  Serial.println("=== Starting Spectate Mode ===");
+
+  if (!wifiManager->connectToWiFi(wifiManager->getWiFiSSID(), wifiManager->getWiFiPassword())) {
+    Serial.println("Failed to connect to WiFi. Spectate mode unavailable.");
+    boardDriver->flashBoardAnimation(LedColors::Red);
+    gameOver = true;
+    return;
+  }
+
+  // Public streams need no token, but use it when configured
+  LichessAPI::setToken(wifiManager->getLichessToken());
+  initializeBoard();
+
+  String path = target == "tv" ? String("/api/tv/feed") : "/api/stream/game/" + target;
+  Serial.println("Waiting for the first position of " + path + "...");
+  stream.open(path);
+  std::atomic<bool>* stopAnimation = boardDriver->startWaitingAnimation();
+  bool gotPosition = false;
+  String line;
+  unsigned long deadline = millis() + 15000;
+  while (!gotPosition && (long)(deadline - millis()) > 0) {
+    if (stream.poll(line))
+      gotPosition = handleStreamLine(line);
+    else
+      delay(10);
+  }
+  if (stopAnimation) stopAnimation->store(true);
+
+  if (!gotPosition) {
+    Serial.println("No position received, check the game id");
+    stream.close();
+    boardDriver->flashBoardAnimation(LedColors::Red);
+    gameOver = true;
+    return;
+  }
+  // No waitForBoardSetup: the mismatch lights show what to place while the stream keeps going
+  Serial.println("Set up the board as lit, moves are shown as they are played");
+  Serial.println("====================================");
+}
+
+void ChessSpectate::update() {
+  boardDriver->readSensors();
+
+  String line;
+  for (int i = 0; i < SPECTATE_MAX_LINES_PER_UPDATE && stream.poll(line); i++)
+    handleStreamLine(line);
+
+  updateBoardLeds();
+  boardDriver->updateSensorPrev();
+
+  if (streamFinished && guideMask == 0 && occupancyDiff() == 0) {
+    Serial.println("Spectated game is over");
+    gameOver = true;
+  }
+}
+
+void ChessSpectate::cancelPendingActions() {
+  stream.close();
+}
+
+bool ChessSpectate::handleStreamLine(const String& line) {
+  LichessSpectateEvent event;
+  if (!LichessAPI::parseSpectateStreamLine(line, event))
+    return false;
+
+  if (event.gameId.length() > 0 && event.gameId != streamGameId) {
+    // The TV switched games (or the first line arrived): take its position as is
+    Serial.println("Spectating Lichess game " + event.gameId);
+    streamGameId = event.gameId;
+    resetToFen(event.fen, event.lastMove);
+  } else if (placementOf(ChessUtils::boardToFEN(board, currentTurn)) != placementOf(event.fen)) {
+    // Follow the move through the engine; the streamed position stays the reference
+    bool boardInSync = guideMask == 0 && occupancyDiff() == 0;
+    if (event.lastMove.length() == 0 || !playStreamedMove(event.lastMove, boardInSync) || placementOf(ChessUtils::boardToFEN(board, currentTurn)) != placementOf(event.fen)) {
+      Serial.println("Streamed position does not follow from the board, resetting to it");
+      resetToFen(event.fen, event.lastMove);
+    }
+  }
+
+  // The TV feed moves on to the next featured game by itself
+  if (event.finished && target != "tv" && !streamFinished) {
+    Serial.println("Lichess game " + streamGameId + " ended");
+    streamFinished = true;
+    stream.close();
+  }
+  return true;
+}
+
+bool ChessSpectate::playStreamedMove(const String& uciMove, bool boardInSync) {
+  int fromRow, fromCol, toRow, toCol;
+  char promotion = ' ';
+  if (!ChessUtils::parseUCIMove(uciMove, fromRow, fromCol, toRow, toCol, promotion))
+    return false;
+  char piece = board[fromRow][fromCol];
+  if (piece == ' ' || ChessUtils::getPieceColor(piece) != currentTurn || !chessEngine->isValidMove(board, fromRow, fromCol, toRow, toCol))
+    return false;
+
+  clearGuidance();
+  char captured = board[toRow][toCol];
+  bool isCastling = ChessUtils::isCastlingMove(fromRow, fromCol, toRow, toCol, piece);
+  bool isEnPassant = ChessUtils::isEnPassantMove(fromRow, fromCol, toRow, toCol, piece, captured);
+
+  // Engine bookkeeping only: update() guides the move without waiting for it
+  replaying = true;
+  applyMove(fromRow, fromCol, toRow, toCol, promotion, true);
+  replaying = false;
+  advanceTurn();
+  refreshLegalMoves();
+  wifiManager->updateBoardState(ChessUtils::boardToFEN(board, currentTurn, chessEngine), ChessUtils::evaluatePosition(board));
+  sendUiState();
+
+  // Guide the move only if the pieces matched the previous position, otherwise the mismatch lights take over
+  if (!boardInSync)
+    return true;
+  guideFrom = fromRow * 8 + fromCol;
+  guideTo = toRow * 8 + toCol;
+  guideCapture = captured != ' ' || isEnPassant;
+  guideEnPassant = isEnPassant ? ChessUtils::getEnPassantCapturedPawnRow(toRow, piece) * 8 + toCol : -1;
+  guideRookFrom = isCastling ? fromRow * 8 + (toCol > fromCol ? 7 : 0) : -1;
+  guideRookTo = isCastling ? fromRow * 8 + (toCol > fromCol ? 5 : 3) : -1;
+  guideMask = (1ULL << guideFrom) | (1ULL << guideTo);
+  if (guideEnPassant >= 0)
+    guideMask |= 1ULL << guideEnPassant;
+  if (isCastling)
+    guideMask |= (1ULL << guideRookFrom) | (1ULL << guideRookTo);
+  return true;
+}
+
+void ChessSpectate::resetToFen(const String& fen, const String& lastMove) {
+  clearGuidance();
+  String fullFen = fen;
+  if (fen.indexOf(' ') < 0) {
+    // Placement only: the side to move is the opponent of the piece that just landed
+    char placed[8][8];
+    char turn = currentTurn;
+    ChessUtils::fenToBoard(fen, placed, turn);
+    int fromRow, fromCol, toRow, toCol;
+    char promotion;
+    if (lastMove.length() > 0 && ChessUtils::parseUCIMove(lastMove, fromRow, fromCol, toRow, toCol, promotion) && placed[toRow][toCol] != ' ')
+      turn = ChessUtils::getPieceColor(placed[toRow][toCol]) == 'w' ? 'b' : 'w';
+    fullFen += turn == 'w' ? " w" : " b";
+  }
+  setBoardStateFromFEN(fullFen);
+}
+
+void ChessSpectate::updateBoardLeds() {
+  if (guideMask) {
+    uint64_t diff = occupancyDiff();
+    if (diff == 0) {
+      // Move completed on the physical board
+      clearGuidance();
+      return;
+    }
+    if ((diff & ~guideMask) == 0) {
+      if (!guideShown)
+        showGuidance();
+      return;
+    }
+    // Pieces changed outside the move: show the squares to fix instead
+    clearGuidance();
+  }
+  checkBoardConsistency();
+}
+
+void ChessSpectate::showGuidance() {
+  if (!boardDriver->tryAcquireLEDs())
+    return; // An animation owns the strip, retry next scan
+  boardDriver->clearAllLEDs(false);
+  boardDriver->setSquareLED(guideFrom / 8, guideFrom % 8, LedColors::Cyan);
+  boardDriver->setSquareLED(guideTo / 8, guideTo % 8, guideCapture ? LedColors::Red : LedColors::White);
+  if (guideEnPassant >= 0)
+    boardDriver->setSquareLED(guideEnPassant / 8, guideEnPassant % 8, LedColors::Purple);
+  if (guideRookFrom >= 0) {
+    boardDriver->setSquareLED(guideRookFrom / 8, guideRookFrom % 8, LedColors::Cyan);
+    boardDriver->setSquareLED(guideRookTo / 8, guideRookTo % 8, LedColors::White);
+  }
+  boardDriver->showLEDs();
+  boardDriver->releaseLEDs();
+  guideShown = true;
+}
+
+void ChessSpectate::clearGuidance() {
+  if ((guideShown || occupancyMismatchShown) && boardDriver->tryAcquireLEDs()) {
+    boardDriver->clearAllLEDs();
+    boardDriver->releaseLEDs();
+    occupancyMismatchShown = 0;
+  }
+  guideMask = 0;
+  guideShown = false;
+}
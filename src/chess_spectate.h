@@ -0,0 +1,47 @@
+#ifndef CHESS_SPECTATE_H
+#define CHESS_SPECTATE_H
+
+#include "chess_game.h"
+#include "lichess_api.h"
+#include "lichess_stream.h"
+
+// Stream lines handled per update, so a burst of positions cannot starve the sensor scan
+#define SPECTATE_MAX_LINES_PER_UPDATE 4
+
+// ---------------------------
+// Spectate Mode Class
+// ---------------------------
+// Read-only mode that follows a Lichess game (or the featured TV game) on the board.
+// Streamed moves go through the engine; the LEDs guide each move on the physical board
+// without waiting for it, and light the squares to fix once the pieces lag behind.
+class ChessSpectate : public ChessGame {
+ private:
+  String target;       // Lichess game id, or "tv" for the featured game
+  String streamGameId; // Game currently shown
+  bool streamFinished; // The followed game ended; leave once the pieces match it
+  LichessStream stream;
+
+  // Guidance for the last streamed move, shown while the physical board follows it
+  uint64_t guideMask; // Squares the move changes, 0 when no guidance is active
+  bool guideShown;
+  // Squares as row * 8 + col, -1 when the move has none
+  int guideFrom, guideTo;
+  int guideRookFrom, guideRookTo; // Castling
+  int guideEnPassant;             // Pawn captured en passant
+  bool guideCapture;
+
+  bool handleStreamLine(const String& line);
+  bool playStreamedMove(const String& uciMove, bool boardInSync);
+  void resetToFen(const String& fen, const String& lastMove);
+  void updateBoardLeds();
+  void showGuidance();
+  void clearGuidance();
+
+ public:
+  ChessSpectate(BoardDriver* bd, ChessEngine* ce, WiFiManagerESP32* wm, const String& target);
+  void begin() override;
+  void update() override;
+  void cancelPendingActions() override;
+};
+
+#endif // CHESS_SPECTATE_H
@@ -0,0 +1,2578 @@
+#ifndef CUCKOO_TABLES_H
+#define CUCKOO_TABLES_H
+
+#include <Arduino.h>
+
+// Cuckoo tables for upcoming-repetition detection, generated from zobrist_keys.h.
+// Holds every reversible non-pawn move as key = Z[piece][from] ^ Z[piece][to] ^ Z[side]
+// (3668 moves, both directions share one entry). Lookup slots: H1 = key & 0x1FFF, H2 = (key >> 16) & 0x1FFF.
+// Move encoding: bits 12-15 Zobrist piece index, bits 6-11 lower square, bits 0-5 higher square (0 = empty slot).
+// Stored in flash (PROGMEM) like the Zobrist keys; rerun tools/gen_cuckoo_tables.py when those change.
+
+#define CUCKOO_TABLE_SIZE 8192
+
+static const uint64_t PROGMEM CUCKOO_KEYS[CUCKOO_TABLE_SIZE] = {
+    0xEFC8EF8BCECF6000ULL, 0x2C0110989A97C001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1496DE2580040F71ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF840F823A1DC007ULL,
+    0x0000000000000000ULL, 0xEBC697D597118009ULL, 0xCE958A55600A9646ULL, 0xFF18D31CC8F4400BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x09D9208262090010ULL, 0x0000000000000000ULL, 0x9C44CE7F0D1E0012ULL, 0x42542A7DDA07C013ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x90C8FE9A88E22016ULL, 0xECA735FCC017A0CBULL,
+    0xEE62C87EA018E987ULL, 0x9E6131F25D1D8019ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x95CC852261A2201CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xAB681872DCCA4020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xEFD61D00A023E987ULL,
+    0x0000000000000000ULL, 0x7A9A2E3AD72D8025ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD00EBB40C0291156ULL, 0x284D74548232C02AULL, 0x0000000000000000ULL,
+    0x671C4DDA694F802CULL, 0x34F006E64C74202DULL, 0x7A541B912006202EULL, 0x0000000000000000ULL,
+    0x40413CCA603B4030ULL, 0x7234FDC1BDF7C031ULL, 0x1EE6BEC8C3E32032ULL, 0xE181660A0445E033ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x4BEEE7484039D3D9ULL, 0x0000000000000000ULL, 0x02BBE58A203B6FE3ULL,
+    0x129CB2552E79E03CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD376973BA041260DULL, 0x938D59DFCEBC0042ULL, 0xA760760ECD804043ULL,
+    0x36277C30E0441E6BULL, 0x27D77C96D3518045ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4D32489BF5A52048ULL, 0x0000000000000000ULL, 0x5BC7897A0E2A204AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF75901508C7B204FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA814D8C75E2BE058ULL, 0x0000000000000000ULL, 0xBCB511B0E05A9E78ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD2688E638AECC05DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6C749D96EB0BA061ULL, 0xCAC24FA860C30062ULL, 0x0000000000000000ULL,
+    0x2E517A5CC1AFC064ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x81EA37C4EAC16068ULL, 0xB53ACAE4185AA069ULL, 0x0000000000000000ULL, 0xB25407BC957BA06BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x351E929E6B97806FULL,
+    0x0000000000000000ULL, 0xB76D1CF8C6812071ULL, 0x0000000000000000ULL, 0x4FCF70D0CE666073ULL,
+    0x8E7D44DEE0749EA8ULL, 0x0000000000000000ULL, 0xA42AC0FED77E6076ULL, 0xFAFF9038E5EB0077ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA4B0CAB3E97C407DULL, 0x40133754D818C07EULL, 0x0000000000000000ULL,
+    0x720C372A2BB34080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3A4C87A67AF58084ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE7C19A4EFD78E089ULL, 0x9CDEC9D02E88008AULL, 0xB6585367997BA08BULL,
+    0x8C5C9F979A42C08CULL, 0x0000000000000000ULL, 0xB662641F208EAFF5ULL, 0x78FCB0FA4E87408FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC75A4FD758A2E092ULL, 0x68E618BBEF292093ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x51BBCDAED8AD0098ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD1E6629CE09BAF21ULL,
+    0x8D8AEB45609C4BB5ULL, 0x3E3B4686D93A809DULL, 0x0000000000000000ULL, 0x5C02B7825CEB209FULL,
+    0x36E2699960A0EC0FULL, 0x29860562CBA440A1ULL, 0x1466C9BFB18240A2ULL, 0x0000000000000000ULL,
+    0x9A14E203DB32E0A4ULL, 0x0000000000000000ULL, 0xD20D5BA800A6CF44ULL, 0x0000000000000000ULL,
+    0xC0471E2F448AC0A8ULL, 0x0000000000000000ULL, 0xDE30879059D380AAULL, 0x88F6D27F392E40ABULL,
+    0x735139DBAB3C00ACULL, 0x0000000000000000ULL, 0x21F6E877954C60AEULL, 0x5E7F1BF6ABB680AFULL,
+    0x6AB61BF3FF4E80B0ULL, 0x0000000000000000ULL, 0xD377F65C20B23C69ULL, 0x5F300CFFCB7FC0B3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6B3B07C2A92460B6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB3B472264680E0B9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8AAB67AC40C07AEFULL, 0x0000000000000000ULL, 0x64BBC0E81438A0C2ULL, 0x0000000000000000ULL,
+    0xBA7D7BFDD656A0C4ULL, 0x0000000000000000ULL, 0x46115203F83660C6ULL, 0x74489857242840C7ULL,
+    0xB93AD22C194680C8ULL, 0x0000000000000000ULL, 0x007FA92A80CA7D42ULL, 0xC4D23BA4D63D20CBULL,
+    0xEDE441B4580600CCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x76C477E49F7500D0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD8516EE5905FE0D3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x70B77C1544CEA0D6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xAD99606CDE8580D9ULL, 0x74EC656C564D40DAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x736AC7E8E0DD6BD8ULL, 0x0000000000000000ULL, 0xA509C45A729860DFULL,
+    0x8DE3202C60E00ECBULL, 0x30448D7E612360E1ULL, 0x0000000000000000ULL, 0x563D3D613B19A0E3ULL,
+    0xB994298D00E44FAEULL, 0x6697E80640E5270AULL, 0x3F5BC806C1D400E6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3CEB4DFFA0E96930ULL, 0xBBEAB7359E7100EAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1AFDEDD120EE6A92ULL, 0x0000000000000000ULL,
+    0xCC9C0E833DD2C0F0ULL, 0x35F1890BB55A40F1ULL, 0x7E253A83731DE0F2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xBA0A14D833BE40F6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x03C14CB4AA2140FCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFFBB2314522F0104ULL, 0xA9BAD41A8105F9C1ULL, 0xC16A9969B6C70106ULL, 0x0000000000000000ULL,
+    0xD84AF97401089665ULL, 0x0000000000000000ULL, 0x3F89B93FDDE1010AULL, 0x0000000000000000ULL,
+    0xFDF9C80C059DC10CULL, 0xCBBB5702210DA8B3ULL, 0x0000000000000000ULL, 0x850C369D07DA810FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xAF4C8997E5A08113ULL,
+    0xB67B2B00EBB36114ULL, 0x0000000000000000ULL, 0x1D058EA7ADBE8116ULL, 0x0000000000000000ULL,
+    0xD61F9E91D9D54118ULL, 0x0000000000000000ULL, 0x506FFD0BE904E11AULL, 0x0000000000000000ULL,
+    0x2CD439F8B73AC11CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF3EDF99A2123BF99ULL,
+    0x0000000000000000ULL, 0x9F417A66EB298125ULL, 0xC32EFE132397E126ULL, 0x0000000000000000ULL,
+    0x258BDEB2E1280904ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD4D56C70D2A8E12BULL,
+    0x1A1ED118FA6CA12CULL, 0x0000000000000000ULL, 0xEDDB6E08F15A412EULL, 0xA33EF87AA749212FULL,
+    0x0000000000000000ULL, 0xB94723B183728131ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE04AACC57B942135ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x501A6C55534E6139ULL, 0x1D44C0FDA528413AULL, 0xFC6EE0589208813BULL,
+    0x0000000000000000ULL, 0xAEB460F2E13D71E7ULL, 0x2E04E86AD984213EULL, 0x64598BF0C559213FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x42B88B47B7F46143ULL,
+    0x7D3971200144CB7DULL, 0x0000000000000000ULL, 0x14F691F0FD1D0146ULL, 0x0310E269F403C147ULL,
+    0x0000000000000000ULL, 0x87D727C03302E149ULL, 0x6B6E7104214A689DULL, 0x0000000000000000ULL,
+    0xF2E11A04014C4EF0ULL, 0xF3A14204B6D7614DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1D569C8E292FC152ULL, 0xE6D46ED8202EA153ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1A35BE95E15B6324ULL,
+    0xA9BCE367C87CA15CULL, 0x4E5D58030BC9815DULL, 0x7C289F03C15EBE20ULL, 0x0000000000000000ULL,
+    0xA75C8E27D5BC8160ULL, 0xF9040B9C6B01E161ULL, 0x0000000000000000ULL, 0xB949DFC2EC7C0163ULL,
+    0x0000000000000000ULL, 0x76C59B24CD0F6165ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1448173F2864816AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1225791FA2D1616DULL, 0x7CA0335DB5C7A16EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xAEA54F62E172366CULL, 0x0000000000000000ULL,
+    0xB53F53F561743C64ULL, 0x112390F5E1757DB0ULL, 0xE3FC06109975A176ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x76448DA4217A1E89ULL, 0xECA03A5A6085017BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA20877EEC174217FULL,
+    0x0000000000000000ULL, 0x40B6B3662C132181ULL, 0xC9BCCC402C7AE182ULL, 0x0000000000000000ULL,
+    0x7DD1993621844E88ULL, 0x17F1F04AE185D119ULL, 0x0000000000000000ULL, 0x4D1EED979AF42187ULL,
+    0x075DEBB96BAD0188ULL, 0x2CFA0280F8C9A189ULL, 0x0000000000000000ULL, 0xA98B89AA2007E18BULL,
+    0xFBBC8FCDA18CDBE8ULL, 0xE71FC4D2C722E18DULL, 0xB928BA281D69418EULL, 0x0000000000000000ULL,
+    0x031B92DAE1901A96ULL, 0x0000000000000000ULL, 0x5C7B90966E170192ULL, 0x0000000000000000ULL,
+    0x5E9E70CAF08BE194ULL, 0xE0ED585CC4D32195ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD12C0E2415CEA198ULL, 0x0000000000000000ULL, 0xE79D78D20E58C19AULL, 0x756A0345419BE8B4ULL,
+    0x0000000000000000ULL, 0x990A20987113419DULL, 0x0000000000000000ULL, 0xDE91510A743F819FULL,
+    0x0000000000000000ULL, 0x8AACC473094281A1ULL, 0x608EF8B4EA2821A2ULL, 0x0D46824F01A31C97ULL,
+    0xCE8553A1E09501A4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD846A15517B5C1A7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xDBBD16E8E086C1AAULL, 0x3CF8C3B544ECA1ABULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFD0922362B3961B0ULL, 0x0000000000000000ULL, 0x0DA42D2F220F81B2ULL, 0xD8F2ED5C12C161B3ULL,
+    0x0000000000000000ULL, 0x39637B6EC1B5AFEEULL, 0x0EA7905AA27501B6ULL, 0x0000000000000000ULL,
+    0x6E21468F62CB01B8ULL, 0x4AB6BCD8F32601B9ULL, 0x0EF99A5EDE5021BAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0C9E291401BE0DD6ULL, 0x1367F3ABDBFEE1BFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5F3E7C4B01C3D23FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5C560BC0B106E1C7ULL,
+    0x12709C5F01C84218ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x55F6F60961CD18D4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE0DA5228B85B21D2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xDDA79B75F1B921D6ULL, 0x0000000000000000ULL,
+    0x47DB48391785E1D8ULL, 0x23E447A3F7E7A1D9ULL, 0x0C169B8A337F01DAULL, 0x0B9CFF50C1DB99CFULL,
+    0xD8663C7932A241DCULL, 0x8D2300F3C1DDFA30ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x51CB4CBA3A7481E0ULL, 0x5BB91997ACA761E1ULL, 0xE7BFF996D6D221E2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1FB72C41F5F041E6ULL, 0x6300827CC74241E7ULL,
+    0x88D4F2D979C0A1E8ULL, 0x0000000000000000ULL, 0x0BBF5049775D01EAULL, 0x8DD358A9078AA1EBULL,
+    0x4C4F53489167C1ECULL, 0xD189AB6C81ED741DULL, 0x0000000000000000ULL, 0x56669B7601EFB1E3ULL,
+    0x0000000000000000ULL, 0x29E37D30B55D81F1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3180B86C81F4E039ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x14C0938C3E2541F7ULL,
+    0xB776744CC25CC1F8ULL, 0xC767342C997FA1F9ULL, 0x022FF3E441FAEB4BULL, 0xFB58C6DC60C441FBULL,
+    0x48520409C413A1FCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x28809109D368C200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC46C5476343C2203ULL,
+    0x9E7E6346A2049D47ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x251E3A7F53FD4207ULL,
+    0xD6F4F4E9FBE38208ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3F599A244240220DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBDCE87CF2E3B6210ULL, 0x60A6FCCE28C04211ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB2688DDDFDE74217ULL,
+    0xB91F5B5CF9D06218ULL, 0xC6A46F797B432219ULL, 0x0000000000000000ULL, 0x94DEFAA1A21B0566ULL,
+    0x03970BC25566E21CULL, 0x32476643D421E21DULL, 0x41BD53D696EB221EULL, 0x0000000000000000ULL,
+    0xA52A9A0755578220ULL, 0xDA54103E149AA221ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB71DF8DD9CF70224ULL, 0x0000000000000000ULL, 0xE6826F84E7D50226ULL, 0xB9E554704035C227ULL,
+    0xCACB7E4EE228A52DULL, 0x8E8B5DBAA22988A4ULL, 0x13C7BDD43328822AULL, 0x7409B8B54C6A822BULL,
+    0xE1FDCAAD27E2422CULL, 0xA125AFDCBAF9822DULL, 0xDB947EFC279FA22EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x64D25970A235175FULL, 0xB4489FAF2236341EULL, 0x0000000000000000ULL,
+    0x2A7947B5A2388FFAULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x847B454B223DFDA5ULL, 0xCC02F8CEC23E3F65ULL, 0x38F77F1F5304023FULL,
+    0xFF4B98768C716240ULL, 0x0000000000000000ULL, 0x3B2E3BC2AD0C4242ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBDF7EBA80247A621ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x881C60153C2CC24DULL, 0x6288FB4BCA4CE24EULL, 0x588A483310ECA24FULL,
+    0x0000000000000000ULL, 0xD0ECFCEC225113A7ULL, 0x0000000000000000ULL, 0x50EC3E2E91FE0253ULL,
+    0x0000000000000000ULL, 0xE19D5527DAAAC255ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x8FEC3CD6C5F36259ULL, 0xFB82F1EF98C2625AULL, 0x0000000000000000ULL,
+    0x5BFD9E33825C259DULL, 0x60F20CDDC25D92C0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x343F80AEE1C50260ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFEDC9FCB99A84264ULL, 0xE47F4E124EE18265ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xEFC7C5914EA86276ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x8DBC3F9ED594C27AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6439EDC7A2FE227DULL, 0x83E70FC8D4F0427EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x78325DC030380281ULL, 0x23F87E04C6158282ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x787BC9F518290286ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xEDA34C374289D368ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x38D4B62D01B4C28EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x090E6B9D82912305ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x291FB64BEE6C2294ULL, 0x0000000000000000ULL, 0x010FFAC2BCFEA296ULL, 0x1177AC98FB388297ULL,
+    0x8452A3568638A298ULL, 0xDBCF06A7C1938299ULL, 0x0000000000000000ULL, 0x55CB9600DBC7E29BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE7B9B7CC33E7629FULL,
+    0x0000000000000000ULL, 0x0D9EE81DCE7EA2A1ULL, 0x69058EB9A2A2188DULL, 0x0000000000000000ULL,
+    0x8827E44A6B25A2A4ULL, 0xE5F6F184E2A5C3C5ULL, 0xB196CD8A742842A6ULL, 0x93C5AB10E2A7FBBAULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB789189742AADBB4ULL, 0x9CA9D311477F02ABULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xAC3E65A2A2AF881FULL,
+    0x35E3B40322B0888AULL, 0xD79DABCAEC9AA2B1ULL, 0xAAB3567CC361E2B2ULL, 0x79750CB3279762B3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3357B77158F5C2B9ULL, 0xE8D30CDFC22DA2BAULL, 0xB23689EC6B0BA2BBULL,
+    0x7A9B485322BC8FFAULL, 0xD1A50DA8D0DF82BDULL, 0xC67F2D2D33F7A2BEULL, 0x0000000000000000ULL,
+    0x610BC478A2C089B2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x9A01E8563E2A82C4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x8D7A17BEC76B02CAULL, 0x44E292A331CBC2CBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA9313CDD2FED22CFULL,
+    0x0000000000000000ULL, 0xFA2CDC3942D15B97ULL, 0xC352F2359B59C2D2ULL, 0x0000000000000000ULL,
+    0xCDB35CF12326A2D4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBF6BF212C2D7495BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1F0FA208E23FE2DAULL, 0x04C3D23DACF662DBULL,
+    0x9E74935222DCD843ULL, 0x0000000000000000ULL, 0xE704F63C327D22DEULL, 0x0000000000000000ULL,
+    0xA19E7E987F8422E0ULL, 0x0891C1C0743382E1ULL, 0xC78159C66287E2E2ULL, 0x5628386B02E3842FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x58E9EB2E0C1DE2E7ULL,
+    0xB297A72BB58822E8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x774635550B9402EBULL,
+    0x83167F55D13CA2ECULL, 0x0000000000000000ULL, 0x8BC80FE23BBAA2EEULL, 0x0000000000000000ULL,
+    0x397895D3D52B22F0ULL, 0x0000000000000000ULL, 0xF0FCF1A1DA7722F2ULL, 0x0000000000000000ULL,
+    0x988C18D3D0F662F4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x3F685D04091B82F7ULL,
+    0xF617DCD84820E2F8ULL, 0x7A6CB42F721D82F9ULL, 0x9423521DDB3B82FAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x33B573BA20E162FDULL, 0x0000000000000000ULL, 0xBF4B0BA6C796E2FFULL,
+    0x0000000000000000ULL, 0xB12F7D4D99CC0301ULL, 0x691DA6ED7D8B0302ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x8EB3157AF0A46305ULL, 0x2A7E48E3D7060306ULL, 0x79E1E15C86888307ULL,
+    0xA0D360251FF88308ULL, 0x2CDB30030309C80EULL, 0x27FE529BCDBB830AULL, 0x0A1F697C3100230BULL,
+    0x7C2EAB79CD24230CULL, 0x3C18D324CBC8030DULL, 0x47E28D8EE02D030EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x984744A1E3129A9AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3966C28883161BAEULL, 0x5DABBE0C82B1A317ULL,
+    0x0000000000000000ULL, 0xA01CCD74854EC319ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x5E38AEF4E31D5099ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6D7CDEBC554FE324ULL, 0x0000000000000000ULL, 0xCDCCD1F1F8284326ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x34415DA56C62E32BULL,
+    0x9B7AF1568035832CULL, 0x0000000000000000ULL, 0x91A183044D4C232EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x2C6E8FE676A10331ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x256CE6AD7D138334ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2721E7F73F1B0338ULL, 0x0000000000000000ULL, 0x4E4FF61944DD633AULL, 0x0000000000000000ULL,
+    0x4DE7295C833CAA16ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8CB05AB3C33F6765ULL,
+    0x51FA224B7DD70340ULL, 0x0000000000000000ULL, 0x9BA2F3AD894BC342ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x161818254BD48346ULL, 0xBBA0C1753C556347ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x25F55E620F52034EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x9C3BB1F684916354ULL, 0x0000000000000000ULL, 0x419CFAA4CEFF6356ULL, 0xD21B22EB177B2357ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0B621E83235D2D3EULL, 0x9B596B402AED235EULL, 0x0000000000000000ULL,
+    0x454B7C5726B7A360ULL, 0xC93014A01C8AC361ULL, 0x0000000000000000ULL, 0x949D73016897C363ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x00F0317D53C68366ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC02FB181A36CAC45ULL, 0x0000000000000000ULL, 0xFCA3FBB50CECE36EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9FDDCFA4EC614371ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6327B09B84954376ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA377E6B2B7D5E379ULL, 0x7F5D339AAAAD237AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1C8CF9D963816CAEULL, 0x0000000000000000ULL, 0xCF84E76FED9CA383ULL,
+    0x438B2563E384B167ULL, 0x7405BE0B238503FBULL, 0xBCDB95364386E80EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC0CC9FEC3466C38AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6DCE0F23638E2464ULL, 0xD93BDC3D638F795FULL,
+    0x0000000000000000ULL, 0x5AD3E6C9F013A391ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x341EC3A434CB6394ULL, 0x413CBEDAFEE8A395ULL, 0x6E03645F447DE396ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9051A062A406839AULL, 0x0000000000000000ULL,
+    0xEBC18AB8239C7769ULL, 0xA5C13564A6CE639DULL, 0x09FC3CFC1501639EULL, 0x85F010F856B1039FULL,
+    0xEAB59354B64A83A0ULL, 0x0000000000000000ULL, 0x29721E8D63A2E6C6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xC2AF2A3AE3A50319ULL, 0x793911D18689E3A6ULL, 0x8BABDF903D9343A7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x213E3B8A2FED63B0ULL, 0x1EC3BDC323B19D84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x93CACB0403B56FEEULL, 0x162440D88E26E3B6ULL, 0x32A7B6BAA4DA63B7ULL,
+    0x0000000000000000ULL, 0x16213AC303B978B8ULL, 0x330237B7EEA263BAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x94B4D211D63883BFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD5ED62CE02D623C5ULL, 0x0000000000000000ULL, 0x73E0AAEFC676E3C7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8AE9F19BA3CB8736ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBECD496BFAA3C3D0ULL, 0x303636895256C3D1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE96F5CB625B0E3D7ULL,
+    0xB0642CD983D8F6B1ULL, 0x39CDCC7F03D90733ULL, 0x0000000000000000ULL, 0x742F87C2BF2283DBULL,
+    0x30AF215B9A7B83DCULL, 0x0000000000000000ULL, 0x25462E0E1681C3DEULL, 0x481DD43583DF54F5ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x15EFD053C653C3E5ULL, 0x0000000000000000ULL, 0xC290DCCE177B03E7ULL,
+    0xA37C819D63E8A1D8ULL, 0x0000000000000000ULL, 0x3E1C216262EF63EAULL, 0x0000000000000000ULL,
+    0x8E1B851D93F7A3ECULL, 0xED58AA3843ED72CFULL, 0x349DA639490383EEULL, 0x0000000000000000ULL,
+    0xC22B62688838C3F0ULL, 0x0000000000000000ULL, 0xBC1B5EE32FD683F2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x444085F90E9B43F6ULL, 0x0000000000000000ULL,
+    0x62F0F4E3DE2083F8ULL, 0x7E7DDFE297EDC3F9ULL, 0xABED4B75B55863FAULL, 0x9841BB3AA3FBD58FULL,
+    0x0000000000000000ULL, 0xBD2C2B457459A3FDULL, 0x962A13562BC323FEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xAD2F118944023DDEULL, 0x0000000000000000ULL,
+    0x6BBBB38309AD4404ULL, 0xCF84CF509BD52405ULL, 0xCBD14C3AC4066D0FULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x230CA2AE4409F6CBULL, 0x0000000000000000ULL, 0xD4E0CCA28971E40BULL,
+    0x0000000000000000ULL, 0xBAA4CFCF6928840DULL, 0x564EE893508BE40EULL, 0x0000000000000000ULL,
+    0x1BA156E275406410ULL, 0x5742E8CE9C86A411ULL, 0x6737399824121332ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8300E363A418E652ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1AC5C35544204791ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0B1D745764235BE0ULL,
+    0xF005E039A8A86424ULL, 0x0000000000000000ULL, 0xEEDF888CB1A16426ULL, 0x74D930AA84278F78ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xDC2025BF042D358EULL, 0x0000000000000000ULL, 0x6655FDC9642FCE34ULL,
+    0xDC1758F64FE02430ULL, 0xA2236E4011FCA431ULL, 0x2EB0FA4F556BA432ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1D1F50FBC4357C75ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF3F08C39E4387714ULL, 0x0000000000000000ULL, 0x4B68A95F05FD443AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0A92828981DBA43FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x58033792250F6444ULL, 0x0000000000000000ULL, 0xD9A5858D64460342ULL, 0xB79152C710B60447ULL,
+    0x0000000000000000ULL, 0xEAD45BA98449A6C6ULL, 0xFCAB83704F31E44AULL, 0x0000000000000000ULL,
+    0x9D3E94017317244CULL, 0xF1CAA76CF789444DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB0AC9F7AD6D70456ULL, 0x37A38D62A1410457ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xEA9BD726445B6712ULL,
+    0x0000000000000000ULL, 0x540C45D83421245DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x233B18C769358460ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x03DFB8651CFDA464ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC175D9906174C467ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0423E6700902E46AULL, 0x0000000000000000ULL,
+    0x70D50DBDA46C3830ULL, 0x0000000000000000ULL, 0xFE9E15EEA46EE3DFULL, 0x0000000000000000ULL,
+    0x6777174124446470ULL, 0x9D0C1CE0C471F09CULL, 0x6AA42A79C75FA472ULL, 0xCCE1E44BB8E62473ULL,
+    0x1B5186D21EA8E474ULL, 0x0000000000000000ULL, 0x62D3AFAC16160476ULL, 0x6960801240F5E477ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x9A1EC9117FC6047CULL, 0x4BB6D3C03BCFC47DULL, 0x0000000000000000ULL, 0x987626B9247F3FF0ULL,
+    0x0000000000000000ULL, 0x39EAFE2A97482481ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4E54A6C88FE3A484ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x60EA266757A3C488ULL, 0xD7EDFB6F7B52A489ULL, 0x0000000000000000ULL, 0xB6E1976418CAA48BULL,
+    0x53694162126E448CULL, 0x0000000000000000ULL, 0xFA39A3A2C48E7CDBULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xF73F2028F1676492ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xF667390D84955FEDULL, 0x0000000000000000ULL, 0xC803740B2497FAD1ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x139A37588AD3649BULL,
+    0x0000000000000000ULL, 0x39A1828508D6449DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB19D69DF578D04A2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x5226D62EA52904A5ULL, 0xCFC3CE3424A6BD84ULL, 0x0000000000000000ULL,
+    0x08DADC3E34C6C4A8ULL, 0xDF17CB672872C4A9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xBD67761CE31A04AEULL, 0x0000000000000000ULL,
+    0xC4AE389DCCC3C4B0ULL, 0xC9BE8F487A9DA4B1ULL, 0x5174A33584B2CC23ULL, 0xA71C84C292E3E4B3ULL,
+    0x0000000000000000ULL, 0x28DA95CC961024B5ULL, 0x53DBA37169BC44B6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1F9C8E89E86DC4BAULL, 0x3A93B07A5B7924BBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xCE4AAE24B7A584BEULL, 0x0000000000000000ULL,
+    0xAE465D1C415AE4C0ULL, 0xEC6431F63BA5E4C1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA7B3C5DE994B64C7ULL,
+    0x0000000000000000ULL, 0x883C468F336084C9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xDBB6C146A80FA4CEULL, 0x534AE0B0BB9824CFULL,
+    0x0000000000000000ULL, 0x5213A599619064D1ULL, 0x06E5B044449CA4D2ULL, 0x5A0D295E84D3B822ULL,
+    0x0000000000000000ULL, 0x42697E18E4D51F16ULL, 0x04F81AD7FA5864D6ULL, 0x8F795F6CB4A404D7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6E247913E45544DAULL, 0x0000000000000000ULL,
+    0x5228A0C4D02E84DCULL, 0x25EF428384DD80EEULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC7FFA4BBC5AD64E4ULL, 0xA1170726B01204E5ULL, 0x0B6905B46C3BA4E6ULL, 0x27D20A23E4E78AEBULL,
+    0x20AFD5664281C4E8ULL, 0x74A2E1B0AFF984E9ULL, 0x01B2878D3BFEE4EAULL, 0x0000000000000000ULL,
+    0xBD79F1E1B9A5E4ECULL, 0xE40FF0B4614424EDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x064A1C80D5BD64F0ULL, 0x55276F073E1944F1ULL, 0x0000000000000000ULL, 0x5BDE0B73259844F3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2E1B05D218F0C4F7ULL,
+    0x74F5CAFD7DEDE4F8ULL, 0x0000000000000000ULL, 0x962B6C2366AA44FAULL, 0x0000000000000000ULL,
+    0x3F3CBD020262A4FCULL, 0x4C68F47C0833A4FDULL, 0x51E516C3ACE7E4FEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBE4314175C678501ULL, 0x0000000000000000ULL, 0x1D99380F4503A672ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7A82F27C3CF86506ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9BB3401B463CE50DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC6F67673570E8513ULL,
+    0x0000000000000000ULL, 0x8792DA71E4C6A515ULL, 0xBC5349F2C516DE66ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD91A25D1F532E519ULL, 0xE154E2A2F3A7251AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x57FA21693AEC451DULL, 0x3A933A2FB32D251EULL, 0xCFE6A103451F4748ULL,
+    0xB173BE4EFDBE8520ULL, 0x46751540BB888521ULL, 0x068B6DA0052248C3ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x24D2E65A73990526ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x214F3DD5E52954D8ULL, 0x0000000000000000ULL, 0x51112AC12E54C52BULL,
+    0xA9444E83E52C566AULL, 0xB52C7D15852D3473ULL, 0x0000000000000000ULL, 0x9A0EF564010DA52FULL,
+    0x0000000000000000ULL, 0x667F05B99BC5E531ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF1B995F5713A6534ULL, 0xCB748BBF83DEA535ULL, 0x0000000000000000ULL, 0xB58C712687EEA537ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x226765535698C53AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x109CB5A6CF6B853DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB7F94D9658648541ULL, 0x0000000000000000ULL, 0x4039B863D0478543ULL,
+    0x6A17FCF59E87C544ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9EAA2A0CF083A54AULL, 0x0DA6791CC54B2957ULL,
+    0x0000000000000000ULL, 0xA9B8DE003C7EA54DULL, 0x899452A45CD0054EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x57D17E238A2C0555ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC20F820DE4BE4558ULL, 0x7426675A8D750559ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6D191F333840C55CULL, 0x0000000000000000ULL, 0x9E7478087474255EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x822E2ACE79DE0561ULL, 0x7EE5DB84A5620E5AULL, 0x0000000000000000ULL,
+    0xFF92F671988B2564ULL, 0x0000000000000000ULL, 0x0B0856DCE688E566ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE80462D06572A40BULL, 0x2E9CD3E4F5D18573ULL,
+    0xA02E4AD12574DD3AULL, 0x0000000000000000ULL, 0x0AE9310C5A194576ULL, 0x926F6FA5C5773B10ULL,
+    0x0000000000000000ULL, 0xB4A6C5F36579EF46ULL, 0x5C67978778B6E57AULL, 0x0000000000000000ULL,
+    0xA12C5D9FAEBF657CULL, 0x0000000000000000ULL, 0x9B657E734CF5057EULL, 0x17B764CE861F257FULL,
+    0xCB55267FEC358580ULL, 0x0000000000000000ULL, 0xBABD3F9886ECA582ULL, 0xC362E38DB043E583ULL,
+    0x0000000000000000ULL, 0xD6831921105A4585ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF8C3666A75D56588ULL, 0x116C96C026212589ULL, 0x86F879B2BB79258AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9828B493829A658EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x5C2E0C3F4E9E6592ULL, 0x41F66B796817E593ULL,
+    0x0000000000000000ULL, 0xA4E24B6F2AC88595ULL, 0xDA80D766A3F38596ULL, 0x61E1E34C390EA597ULL,
+    0x7F427F6EA5982F63ULL, 0xDAB1F35FB7140599ULL, 0x0000000000000000ULL, 0x099E00DF42D1A59BULL,
+    0x0000000000000000ULL, 0x3D49F672D4F6E59DULL, 0x0000000000000000ULL, 0x68DE9E10576F459FULL,
+    0x0000000000000000ULL, 0x7E5BB721D30785A1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF437E6472C63C5A4ULL, 0x0000000000000000ULL, 0x455A333C7A9305A6ULL, 0x51B784A125A71BD5ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x40DD99AECD30A5AAULL, 0x09B4D0D025AB9524ULL,
+    0xEFA3A9AE154A85ACULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x20C115356858A5B0ULL, 0x30A5C8E7A5B10E21ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB2D41CDCE44BE5B5ULL, 0x0AA96E39761D05B6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x5DCAB7E75AB3E5B9ULL, 0xCB7B4B6093E8A5BAULL, 0x0000000000000000ULL,
+    0xD28F3573DC57A5BCULL, 0xB22BFC821A7865BDULL, 0x0000000000000000ULL, 0x86BD7DBDCE3D85BFULL,
+    0x0000000000000000ULL, 0x65622DB741DE85C1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFE4007139EC8E5C4ULL, 0x41085BBA05C55570ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF3C568C3E26A65C8ULL, 0xD110DC4445C9B0FDULL, 0xE24FB1E0E89DA5CAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE410D77258F785CDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC8314127DBEE85D0ULL, 0x5668E9AB65D192C1ULL, 0x5D183F87377965D2ULL, 0x854F3B5C653D65D3ULL,
+    0x0000000000000000ULL, 0x3BC4C18AC5D57839ULL, 0x0000000000000000ULL, 0x49121D3695CDA5D7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4C4AC59DEA8F25DBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x40FCE30405DE530FULL, 0x0000000000000000ULL,
+    0xBFB18F27A47045E0ULL, 0x0000000000000000ULL, 0x0219189B65E24D97ULL, 0x0000000000000000ULL,
+    0xAF91AA3265E4F238ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5223682BAFB905E7ULL,
+    0x0000000000000000ULL, 0xEAA52F3AFA4D85E9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA24ACA4DEAD9C5F1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6DCCF620232565F4ULL, 0xFD6F8EE63724E5F5ULL, 0xD8F8C30FA72685F6ULL, 0x87BEE5614C4A05F7ULL,
+    0x0000000000000000ULL, 0x4DC1D04500C985F9ULL, 0xED1E63DB3A5AA5FAULL, 0x43FB268565FB3FE1ULL,
+    0xE7CCFC8ABD0105FCULL, 0x4F28D72A0D5C25FDULL, 0x0000000000000000ULL, 0x68F9827EED2605FFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4CDE157F39C7A602ULL, 0x02E09ABB2F2A0603ULL,
+    0x3394416146041E03ULL, 0x0000000000000000ULL, 0x56A9A43F66069915ULL, 0x92677AFF95150607ULL,
+    0x44B20783E6085F66ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x8F59E34BC60D3C72ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x63228F07020B0614ULL, 0x0000000000000000ULL, 0xFE8DC957D5DA6616ULL, 0x0000000000000000ULL,
+    0x2F1E305D2618842FULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1C13B588D6EA861BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5DCFA2A9302FC61FULL,
+    0x0000000000000000ULL, 0xC8D5E48DB316A621ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x54C8FD82098FA624ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC50FF8BCC6277368ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9FA812BC462A40D0ULL, 0x5E9BE8B5E894062BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB58706BD5CAF862EULL, 0x0000000000000000ULL,
+    0x5F0DF3AB24088630ULL, 0x0ABF890B06184631ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1A68A3CEC7E42635ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCFC3F07E3CD90638ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD0A8C48DCCB7663CULL, 0x0000000000000000ULL, 0x9CD8CE74863E91BFULL, 0x063772B4EB69C63FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA4CD969066439CD9ULL,
+    0xBFA8E977F6C0C644ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFFC0ECB7798E8648ULL, 0x0000000000000000ULL, 0x4E889ABDF9A3A64AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCD1E135AB709C650ULL, 0x5E52A4FD7304C651ULL, 0x640879113D45A652ULL, 0x0000000000000000ULL,
+    0x8A8B3FEE41A64654ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8FC331ED1E26865CULL, 0x0000000000000000ULL, 0x8707BCD0CD35865EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD08EC0B49EA92662ULL, 0xF1A9754F74D76663ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xAE51663E84D02668ULL, 0x0000000000000000ULL, 0x890BD5A1C4BB666AULL, 0x139E79CB35C6466BULL,
+    0xB944A71E7136E66CULL, 0x9BF5DBD1666DD396ULL, 0x7F5EBBB11FFF266EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x274DA6067E87E671ULL, 0x2262B9DD084C2672ULL, 0x695559061A512673ULL,
+    0x0000000000000000ULL, 0x47EB608A41D32675ULL, 0xF4FA280367714676ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA8BFC1BE559F267BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x33CB10FEA7056682ULL, 0x469BAC06E6838495ULL,
+    0xE514CA73668448B4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6BCB3DF3E12B668BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xCDA9CF4C868FE916ULL,
+    0x37EAC7DFA924C690ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x458B1C539DFCA699ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBFB2AC268DEA669CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x92F12167559026A4ULL, 0xD28A58D2A92BC6A5ULL, 0x0000000000000000ULL, 0xD66EEEC546A7F690ULL,
+    0x0000000000000000ULL, 0xE068769EC6A93F03ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x66A1AABA98D226AEULL, 0x34C04D8686AFA092ULL,
+    0x07399D725B1CE6B0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE96A632AA32EA6B5ULL, 0x0000000000000000ULL, 0x3DB3902C205266B7ULL,
+    0xF89A72FD892FE6B8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x624A4857E51AA6BCULL, 0xE170AF1326BDE753ULL, 0x386B2A03577AC6BEULL, 0x0000000000000000ULL,
+    0xAA951D43A02BC6C0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB8E6FF1A06C6C2AAULL, 0x0000000000000000ULL,
+    0xC29BBD4646C8DC3BULL, 0x0000000000000000ULL, 0xEDA961A1867CE6CAULL, 0x31848719A6CBCFECULL,
+    0x0C8F2846D035C6CCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x721E207506D07CFAULL, 0x4ACE2A2B06D17DADULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1D091228BE8606D4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x676CC56153D766D7ULL,
+    0x0000000000000000ULL, 0x133191B746D91B8DULL, 0x0000000000000000ULL, 0xD7F353D1D3EC46DBULL,
+    0x620D30108F0D06DCULL, 0x18D38FC11991E6DDULL, 0x0000000000000000ULL, 0xFA91C68006DF701CULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x290412F052CF06E2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3AE03465CDB566E5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xFBD1602A8CFFC6E9ULL, 0x0000000000000000ULL, 0xD1F1661AA6EB66FCULL,
+    0x5FCCC3EFC6EC2DBFULL, 0xC47252A586ED73CAULL, 0x730DFDC5C213C6EEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7E241A94DB9C86F2ULL, 0x77C0E0D321A866F3ULL,
+    0x0000000000000000ULL, 0x517FA3AC0918A6F5ULL, 0x0000000000000000ULL, 0x75F458BCE6F74076ULL,
+    0x0000000000000000ULL, 0x4D6B90A1A6F9ABE6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA216723905BBE6FCULL, 0x0000000000000000ULL, 0xDB71E6BCBA3866FEULL, 0x129108BE600106FFULL,
+    0x0000000000000000ULL, 0xA5F47D5E36590701ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xDA7357DD9D9BC705ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xDF7D5D3DC709639CULL, 0x382D78F4DB72470AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB307C5FD3EA7270DULL, 0xCDBC489FD056A70EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4A1E0755B1554712ULL, 0x8E07B3E39DA38713ULL,
+    0x0000000000000000ULL, 0x0F8C1C76E6A0A715ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xDE83B1F2E99F4719ULL, 0x051023A0AA74271AULL, 0x1AFD9C4B6AD4871BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x5B195B7C4036E721ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xDA30E6C2BF816724ULL, 0x0000000000000000ULL, 0xC06376CF3BB98726ULL, 0x0000000000000000ULL,
+    0xCE86E84DE2B0E728ULL, 0x5C194CE829A26729ULL, 0xCD895C018C9A472AULL, 0x3087E5B0072B4F4CULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xF33F04EBE72E5339ULL, 0x5EB3E984A0D9A72FULL,
+    0xA590B43ADC0EA730ULL, 0x7D21371C3997A731ULL, 0x0000000000000000ULL, 0x4D9D44D05F586733ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2B5015D7B8798736ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB999E58467402A6BULL, 0x0000000000000000ULL, 0xC1C9927FA742889DULL, 0x0000000000000000ULL,
+    0x90E5ADCE70368744ULL, 0x146E2400E8E06745ULL, 0x0000000000000000ULL, 0x50DBF96117366747ULL,
+    0x798C04CA9B5EE748ULL, 0x65C0E24BE749E8DEULL, 0x0000000000000000ULL, 0x0D5433B0A74B7439ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x551454667779A74EULL, 0x0000000000000000ULL,
+    0x6F54A28BA7FB8750ULL, 0x0000000000000000ULL, 0x51551B1D92E82752ULL, 0xE284ACEE6753A8F5ULL,
+    0x5F3B0804475473EBULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xEAA2AF9268E20759ULL, 0x88237E1646FF475AULL, 0x0000000000000000ULL,
+    0x75A610C8475CC503ULL, 0x7B4BDEA470F1475DULL, 0x59B97E7A875E66DFULL, 0x43E86F020012C75FULL,
+    0x3C88694CFEFBA760ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x29BEF025E9210765ULL, 0xD66D6A05B6B1C766ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1A7AFE95EF386769ULL, 0x0000000000000000ULL, 0x4103D2EC8F36A76BULL,
+    0xD83EBD825884276CULL, 0x4D9EA0C1876D2537ULL, 0x0000000000000000ULL, 0x225A29D4876F0019ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1630F25AB1B98772ULL, 0x49C8815F4E9D4773ULL,
+    0xB3D8C731BE164774ULL, 0x6321B71DB4056775ULL, 0x0000000000000000ULL, 0x99D79EAE59C90777ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF35A7E4299A4677BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1475F73691D5C77EULL, 0x7A0C22201826077FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0B37D00AD7B46788ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB0B5BFAE87912460ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE5EC32A8E7958D63ULL, 0x6E7EFDB042690796ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x72B3761EBA22879BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0B8D363EE752679EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2C5877A907A3BF6EULL,
+    0x0000000000000000ULL, 0xE49D9FDFA9D9C7A5ULL, 0x0000000000000000ULL, 0x1BA3FA5427A7FFF0ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x366F366DBDDFC7ABULL,
+    0x0000000000000000ULL, 0xA9340341A97367ADULL, 0x0000000000000000ULL, 0x5E686577E85C47AFULL,
+    0x91125915FA5CC7B0ULL, 0xF7888D0E818F47B1ULL, 0x5E69AA02448BA7B2ULL, 0xC350BB1E6567E7B3ULL,
+    0xF069F502DFB007B4ULL, 0x9B9209ED3818C7B5ULL, 0x0365CABC0E7567B6ULL, 0x2CBCF31D08BF47B7ULL,
+    0x4E1E0A9A3D7527B8ULL, 0x0000000000000000ULL, 0xBABCA16787BA6614ULL, 0x29966655684F27BBULL,
+    0x0000000000000000ULL, 0x84002633C8A247BDULL, 0x0000000000000000ULL, 0xD1CDBD4F4902E7BFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x4083B402C44707C5ULL, 0x0000000000000000ULL, 0x2A24BEFAB7B047C7ULL,
+    0x40484F2CF93FC7C8ULL, 0x0000000000000000ULL, 0xA8D38A33E7CA4294ULL, 0x6F89AEA6CAC3E7CBULL,
+    0xCE48CAFE07CCB854ULL, 0x47D434873C2CC7CDULL, 0xCC92536387CE5A1EULL, 0x37A05E0A2D8AC7CFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE832DD7C91ADE7D5ULL, 0x12F560B2921C07D6ULL, 0x0000000000000000ULL,
+    0xF84C9962534347D8ULL, 0x0000000000000000ULL, 0xFD421E3767DA7BA6ULL, 0x0000000000000000ULL,
+    0x6C6D2F9E0BE807DCULL, 0xCBF08067B150C7DDULL, 0x174EB6807BAB87DEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE88308C0312387E2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x5E1B3E9BE5DAC7E6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x20CB0EB9777AC7ECULL, 0xF3D58491E7ED0DEFULL, 0xB646F585B0F447EEULL, 0x9DE7FAFE62B587EFULL,
+    0x0000000000000000ULL, 0xA08FA53C220867F1ULL, 0x0000000000000000ULL, 0x8AF791E3878E27F3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5ED4D41B887607F7ULL,
+    0x1EFA8D19F65907F8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1555FC483CD207FCULL, 0x012353B927FDE6FFULL, 0x0000000000000000ULL, 0xFB797F7ED7F3A7FFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x8A825186D69EC80AULL, 0x0000000000000000ULL,
+    0xE397EFC378DF280CULL, 0x0000000000000000ULL, 0x5E3974B0E80EDED4ULL, 0x2FDE511DF91EC80FULL,
+    0x0000000000000000ULL, 0xF08428DBF1F30811ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB69535B733352814ULL, 0xDCD759F1727E4815ULL, 0x0000000000000000ULL, 0x91884C8A93260817ULL,
+    0x0000000000000000ULL, 0x41C7A8099CEB8819ULL, 0x8A559F4517F3E81AULL, 0x646EAF77592B881BULL,
+    0x2889B154A57E681CULL, 0x0000000000000000ULL, 0x09B960675C3AE81EULL, 0xB1ED2DEF14B1C81FULL,
+    0xDB7C17844820C7C5ULL, 0x888CBCA0973B0821ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1A78E7C2A825ECB1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA19B705073CFE82BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x88ED0A3C8831A8EFULL, 0x0000000000000000ULL, 0x90D345EA141DE833ULL,
+    0x0000000000000000ULL, 0xA92354F08835D461ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4BA6983EE4B84838ULL, 0x0000000000000000ULL, 0x113417557EA2283AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD89BDFEA4EB02840ULL, 0x495C57AB55EA8841ULL, 0x976DA7D988428030ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x4230CC21C838C845ULL, 0x3CE6C159A8462147ULL, 0x6D36342EAEA96847ULL,
+    0x6BC58CFCF19A8848ULL, 0xE716B84745BA4849ULL, 0x0000000000000000ULL, 0xE38BBEE25070684BULL,
+    0xF4E13FBB484C3424ULL, 0x0000000000000000ULL, 0xFCD6BE30AC3F684EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xC3F85C470449E851ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4E941D9268256857ULL,
+    0x0000000000000000ULL, 0x3BFF2C63E8595B56ULL, 0x0000000000000000ULL, 0x1849B8F9E89E685BULL,
+    0x0000000000000000ULL, 0x44863C91685DA3DEULL, 0x1F8EADFD8C72485EULL, 0x0000000000000000ULL,
+    0x32B18AE88A144860ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x514F124972BF8865ULL, 0xF3F0599900E94866ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0F40E261174B086AULL, 0x928D2472486BC8A4ULL,
+    0xF7DB23B5354F686CULL, 0x403139E6DF28E86DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6DD075C71420C870ULL, 0x0000000000000000ULL, 0x4BBC755AD17E6872ULL, 0x0000000000000000ULL,
+    0xF8D83F31A8746B8BULL, 0x0000000000000000ULL, 0x4140566AAD09A876ULL, 0x0000000000000000ULL,
+    0x55FAABEB8901A878ULL, 0xB25D6017EE1BC879ULL, 0x0000000000000000ULL, 0xD9C11DCCE87B9C9DULL,
+    0x0D501ECA1584487CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x213193A18882BC39ULL, 0x4BC4A77FA9538883ULL,
+    0xA66647FDF2006884ULL, 0x72D5BBA29ED20885ULL, 0xC10F2465F7656886ULL, 0x0000000000000000ULL,
+    0xD66D9DF704FAC888ULL, 0xAA2EA546BE734889ULL, 0xC1335FCD888A5BFFULL, 0x0000000000000000ULL,
+    0x900128C55C8DE88CULL, 0x0000000000000000ULL, 0x9668CFB0EAB5888EULL, 0xD613DC5FDF14E88FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA2BF41F6F6850892ULL, 0x0000000000000000ULL,
+    0x4B7F19D936104894ULL, 0x0000000000000000ULL, 0x22968F3047982896ULL, 0xA54412B9F4842897ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCED2C716D3A7689DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8A81230608A0525FULL, 0x5257677AF8F788A1ULL, 0xFBED58B9C8A2DE8BULL, 0x0000000000000000ULL,
+    0xA9B87D93760E88A4ULL, 0xB8D565E0C5B168A5ULL, 0xE02E9E7CD36308A6ULL, 0x0000000000000000ULL,
+    0x58A2177A48A88489ULL, 0x4F975F36F228A8A9ULL, 0x0E9DF2CBC6DAC8AAULL, 0x05861EBE48AB42F9ULL,
+    0x0000000000000000ULL, 0xBC7FE0C34F0BC8ADULL, 0xCA2C2B8B4D7AC8AEULL, 0x788E7D486CD848AFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x53A4FBA3993208B3ULL,
+    0xA50380E40B0048B4ULL, 0xF70B36B928B50A85ULL, 0x47FCB026A6BE68B6ULL, 0x074E1DDBBF5708B7ULL,
+    0x9B4044FC867068B8ULL, 0x6B232661D2AF08B9ULL, 0x0000000000000000ULL, 0xAD9AE25F833B68BBULL,
+    0x995EBA5AF45848BCULL, 0xE85971C908BD58A0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2A7A96BE0641A8C3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x55EF5F13C57A28CAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xFB4E3375D69C08CEULL, 0x57044101A84C28CFULL,
+    0xDD44912EA8D0FA9CULL, 0x0000000000000000ULL, 0x215853FECCAD88D2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBB59CFF38DEE48D7ULL,
+    0xA62F5AB108D881A4ULL, 0xE516101BD750E8D9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x54D0CB799383A8DEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x887099DC4D9288E3ULL,
+    0xBCA12D82C8E4EF5AULL, 0xBCF66C1B812508E5ULL, 0xE3910E49C7F508E6ULL, 0x14C616EBA3E628E7ULL,
+    0xAFEC3FA383BF28E8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBC8A32FB77E588ECULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF2661DA7883F88EFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x15358A3F9F0D08F2ULL, 0x6CC6174847E3C8F3ULL,
+    0x0000000000000000ULL, 0x06470A692FABE8F5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6125D756FB5168F8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x83E090661F5D28FBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xF5B291C73FD768FEULL, 0x5F2A4D1F04FA48FFULL,
+    0x0000000000000000ULL, 0x26DFC66828B9C901ULL, 0xCB8785FC78438902ULL, 0x6073446ABAFDA903ULL,
+    0x05467F2FDA9F0904ULL, 0x0000000000000000ULL, 0xA323AE9A8029E906ULL, 0x0000000000000000ULL,
+    0x2BA847A68908C947ULL, 0x0000000000000000ULL, 0x29EBEBEFD117890AULL, 0xAF56B94077CEA90BULL,
+    0x9C4B03C5490CB887ULL, 0x80135FA9A90D151EULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x96853DA2707B0912ULL, 0xA0EA67654913292CULL,
+    0xC5EFC4385AAB2914ULL, 0x0000000000000000ULL, 0x7FC9D833CBE06916ULL, 0x445E62795BE30917ULL,
+    0x0000000000000000ULL, 0xBAE88D15A6CA4919ULL, 0x74E36F07FDF9A91AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9F827A378921B3D9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x65B70640A924A143ULL, 0x844FC272DF70C925ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0F9220FA6604492BULL,
+    0x884E9ECB6449292CULL, 0x840D0BC49F10C92DULL, 0xB35EB6FFD642492EULL, 0x24DC0663B6BF892FULL,
+    0x133FC450AEBA8930ULL, 0x45C61E2A78CF8931ULL, 0x6794BC959F502932ULL, 0x9E04F8CB87BC6933ULL,
+    0x0000000000000000ULL, 0xA8810B217DD3E935ULL, 0x4BFDEDA0EC03A936ULL, 0xE020033869378F95ULL,
+    0xB632576D29380AA0ULL, 0x0000000000000000ULL, 0xB042E0AFB14FE93AULL, 0x054F1413B234893BULL,
+    0x0000000000000000ULL, 0xBAE3B81BE1C1693DULL, 0x06A204E79808C93EULL, 0xD50DCF55A1BE093FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7689D0D4E9426F5FULL, 0x0000000000000000ULL,
+    0xD72319756462C944ULL, 0xC35C9EE110DA0945ULL, 0x0000000000000000ULL, 0xD3972D9873E74947ULL,
+    0x11D0A79FBC30C948ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x096357B595B2094BULL,
+    0x6F4F83409DA0494CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8CA14C9DA76F2950ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x583B9ECC1C1A0954ULL, 0xAF1FDE2F09555340ULL, 0x57978BBA14BBC956ULL, 0xA8535D9D778FC957ULL,
+    0x5D7AED9E067D8958ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF9616D2C895BA464ULL,
+    0xD974D10F7D74E95CULL, 0x6BC748BC295D6FD3ULL, 0x0000000000000000ULL, 0xA1ECCEA9895F05CAULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE6593DC40E2BC963ULL,
+    0x0000000000000000ULL, 0x75DD8B55140B6965ULL, 0x5CA24ADEBD702966ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xDE4E94A2D73B8969ULL, 0xAA791E7DC96AEEF9ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0E6FA28AA1A8A96EULL, 0x650AC870EBD6696FULL,
+    0x53FBB6DDA97065D2ULL, 0xFB68F6619BF18971ULL, 0x0000000000000000ULL, 0xC78C9A8E0973D0C3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x921A5148F4E66978ULL, 0x1C3CE07B497967B5ULL, 0x9A1A5834297ABF59ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE46BF29CEE26E97DULL, 0x8F18E7E1A97E3290ULL, 0xD3A093EEE97F1E92ULL,
+    0xE57AD94939BEE980ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB3E134700987E357ULL,
+    0xC59E8B27FE53C988ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCB0467CD2CFC498DULL, 0x787E995C59AE898EULL, 0xEE55320DA29CE98FULL,
+    0x0000000000000000ULL, 0x1B392483C991893FULL, 0x402F4D31E0094992ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x689DE162EC5CE996ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x06E632E51174A999ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA3171E79A522699EULL, 0xA68C83B8499F0E9CULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6F88B9A76B4449A9ULL, 0x0000000000000000ULL, 0x041855CF69ABD818ULL,
+    0x0000000000000000ULL, 0xF1CF945E7832E9ADULL, 0x257AD9346A8749AEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xCEEB572249B2F82FULL, 0x9C72D6F9AE15A9B3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4F9C0DE6E9B74346ULL,
+    0x21647C513D8689B8ULL, 0x9FFB7C8EC9B978B7ULL, 0xE1463CC19C7CA9BAULL, 0x5C1CCE197DBC09BBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC2E94FD14685C9C0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x88023A0749C5E04AULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x115175A9C9C83578ULL, 0x3472488BE9C98E54ULL, 0x0000000000000000ULL, 0x986069FB049A89CBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x5507BE8F09CEC6AFULL, 0x0000000000000000ULL,
+    0x370A1EEE8BBAE9D0ULL, 0x78F6F7F4465449D1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD3E3ADCE414349D4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0F4BDF1C2C23A9D7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x132DDC05F2F509DAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x2520E3B909DD8181ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB4693904643889E1ULL, 0x5662282416E429E2ULL, 0x08B8016169E36E7AULL,
+    0x0000000000000000ULL, 0x1043E6B232FA89E5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCC6C2F47CB00A9E8ULL, 0x0000000000000000ULL, 0x2121426671A7A9EAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD647807D69EE1082ULL, 0x0000000000000000ULL,
+    0xD8DF2209ABBC49F0ULL, 0x0000000000000000ULL, 0x785B5C00833AE9F2ULL, 0xC42AA60BA9F311C1ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE0742C559E77C9F6ULL, 0x32CA5FF8191369F7ULL,
+    0x0000000000000000ULL, 0xC066DFC089F95C22ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x00BBF2A8A9FC12B2ULL, 0xD1A65CE5F3C0C9FDULL, 0x0000000000000000ULL, 0x495D851769FFE324ULL,
+    0x634963DFB451AA00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2E7BC6EB0E470A03ULL,
+    0x0000000000000000ULL, 0x359F3BF0FE566A05ULL, 0x0000000000000000ULL, 0x28D565A93FAD8A07ULL,
+    0x0000000000000000ULL, 0x66A79A4CD0C2EA09ULL, 0x23C6A85B06BB2A0AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x89789E196848AA0DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3272E5DC097FCA10ULL, 0x0000000000000000ULL, 0x10378D7083604A12ULL, 0x8CE925F40A131C7DULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x722435499FD3AA16ULL, 0x91F4CB2671E08A17ULL,
+    0xE9EF3794AEB52A18ULL, 0x12FCDA703C222A19ULL, 0x0000000000000000ULL, 0x90094DA09ADE6A1BULL,
+    0xBBD62075F0CBCA1CULL, 0x0000000000000000ULL, 0x614EBFC3211E6A1EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD1B2F869EA225E0DULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xCF3300D5FA30AA27ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xAF6CDE44F7C2EA2AULL, 0x6474F7AB4978EA2BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x020C55362FFE6A2FULL,
+    0x9C4CD27324C12A30ULL, 0x0000000000000000ULL, 0x98983188BE6C8A32ULL, 0xBA411E3977304A33ULL,
+    0x5A16F0C5AA34CCC5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x31EF247288622A38ULL, 0x0000000000000000ULL, 0x8BBA51662A3A4E64ULL, 0x722AF6F4B312AA3BULL,
+    0xE89D05798A3C872BULL, 0xC270464E6820AA3DULL, 0x0000000000000000ULL, 0x770C78AF49BBAA3FULL,
+    0x0000000000000000ULL, 0xDB015C7A059A4A41ULL, 0x02F6965973852A42ULL, 0x0000000000000000ULL,
+    0x61BB28352A44F796ULL, 0x90E067D2F8194A45ULL, 0x0000000000000000ULL, 0x8611693E8A471175ULL,
+    0x9F242C842A48672AULL, 0xD8D9F9E645340A49ULL, 0x0000000000000000ULL, 0xB1789B2C8D1FCA4BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD95BE123389A8A4FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x839D3B9773A96A54ULL, 0xC5A93CC096E1AA55ULL, 0x0000000000000000ULL, 0x6BE02338ECF2EA57ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x486748C26A5A315CULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB02A81EE0A5D9947ULL, 0xD57803560C2A4A5EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x809C3D003B6FCA62ULL, 0x0207BA88A2980A63ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7F127E35CA66712AULL, 0x0000000000000000ULL,
+    0x3DC797D40AC58A68ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8760E613EA6BBA9EULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA08491D1C5ADAA71ULL, 0xE361A7F28A727569ULL, 0xA09ADFF32A739F2AULL,
+    0xC419A30F466F4A74ULL, 0xA6433C144A6C4A75ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x50F7397E0C528A78ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE6E4AB635F67CA7BULL,
+    0xE4CCC10AB9856A7CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC17C47496A7FA229ULL,
+    0x9C3960FC691BAA80ULL, 0x0000000000000000ULL, 0x88306906CA828AE2ULL, 0x0000000000000000ULL,
+    0x6A2074F3FC800A84ULL, 0xDA96ABC347F36A85ULL, 0x3232580F17BDEA86ULL, 0xF43128FB78D62A87ULL,
+    0x0000000000000000ULL, 0x84D71188503E4A89ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x08C34FF14A92D959ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x81CAC90204D4EA96ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1FE0AFCE0A99825CULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6A3E6A0771428A9CULL, 0x0000000000000000ULL, 0x63EE6419779A0A9EULL, 0xDA24C1B354026A9FULL,
+    0x7B6A56E4D3AE8AA0ULL, 0x0000000000000000ULL, 0x5883253CAAA29734ULL, 0x0000000000000000ULL,
+    0x8A19C036EAA45BA6ULL, 0x0000000000000000ULL, 0xEDAE571CDF50CAA6ULL, 0x1E79D4719F39EAA7ULL,
+    0x0000000000000000ULL, 0x86B316931799AAA9ULL, 0xC69BC2BE50608AAAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA3424FEA6DEF0AAFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3DE2CEA498FD2AB2ULL, 0x559B64A3C45D0AB3ULL,
+    0x86ED70819DA52AB4ULL, 0x0000000000000000ULL, 0x24713A604AB6E631ULL, 0x0000000000000000ULL,
+    0x0F12069E8AB87570ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBCE37908DB15CABDULL, 0x518987CA9C58EABEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5BD65F520831EAC3ULL,
+    0xD6C36E33E3002AC4ULL, 0xB881782FA88C6AC5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xFC8221AEAA53EAC9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9E4E6AA599EEAACDULL, 0x0000000000000000ULL, 0xC01565F1B03DEACFULL,
+    0xC2BF892C9C0ACAD0ULL, 0x0000000000000000ULL, 0x3F0DDB8BEA886AD2ULL, 0x0000000000000000ULL,
+    0x5B6DE1F497722AD4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4ECBAB4C825ACAD7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x607E51966FFEAADAULL, 0xB0EB1EC12ADB2AA0ULL,
+    0x0000000000000000ULL, 0x16D8C54B6FC36ADDULL, 0x0000000000000000ULL, 0x1CE750344ADFC614ULL,
+    0x3337A228B4874AE0ULL, 0x0000000000000000ULL, 0x61D77758549A2AE2ULL, 0x787F9B4C4AE30C56ULL,
+    0x805374C6CAE4DFE2ULL, 0xDD0A7925EAE5DF5CULL, 0x0000000000000000ULL, 0x7EEC6B37E281AAE7ULL,
+    0x0000000000000000ULL, 0x7FF62E1A5FDCAAE9ULL, 0x0000000000000000ULL, 0xCE13EE2B6BA90AEBULL,
+    0x7F3348F7AD854AECULL, 0x7A6962EE0DB3EAEDULL, 0x0000000000000000ULL, 0x7236E31F0AEF5FC3ULL,
+    0xCA1A6DA65A06EAF0ULL, 0xA1ECF7BC00A60AF1ULL, 0x204AD8194AF2AC45ULL, 0x8845AF4C8113AAF3ULL,
+    0x437C6B3BCAF45892ULL, 0x0000000000000000ULL, 0x9410B18FA2D7AAF6ULL, 0x0000000000000000ULL,
+    0xB8C42BD1E639AAF8ULL, 0x0000000000000000ULL, 0xBEEB66500AFA29DDULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1EB43BF48AFFE410ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x482A68FBC5180B06ULL, 0xC174A09E3A200B07ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC97FDA3A6FDD8B0AULL, 0x0000000000000000ULL,
+    0x7BC55E03D2556B0CULL, 0x89C89E52EB0D07FFULL, 0xAC01A3FEFBF84B0EULL, 0x0000000000000000ULL,
+    0xC43BEEF3C6732B10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB7053AD400830B13ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x3DBAF745E9A26B17ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x92E0DB24CB1B8228ULL,
+    0x6C0DB98EB31B0B1CULL, 0xC1A42C9D8D39CB1DULL, 0x0000000000000000ULL, 0x476D887416416B1FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDE7997E209E50B23ULL,
+    0x0BD97E3C0465CB24ULL, 0x0000000000000000ULL, 0x9823DBE3FBFB8B26ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0288E1C237CCEB29ULL, 0x0000000000000000ULL, 0xC0B00CD70B2B3A59ULL,
+    0x6AA2B3FF4B2C0558ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x50D608764F64AB2FULL,
+    0xEFDE26307D57AB30ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5707DDC0CBA1EB34ULL, 0x0000000000000000ULL, 0x679A7681D98D0B36ULL, 0xC6FF103F4C2B0B37ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x9CB70185EB3B7CA7ULL,
+    0x349B9D65AB3C14C1ULL, 0x0000000000000000ULL, 0x6669568D06BB0B3EULL, 0x0000000000000000ULL,
+    0x817017AA0B406188ULL, 0x0000000000000000ULL, 0x9442964B4B4209C9ULL, 0x1D0B5E78EB434331ULL,
+    0x853C67E37344EB44ULL, 0x8C25C5EB2B459FF4ULL, 0x8895EED74B4602D4ULL, 0x8D125D7369D0CB47ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC7D6AC5E1AF80B4BULL,
+    0xAA1A8449D095CB4CULL, 0x0000000000000000ULL, 0xCAFF94E88B4E58B9ULL, 0xA51CFBDCFCDB6B4FULL,
+    0x65FBCD0E616A0B50ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3B73A2E19B060B55ULL, 0x6280AD2E856CCB56ULL, 0x0000000000000000ULL,
+    0xCCB9CDED8DA30B58ULL, 0x0000000000000000ULL, 0x69FD013855EC2B5AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9927170E851ACB5DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xDB3AD3DBFC310B62ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCA8BF37DB44B4B65ULL, 0x214C771315334B66ULL, 0x0000000000000000ULL,
+    0xA123D5496B68CD2BULL, 0xBA624BE6A04E4B69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x82E191AE30B8AB6DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x66A396B5CEB3EB70ULL, 0x0000000000000000ULL, 0xB26FFF86CB7262A6ULL, 0xB79AD3040B73D102ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x210E135D6B76D836ULL, 0x4E52D2B85F152B77ULL,
+    0x98B3668E0E29CB78ULL, 0x1162416ECB7953F9ULL, 0xD97E7F8A003E0B7AULL, 0xB5851B80F7C86B7BULL,
+    0x2C735E516B7CEE2FULL, 0x7EFDCF0EEB7DE8CEULL, 0x7516BA59E3F74B7EULL, 0x0000000000000000ULL,
+    0xCF3A6A43806C8B80ULL, 0x0000000000000000ULL, 0xF980E9291E1CAB82ULL, 0x0000000000000000ULL,
+    0x1098A81525B4EB84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x49989BD92B8BDD93ULL,
+    0xBADCAE96B0F16B8CULL, 0x934E9E306B8DECB6ULL, 0x0000000000000000ULL, 0x20CB1CE92593AB8FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x02FAA36F8B967448ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x66D67FCF0B9BE4A8ULL,
+    0x2550E11CBCEB8B9CULL, 0x03A7E0DD8B9D63B9ULL, 0x8174BD5BFE3D6B9EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x10D3EB7D8D042BA1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x703043B7D0786BA4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD513D277E979CBA7ULL,
+    0x3694E13D951DABA8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x43D2403FB80F8BACULL, 0x3124E9B0EBAD0BACULL, 0x1A38AE0745178BAEULL, 0x0000000000000000ULL,
+    0x07FC3A4544D38BB0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x101DF2594EBECBB3ULL,
+    0xF175685AAC368BB4ULL, 0xF2389F7F1BE7CBB5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x9152BD9A2FD02BBBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x41BBCD210F5AABBFULL,
+    0x0000000000000000ULL, 0x8CBD2547670CEBC1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x8F06ED0ACD090BC5ULL, 0x20D3BE091443CBC6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD88E731A6CC5EBCBULL,
+    0x8A7285D748EEEBCCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA741E878EBD4A1AAULL, 0x7F593C214571EBD5ULL, 0x0CD6BBB4C6F24BD6ULL, 0x0000000000000000ULL,
+    0x7A4880DCEBD8D49DULL, 0x2737987CDEE44BD9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0F8A7A94367A0BE1ULL, 0x9DBCF34C82A7CBE2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x4E05FDC894034BE5ULL, 0x7E87AA340BE66876ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x458F29036BECBBC6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4B69E3479C998BF2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBF0AEFBE153E2BF5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x03306F5873B10BF9ULL, 0x974A6C800BFA48F5ULL, 0x81236D4E4BFBA1BFULL,
+    0x0000000000000000ULL, 0x3B26AFEB9B9B6BFDULL, 0x0000000000000000ULL, 0x373F6609160B2BFFULL,
+    0x0000000000000000ULL, 0x5F11AFE6689EAC01ULL, 0x0F6ABACBACCD0C02ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xAC7717BE7F1C0C05ULL, 0xD83C67527D2ACC06ULL, 0xDD4AB0584C07FC32ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x578401946C0D23B6ULL, 0x0000000000000000ULL, 0x2DDED9D0CC0F49AEULL,
+    0xF2A99FA0CC109381ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD9ABD971E4578C17ULL,
+    0xC8EC17FBAE5DEC18ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9A5244E30C1EA908ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB4BC5008E9CEAC23ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xAE21C16F4C2608BDULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x704AF360AC29FE8BULL, 0x0000000000000000ULL, 0x5EEE96FBEC2BDEACULL,
+    0x2D476CB7EC2C5DFEULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x80111BC688B86C2FULL,
+    0x381A888EDBF1AC30ULL, 0x0000000000000000ULL, 0x1C4CCDE72C32D4FFULL, 0xC1927032AC330481ULL,
+    0xDEC9D4A60C341657ULL, 0x2F125D996C9BEC35ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xEFA74E51FB4BEC38ULL, 0x166533922A27EC39ULL, 0x9FEC79E981628C3AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6FCC047209B08C3FULL,
+    0xB6DEEAC26C403B01ULL, 0x4EB38F18C0722C41ULL, 0x36C09B4547EC2C42ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x08FD7CC2A1EF8C45ULL, 0x0000000000000000ULL, 0xEEF3BA68AC472ACFULL,
+    0xA88AC8FC82E00C48ULL, 0x0000000000000000ULL, 0xEF2F9AE20068CC4AULL, 0x0000000000000000ULL,
+    0x2269BDB14C4CBCA6ULL, 0x0000000000000000ULL, 0x86D9C0100C4EC38EULL, 0x0000000000000000ULL,
+    0xEAD4B4A889524C50ULL, 0x0000000000000000ULL, 0x81E44A3BEC52E152ULL, 0x0000000000000000ULL,
+    0x72B331CF24D8EC54ULL, 0x0000000000000000ULL, 0x6E8E496BBC22EC56ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x690B84DDE2E76C5AULL, 0x0000000000000000ULL,
+    0x49B3D84E602EEC5CULL, 0x1DF5DD7B985C4C5DULL, 0x9EE73A6664FCEC5EULL, 0x0000000000000000ULL,
+    0x969D0C8D2C60D394ULL, 0xF6477B9E5AC18C61ULL, 0xB95C0FCC4AC50C62ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x16674FDDEC67FEF9ULL,
+    0x0000000000000000ULL, 0xCA785B737F616C69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x55641CEDAC706C6EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA8069FFFD4C0CC71ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x293CBE6832514C74ULL, 0x445B5DE5DD7D4C75ULL, 0x0000000000000000ULL, 0xB7A5886A79340C77ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x955BB39A150CCC7BULL,
+    0xA13218312C7CADB0ULL, 0x227886A76C7D9871ULL, 0x0000000000000000ULL, 0x96D62AF77DF7EC7FULL,
+    0x936ED9C90BA74C80ULL, 0xCB36D52DF99C0C81ULL, 0x3D96B92C2C82D52CULL, 0xA7FD01472DAA2C83ULL,
+    0x0000000000000000ULL, 0xCB7D3B36AC859C44ULL, 0x0000000000000000ULL, 0x0DC9D550B653CC87ULL,
+    0x0000000000000000ULL, 0x0622AD44BCDC2C89ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x29DA006B6A728C8DULL, 0x0000000000000000ULL, 0x7CD20580BBDB0C8FULL,
+    0xCB85738D252B0C90ULL, 0xF94DF675F1EF2C91ULL, 0x08BCC980ABEB0C92ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBE47DFB2482F2C95ULL, 0x0000000000000000ULL, 0xF4386A7A8C979187ULL,
+    0x0487C6B75FA0CC98ULL, 0x999DF04F4C99D410ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5F3457900A27EC9CULL, 0x0D3C290E4C9D8D14ULL, 0x0000000000000000ULL, 0xAEF408387D034C9FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA287A711ECA34F87ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x546EA09DACA6D612ULL, 0x305020722CA79D55ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xDE945D3D39C9CCACULL, 0x0000000000000000ULL, 0xC657DC92F2A70CAEULL, 0x81B2052F3FF0ECAFULL,
+    0x0000000000000000ULL, 0xF8F7D1D6E19D0CB1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4571D1B0E7264CB4ULL, 0x0000000000000000ULL, 0x55385CA70CB645FCULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC9779D468473CCBAULL, 0x0000000000000000ULL,
+    0x802625355DAE4CBCULL, 0x8FCAC92DD0A1CCBDULL, 0x0000000000000000ULL, 0x3B2194702517ECBFULL,
+    0x0000000000000000ULL, 0x0C5BB51087CB2CC1ULL, 0x0000000000000000ULL, 0x8E987329387ECCC3ULL,
+    0xF6CE094278C18CC4ULL, 0x1BED1EA2D040ECC5ULL, 0xA3596120FB582CC6ULL, 0x5F248C280FAEECC7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x542E2DE1E24B2CCAULL, 0x0000000000000000ULL,
+    0x6C875E4FC89E6CCCULL, 0x7461263CD05CCCCDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF02B235376982CD0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x19D4B00B4CD3BDA5ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB3F592B44CD73F02ULL,
+    0x386D255C3FA3ECD8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFC3A6247CCDCA96AULL, 0x75AE6C0777512CDDULL, 0xF568DEEFBEC22CDEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x5977FBE5058DECE1ULL, 0x0C072C1C6376CCE2ULL, 0xD223759C0CE39451ULL,
+    0x0000000000000000ULL, 0x27AC169ACCE51396ULL, 0x0000000000000000ULL, 0x6C90CC4A0CE70516ULL,
+    0x9C8197872D28CCE8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x7B8A06040CEC4C32ULL, 0x0000000000000000ULL, 0xB4654CBA6CEE1915ULL, 0x7266EB774CEF9AA7ULL,
+    0x0000000000000000ULL, 0xCECB38196CF18CD8ULL, 0x1A80418B6F396CF2ULL, 0x47460F00C5EE4CF3ULL,
+    0x96D2297696BFECF4ULL, 0x5997AF156AB1CCF5ULL, 0xF81256ADDA7E4CF6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x493BE9C7506F6CFFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x82F903D08C5AED04ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x03A5560FED07B55CULL,
+    0x0000000000000000ULL, 0x72C5EE890D09E0E3ULL, 0x8078CDBADDF90D0AULL, 0x0000000000000000ULL,
+    0xA57A281285F1AD0CULL, 0x18E1C920CD70ED0DULL, 0x24EC65BF24FD2D0EULL, 0x181691A54D0F102EULL,
+    0x358068211722ED10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4EF87CA45FBD0D14ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD0998F70ED19E1F1ULL, 0x32098288CD1A30F3ULL, 0x2EF51C606D1B3E6BULL,
+    0x2C3948EE3DB72D1CULL, 0x66C1BEA8CF032D1DULL, 0xD42E73E4AD1EAFEEULL, 0x65F58D394D1F4752ULL,
+    0x713D53C592FF8D20ULL, 0x29E3C008F4CD8D21ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xDD5A9722359D8D25ULL, 0x1EC93E276AFDED26ULL, 0x0000000000000000ULL,
+    0xC53341F6ED281C79ULL, 0x5EA3D8CBED294B9DULL, 0xE138FA66E6CDAD2AULL, 0xB75E2321B30FAD2BULL,
+    0x8DFA307609292D2CULL, 0x0000000000000000ULL, 0x367C1C792D2E1EEDULL, 0x0000000000000000ULL,
+    0x6673B7A3F8EFED30ULL, 0x75A5B0744D31A5E9ULL, 0xAD98A7C7A3E88D32ULL, 0x837E2FC1B87D4D33ULL,
+    0x0000000000000000ULL, 0x79DE3CF57113CD35ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8E083226F16F4D38ULL, 0xCD75CAE2B9994D39ULL, 0x0F3A6D725D8F6D3AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x13F0A734260CCD3EULL, 0x14D9AE100E76ED3FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x86FEDE3883D94D43ULL,
+    0x75E8C12B01106D44ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x13F7D104DEF30D49ULL, 0x51AADC9027780D4AULL, 0xCC744059ED4B5C94ULL,
+    0x0000000000000000ULL, 0xE996A5628ACB2D4DULL, 0x9F1D0A2FED4ECC92ULL, 0x0000000000000000ULL,
+    0x562DEABCCD50B644ULL, 0x0000000000000000ULL, 0x89CB3B8EB2826D52ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC4BFA319C9434D58ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x3C9B0A942D5B51A4ULL,
+    0x0000000000000000ULL, 0x5C12DA00AD000D5DULL, 0x7AD70A89ED5E42EEULL, 0x0000000000000000ULL,
+    0x0E2087AFA89CCD60ULL, 0x0000000000000000ULL, 0xBE3C1018C7566D62ULL, 0x767DCC8B15C2AD63ULL,
+    0x0000000000000000ULL, 0x47EF958B40658D65ULL, 0x4C2E3ADF8EE34D66ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1D207F476D693D97ULL, 0x0000000000000000ULL, 0x6CEC1DB46D6BFD53ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD39E7F09E9E04D70ULL, 0x074736196C702D71ULL, 0x0000000000000000ULL, 0xE82A3163E1B32D73ULL,
+    0x8F0208166D7407B5ULL, 0x1DE55585AFE60D75ULL, 0x59FC26214902AD76ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x15584C736D7932CFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBF96C76E4D7C7B67ULL, 0x0000000000000000ULL, 0xA5A7EB7F9D4D8D7EULL, 0x2428A6B077B72D7FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9AA741A34D8205FAULL, 0x0000000000000000ULL,
+    0x1EAD25D51311CD84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBB187C7F4D881CF9ULL, 0x00A4900B6D89A0A6ULL, 0x0000000000000000ULL, 0x28696E17D6CEAD8BULL,
+    0xA02F73A212B44D8CULL, 0x0000000000000000ULL, 0x7C00B335ED8E5C69ULL, 0x0000000000000000ULL,
+    0xB5C33017B83C2D90ULL, 0x9CA77F1632C88D91ULL, 0x1F391D4183B74D92ULL, 0x2BD50BB9E10C4D93ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x406458E7D300ED96ULL, 0xC67E2C4ED8B14D97ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC346D9ACEC44ED9CULL, 0x0000000000000000ULL, 0x1A90D0888D9E51CCULL, 0x9CCCF3A309C6ED9FULL,
+    0xE70AE1057DB6ADA0ULL, 0x0000000000000000ULL, 0xB7D97895AEF7ADA2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x4013C546F9342DA5ULL, 0x180CEC121BB2EDA6ULL, 0x91FC1296ADA73840ULL,
+    0x1B9F86E4D05F0DA8ULL, 0x0000000000000000ULL, 0xF0CA7E38ADAAC9C8ULL, 0x078211C13D22EDABULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xCBBDFF0D06664DAEULL, 0x0000000000000000ULL,
+    0x390AFB3CD18DADB0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC4B7C05A6DB6EC75ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA67E7B48ADBA7040ULL, 0x11E054428C0B2DBBULL,
+    0x0000000000000000ULL, 0x0F98EACABC666DBDULL, 0x0000000000000000ULL, 0x205C0405ADBFAC90ULL,
+    0x0000000000000000ULL, 0xD5F227C4C5B9EDC1ULL, 0xEE4669AECDEA8DC2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x798E21C87FEDCDC6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4CABFC0B6DCE1EA3ULL, 0x0000000000000000ULL,
+    0xC8135AF5FA2DEDD0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE2C789252DD31AB7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x383D11CECDD624CEULL, 0x86433405ED33ADD7ULL,
+    0x5D302B1B178ACDD8ULL, 0x0000000000000000ULL, 0x57542022A2C22DDAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8B3035C286C66DE4ULL, 0x0000000000000000ULL, 0xE67D6E5B2DE6F094ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2C5B7CD4CE084DEAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x48EA4891CDEE8E2DULL, 0x6304F2F492E0CDEFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xAEB2E96C6DF42733ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x32E16336EDF704BBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0EDF848CADFB03B1ULL,
+    0x5CE22355E5872DFCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBAF54FE89B8DAE00ULL, 0x0958169EAE0117DFULL, 0x0000000000000000ULL, 0x16941583DB406E03ULL,
+    0x0000000000000000ULL, 0x420F575186724E05ULL, 0x147FCE67EE06BCFEULL, 0x5C89371470762E07ULL,
+    0xC81CAA0E8E0851D4ULL, 0xA5808C9B26986E09ULL, 0xE84458A3916BEE0AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x906D0BBE93798E0EULL, 0xF8FAADF9C7F7CE0FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1F8A5D098E151E9DULL, 0x79A5161B93E9EE16ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6498CD33E0318E19ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1CFC4BEAAE1CB77DULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x93653A30035A0E1FULL,
+    0x003B7C874CA98E20ULL, 0x312052CDB443EE21ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x56CC1A4B11494E24ULL, 0x0000000000000000ULL, 0xDC27F5F506310E26ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB92CE58A6E2AEC8DULL, 0x355C8A3EE6BF2E2BULL,
+    0x55EA10292E2C470AULL, 0x93B8F41F36676E2DULL, 0x0000000000000000ULL, 0x039FA110D2112E2FULL,
+    0x0000000000000000ULL, 0x62D1B1C1CE317C69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x23A0D7A38E34797FULL, 0x0000000000000000ULL, 0xC329BDBBFC1C2E36ULL, 0x7D5B224C78DFEE37ULL,
+    0x89BF7DE4BF0AEE38ULL, 0x480023807DE96E39ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x06AA6D010E3C7BA6ULL, 0x76B1141AA18E2E3DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB1084CBA63B66E40ULL, 0x0000000000000000ULL, 0x535D30271F120E42ULL, 0x236F341F0E43FC84ULL,
+    0x0000000000000000ULL, 0x8CF947FF39E78E45ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCBCD0CC6B935AE48ULL, 0x226B8C294E492031ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x392AEE060E4CFE7BULL, 0x0000000000000000ULL, 0x7CE64065899EEE4EULL, 0xD8455170907C4E4FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0AB42A4F4E52CF43ULL, 0x0000000000000000ULL,
+    0x15DE2D056ED30E54ULL, 0x0000000000000000ULL, 0xF8960E544E56763AULL, 0x899A28248E5717BCULL,
+    0x589AE4C5E6BA4E58ULL, 0x0000000000000000ULL, 0x19D448C592C58E5AULL, 0x0000000000000000ULL,
+    0x41F17106EAAD8E5CULL, 0xECD077C8E125AE5DULL, 0x0000000000000000ULL, 0xFAD1BE988E5FE9E2ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3F06FA46FBF3EE62ULL, 0x456255A36F6DAE63ULL,
+    0x1E3541ABE61C4E64ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x81209AAD3CC84E69ULL, 0x0000000000000000ULL, 0xE6FD6A4864380E6BULL,
+    0x56CB048828598E6CULL, 0x65C442941530CE6DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3106284BD57F0E71ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4E3F85E60E769278ULL, 0x0000000000000000ULL,
+    0x938472AC186DEE78ULL, 0x0000000000000000ULL, 0x71C09A1AABEEAE7AULL, 0xAE51FF8A0E7B77C8ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x888D8117E97F2E80ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0629F3A5C7F90E84ULL, 0x5BDFEDAA8E3A4E85ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x24F918474E8861C8ULL, 0x4CCB6B4387E3CE89ULL, 0xC4726D5D8251CE8AULL, 0x1D5B50874E8BA497ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xE44D6E413FBF2E90ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xAB77AEDBD0F70E95ULL, 0xE02D1A4AEA278E96ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7CB9501174298E9AULL, 0x0000000000000000ULL,
+    0xF4C8F931A969CE9CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x145707EDFD496EA5ULL, 0x0000000000000000ULL, 0xFAD5449B3BD82EA7ULL,
+    0xCA474D25C627CEA8ULL, 0x0000000000000000ULL, 0x945FB5340F298EAAULL, 0x0000000000000000ULL,
+    0xAFE4D8E329D92EACULL, 0x3D6EA9D4938ECEADULL, 0x1F7A4986AEAE3901ULL, 0x42075FE9E8C12EAFULL,
+    0x5829864897BBCEB0ULL, 0x0000000000000000ULL, 0x12EA51AF4EB2ADD0ULL, 0x0000000000000000ULL,
+    0xAD5C43790AA90EB4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4F5BB80AFCD1CEB7ULL,
+    0x0000000000000000ULL, 0x5B49DD07BE38AEB9ULL, 0xCEC1D48B5DA96EBAULL, 0xA029F18D0EBB7FECULL,
+    0x0000000000000000ULL, 0x8B6528BD2EBDCC5AULL, 0x0000000000000000ULL, 0xABBC051A8EBF039FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE0AB4E50406BCEC2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x21BC92F65CBCEEC6ULL, 0x0000000000000000ULL,
+    0x529267FBA8C70EC8ULL, 0x463614A6DC8E4EC9ULL, 0x41A77E6EBB054ECAULL, 0xFCC1C82873B28ECBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA989A435EED00F80ULL, 0x0000000000000000ULL, 0xF014EE81A511CED2ULL, 0x519980152ED3E897ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x5DDF5E6C7E5B6ED6ULL, 0xD8BE6CAAEED7330DULL,
+    0x9980B641C39FAED8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA2A9126F982F4EDCULL, 0xF34C047BEEDD204FULL, 0x296A88B0D0BCEEDEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9975C450EEE1163FULL, 0xCA029FC5B8FC0EE2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x817451AF6A746EE9ULL, 0x8D5DED8F626EEEEAULL, 0x7A0FA3000EEB4876ULL,
+    0x94009D4203920EECULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xAD03F5850EEF1A29ULL,
+    0xD3E453D573ECCEF0ULL, 0x6EAC224B33EDCEF1ULL, 0x0000000000000000ULL, 0xF2A640025391CEF3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3F3CAC831DF1AEF8ULL, 0x66A2C3554EF92235ULL, 0x0000000000000000ULL, 0xAB73607A30AA0EFBULL,
+    0x34AEFA1C0AC9EEFCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCE51CC91017BAF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x439E98692083AF03ULL,
+    0x1ED09EF024842F04ULL, 0x0000000000000000ULL, 0x49A25EABA2554F06ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x30517F3CF6240F0BULL,
+    0x760B5FAEC9E8CF0CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x896E9D96EFE72F0FULL,
+    0xB4926F0148EE6F10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x17E7739C8E238F13ULL,
+    0xBD7B718BE3154F14ULL, 0x7E61E2EDCF3AEF15ULL, 0xD8FE0F70AF1643D8ULL, 0x40448990AF176FD2ULL,
+    0x0000000000000000ULL, 0xD6A055FBAE77CF19ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD924F7A264530F1CULL, 0x877C7219DAEE6F1DULL, 0x0000000000000000ULL, 0xB453C6C29EE14F1FULL,
+    0x0000000000000000ULL, 0xCA0B5E7017A5EF21ULL, 0x0000000000000000ULL, 0x9236B6B091706F23ULL,
+    0x0000000000000000ULL, 0x841E0DBD4BD76F25ULL, 0xB814C97D7FA98F26ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x56210546492FCF29ULL, 0xD65828627FDD8F2AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x013D1B632796EF2DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x94C6E8268E1BCF30ULL, 0x54B546FC6924CF31ULL, 0x0000000000000000ULL, 0xC77FA209ABCB6F33ULL,
+    0x78563A90AF348973ULL, 0x6041BD358F35AFE7ULL, 0x6D4F203535026F36ULL, 0x45373D2505032F37ULL,
+    0x0000000000000000ULL, 0x5CB37B3802B7CF39ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8C71A9683B8D4F3CULL, 0x178587FF871ACF3DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6803B640BC158F43ULL,
+    0xCE96B3316F446969ULL, 0x0000000000000000ULL, 0x6D0E1125632EEF46ULL, 0xB1250F26034E8F47ULL,
+    0x0000000000000000ULL, 0x74F6BA78A6E00F49ULL, 0x0000000000000000ULL, 0xC31DFBCDAF4B063EULL,
+    0xBC8AADEC69176F4CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x416DCD9CAF5A8A13ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x64EEDA0D80228F5EULL, 0x7AA1D5925B9FCF5FULL,
+    0x0000000000000000ULL, 0x4C9313B25B4A8F61ULL, 0x0000000000000000ULL, 0x99157EFF6F6382E3ULL,
+    0x786F771E4F646471ULL, 0x0736D7839A82EF65ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCDC6D27C55E66F69ULL, 0x28CB2A25A5C16F6AULL, 0x0000000000000000ULL,
+    0x91E5BF0EAB7F8F6CULL, 0x712450B4FA550F6DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x56529579AF71C712ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9A321A2335C98F75ULL, 0x0000000000000000ULL, 0x3B2037BBCD75AF77ULL,
+    0x3789783BCFFB6F78ULL, 0xF0FB892824E00F79ULL, 0x1658CAE7B73B4F7AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x726FAFE367BF8F7EULL, 0x6B6B79692F7FC5D7ULL,
+    0x71302914F555EF80ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xAFA32D57A5B20F83ULL,
+    0xD28AB7349A3E4F84ULL, 0x0000000000000000ULL, 0x40DC540DEF86E02CULL, 0xD2E8D77720098F87ULL,
+    0x0000000000000000ULL, 0x13D5E6254F89C6D0ULL, 0x0000000000000000ULL, 0xEED764B9CF8B5CADULL,
+    0x0000000000000000ULL, 0x9BCE82F888AFCF8DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0BF55658D4E66F93ULL,
+    0x0000000000000000ULL, 0x2A8C72EFE39D8F95ULL, 0x0000000000000000ULL, 0x2CA4F4408F97276BULL,
+    0x1C709D2F9BE88F98ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC34020DECF9E01B3ULL, 0x032C3060B5C40F9FULL,
+    0x3AD1C63D3058EFA0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x255BE28D3C906FA3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4C6EFFA5B0AF0FA6ULL, 0x8833D435B989EFA7ULL,
+    0x0000000000000000ULL, 0x6A23A7881912EFA9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x7F5A3AA51B088FACULL, 0xBD0DC1F09ACECFADULL, 0xBBFC0857E0102FAEULL, 0x4784A32260B50FAFULL,
+    0x0000000000000000ULL, 0xC15FCE10AFB19D47ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC28CA0093B056FB7ULL,
+    0x0000000000000000ULL, 0xDAA4550FDFBE6FB9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x28F3499A2FBD7129ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x641CAA7F482A8FC1ULL, 0xBE66A709CEEDEFC2ULL, 0xCBCABC13991ACFC3ULL,
+    0x61CF4F1F7D3ACFC4ULL, 0x0000000000000000ULL, 0x61C5AC9DA6694FC6ULL, 0xB2587A97DDD4AFC7ULL,
+    0x4453E852CFC84EE1ULL, 0x4602FA4F990E4FC9ULL, 0x573D014275E5AFCAULL, 0xAF9E1236CFCB5492ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA5AEFCD66FCE7964ULL, 0x5C1109275D6B8FCFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC0588546B2CCEFD2ULL, 0x4E1DC4AD5CA9AFD3ULL,
+    0x7D2FD61B4FD4E12BULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDA03A657EFD789E8ULL,
+    0xC7DF831EF9E60FD8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x40FF7ACAEDE50FDBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xAF7BB039CFE13B49ULL, 0x0000000000000000ULL, 0xCADF6F45DEFE2FE3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x8BAF25DA78D5CFE6ULL, 0x6D1B817D31B02FE7ULL,
+    0x327966CEAFE8B51EULL, 0x0000000000000000ULL, 0xE1975D6B5367CFEAULL, 0xE30A791E8FEBC2C4ULL,
+    0xFDED94ED8FEC7183ULL, 0xCD024F50E5D62FEDULL, 0x8E022CBEAB032FEEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x56AF94FB83B4EFF1ULL, 0x0000000000000000ULL, 0xEB6D18000FF37979ULL,
+    0x00E46CBC8FF43822ULL, 0x4064417C0FF5251EULL, 0xE44D86F30A65EFF6ULL, 0x0000000000000000ULL,
+    0xC8649AE3B87CEFF8ULL, 0x0000000000000000ULL, 0xB09000CD4FFA9F85ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x714F434D3A314FFEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xAE00122F9CCE9001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x74A3807E6E921004ULL, 0x0000000000000000ULL, 0xD1E9B076F0255006ULL, 0x0000000000000000ULL,
+    0xE6078FFEFD937008ULL, 0xAD1F9D1C5607B009ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x387909D8F00F7BBAULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x74851BD214A85013ULL,
+    0x0000000000000000ULL, 0x831863573015D2F7ULL, 0x0000000000000000ULL, 0xCB037132342C5017ULL,
+    0x0000000000000000ULL, 0xDAB71EC295193019ULL, 0x0000000000000000ULL, 0x92DFC9FBCC72501BULL,
+    0xFE48140E101CAA0AULL, 0x459839E7701DE2E3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB4E27211106FB023ULL,
+    0x0AA6FB4301BF3024ULL, 0x7908B24AEA6D3025ULL, 0x0000000000000000ULL, 0x74BBA5AB54979027ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7C34E343902AA42DULL, 0x6930C14FA518702BULL,
+    0xD52237F12CB0502CULL, 0x0000000000000000ULL, 0x62058271EE70302EULL, 0x0000000000000000ULL,
+    0xAAA042EDB7E39030ULL, 0xF43A57717BF49031ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3B31AE0A67E1D035ULL, 0x0000000000000000ULL, 0xF2C0A336F0376BC1ULL,
+    0x0000000000000000ULL, 0x6395C88697943039ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0BE68A4770A0103CULL, 0x0000000000000000ULL, 0xE3013234F03EBE88ULL, 0x0000000000000000ULL,
+    0xB9DF567290408AD7ULL, 0x0000000000000000ULL, 0x224D424B90CCD042ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xEE460B621045AD3EULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD4A1F7B5304867A3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDE91F506AF46504BULL,
+    0xE1D2A59FC163904CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8CDD3FEDB05009A9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x906C52EA10558F89ULL, 0x8D7CD05B83341056ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x8C1DA0C06F65B05DULL, 0x0000000000000000ULL, 0x4B13B6EE486E505FULL,
+    0x0000000000000000ULL, 0x9B90497590821061ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xE9304AA70E303068ULL, 0x15BD5614CDA5F069ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x492D60F867ABF06DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA6388835792C9072ULL, 0xF343AA63F6479073ULL,
+    0x78CFAF788A3C9074ULL, 0x0000000000000000ULL, 0xCDB7421665F6D076ULL, 0x0000000000000000ULL,
+    0xEE34B23A729F1078ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0523B9563496B07FULL,
+    0x0000000000000000ULL, 0x75C5B5628FFF5081ULL, 0xB3AE6720613F9082ULL, 0xB14070FA1C771083ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB988A92F1089C467ULL, 0x0000000000000000ULL, 0xAB59318373D1F08BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x261729B950A47094ULL, 0x2EC29D7F7095D5A2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x31EFFF29D098B69DULL, 0x564A6691109982BDULL, 0xD4AAD9ED709AA1DDULL, 0x0000000000000000ULL,
+    0x29A083089B4ED09CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4D7C06BD2CBCB09FULL,
+    0x0000000000000000ULL, 0x7C961C5FD0A1AAA2ULL, 0x0000000000000000ULL, 0x5D1FB642037AF0A3ULL,
+    0xC6A4E5AA50A474E5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8719DBB75EA2F0A8ULL, 0x0000000000000000ULL, 0x89B8EAB2FFA610AAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x79E47063E9C6B0ADULL, 0x6E2EBF232C1850AEULL, 0x0000000000000000ULL,
+    0xB197E40D19DC10B0ULL, 0x0000000000000000ULL, 0xE7C7B7D0BD65F0B2ULL, 0x6EFBA2E5F0B3378DULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD7A0F4BBD0B6ED8CULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x524D5E4B44B010BDULL, 0x0000000000000000ULL, 0x543C641D10BF981AULL,
+    0xD5C01AF8201D90C0ULL, 0x0A38555F9D9830C1ULL, 0x2C7603B64313D0C2ULL, 0x60EB22EB50C38F5FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA69E070F698B50C8ULL, 0xFD4CA70C52D3F0C9ULL, 0x0000000000000000ULL, 0x2BD84AF58FB730CBULL,
+    0x0000000000000000ULL, 0xB0A06614E66FD0CDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xABA79E1C257A70D0ULL, 0x77A757B6855950D1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xE555F288303410D4ULL, 0xB67AB6FE0A78F0D5ULL, 0xE53FED3810D6986FULL, 0x58E6B055CA6D10D7ULL,
+    0xB3F1EA2AAE1FB0D8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCC5D1161ED5270DDULL, 0x19632B7278DEF0DEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x256CA5E16058B0E2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7E31E8DEA2E550E6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x503597B65049F0EAULL, 0x3E9A603740AA50EBULL,
+    0xB49917B161E610ECULL, 0x0000000000000000ULL, 0x129CF8D5B0F850EEULL, 0x1436837A888930EFULL,
+    0x88086AAA90F0B5F8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8B1B02196297F0F3ULL,
+    0x1F6A47AED0F4D438ULL, 0x7931279F6C6AD0F5ULL, 0xE8B485A8571450F6ULL, 0xE4EF3E5CA6AC30F7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x59E698345D03B0FAULL, 0x0000000000000000ULL,
+    0x1BB902512D81B0FCULL, 0xB0BC8C14F0FD7DF6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x2B89FA0CB63A1101ULL, 0xE1CA59666025D102ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD8F45C03B1051773ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x064FDB50A8B33110ULL, 0x0000000000000000ULL, 0x9C2D168B3132F112ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1ECB5FE2356CD116ULL, 0x9C11E7C9BC9D9117ULL,
+    0xD5A6D02250F55118ULL, 0xCD35B2FA3119D4C7ULL, 0x0000000000000000ULL, 0xC0F72389711B8774ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x774ECC7C272F911FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x48A0A11A31233A5FULL,
+    0x0000000000000000ULL, 0x3A1A4C38F1258C06ULL, 0x6213FB06632D9126ULL, 0x8E62DA56B7935127ULL,
+    0x0000000000000000ULL, 0x200D763531298C40ULL, 0x71DAE1900021312AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x71D2710E90173130ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE12D7AED64CB513AULL, 0x2ECD9C5DD354913BULL,
+    0x29E0C951513C3247ULL, 0x9EE8C46B3FA1F13DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3252D66F1140D6CBULL, 0xBFFFE6C09866F141ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA91855CD114463DBULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x608758AFA46C7150ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF2CAC13E115312AAULL,
+    0x777D4F8B7A261154ULL, 0x0000000000000000ULL, 0xBAC3029673B41156ULL, 0x09AE9C14D1570009ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xCB1DFD585077D15AULL, 0x0000000000000000ULL,
+    0xDBF36975E889115CULL, 0xDBD3D421115D9ED3ULL, 0x0000000000000000ULL, 0x0FDCCDD67F2D315FULL,
+    0x0000000000000000ULL, 0x520D58C002D3B161ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x15A265B4FF0AF164ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x17F0CAAE1167C68BULL,
+    0x7E95DD2DB168D263ULL, 0x0000000000000000ULL, 0x7487F3E50B70D16AULL, 0xB77F4D59352FF16BULL,
+    0x33DAE7CCA5D3F16CULL, 0x0000000000000000ULL, 0xEE3D98CF496D516EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6201A38D35281172ULL, 0x7587EBED117347A3ULL,
+    0x0000000000000000ULL, 0x4D308BE5847DD175ULL, 0x0000000000000000ULL, 0x57671F6B7177675FULL,
+    0x91DA79A4DB0A7178ULL, 0x21EC5ECD1840D179ULL, 0x0000000000000000ULL, 0x97ED6308F95E517BULL,
+    0x0000000000000000ULL, 0x3A52AFD1FD09117DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4DB74BA166849182ULL, 0x2D1D05E5A0D3F183ULL,
+    0x17C7E27D5D951184ULL, 0xA236B34A77EF5185ULL, 0x0000000000000000ULL, 0xB6551B17F1874F95ULL,
+    0x1C835E9AE1DA3188ULL, 0x8940AAF811890E8AULL, 0x897E5617F0BB718AULL, 0xF5BE2D5AD623B18BULL,
+    0x0000000000000000ULL, 0x3B83066A28F5118DULL, 0x5B47A1C37E18718EULL, 0x138773988C06918FULL,
+    0x0C64C8BA91903A59ULL, 0x984FC865EC801191ULL, 0x0000000000000000ULL, 0xD69D2C61E6C17193ULL,
+    0x0000000000000000ULL, 0x034777FEBC4A1195ULL, 0x495224CC763C7196ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0959B585575EF19AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9C1587B968C7119DULL, 0x626C89847268B19EULL, 0x0000000000000000ULL,
+    0x6F7ECA494B9EF1A0ULL, 0x0000000000000000ULL, 0x1F3B7C84DC2671A2ULL, 0x0000000000000000ULL,
+    0x81E8525FD1A44C7BULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1451DC5CB1A7EFF8ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xF422571B1FBE91AAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB9A1F29291AD5039ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFF48CC93AA6071B0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0EAED1BF88B031B3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9D9CF9604EB9F1B6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0194B3FE11C951BBULL,
+    0xE871C095D56C11BCULL, 0x0C9ACD4ED883D1BDULL, 0xE8F6222F624491BEULL, 0x7A7C5318D81371BFULL,
+    0xCA18CED271C05E92ULL, 0x91C4991511C148B6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xC9C3CB90CF2611C5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x75C14D4951C875F9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2BA20BBA71CB6371ULL,
+    0x463D77D6F66C91CCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x29DFB8D0105891CFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1BAB240B97FEF1D3ULL,
+    0xDA9CBB4655D491D4ULL, 0x4943E485F07191D5ULL, 0x1E3B1C64816051D6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBC32B222EDDD51DBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBDC6AEB90014B1E1ULL, 0x0000000000000000ULL, 0x987DB15191E3D614ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x8B7AD0F6D1E61E20ULL, 0x18368D6311E7F01DULL,
+    0xEF94CA99272931E8ULL, 0xA4C88A09B1E9BEDFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xC9BB6519D7DFB1EDULL, 0x0000000000000000ULL, 0x3F9777373A2191EFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x36718265CFB291F2ULL, 0x0000000000000000ULL,
+    0xD6D5600BF1F42618ULL, 0x6E506AF9A5DE31F5ULL, 0x56EBE8AAB1F6F2DCULL, 0x89CE3994B8FC91F7ULL,
+    0x0000000000000000ULL, 0x6EF9CCBED8D151F9ULL, 0x08703C2662D091FAULL, 0x0000000000000000ULL,
+    0x7EC17C8F31FC58CBULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4F8F3F163DED9203ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xADF53EE66437D20BULL,
+    0x0000000000000000ULL, 0xBAECDCA2234DD20DULL, 0xE820E3583A62D20EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA93E504F62911213ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x55E046412C335219ULL, 0x798EB4A48861F21AULL, 0x0000000000000000ULL,
+    0xED7E06929FEF521CULL, 0x0000000000000000ULL, 0xBAE26D800503F21EULL, 0x0000000000000000ULL,
+    0x8A28B7EC88E55220ULL, 0x0DF8152F2988B221ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA7D62078AB805225ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD98CD422D22A7C16ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x2C3804853B71522DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x243E4701F231C449ULL, 0xC271B1D172322A2AULL, 0x4CFB8976D43C1233ULL,
+    0x0000000000000000ULL, 0xE9D0D1A230701235ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1D2BECD465B39238ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDCA06D9B523B3153ULL,
+    0x0000000000000000ULL, 0x3E9830C65D5C323DULL, 0x434A68149922B23EULL, 0x1BD8F53EA32AD23FULL,
+    0xB15C28E5F2EF3240ULL, 0x0000000000000000ULL, 0x55E659845ECC9242ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB7134D5A8B31B247ULL,
+    0x854E11A29A9C7248ULL, 0x0000000000000000ULL, 0x50E16F90AC27524AULL, 0x252BF0EB9DD0924BULL,
+    0x86C588FA8F45F24CULL, 0x4F0DE4675053B24DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2A4E992F87951252ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x78D1656E7BDAB25AULL, 0x814FDFB8525B07CBULL,
+    0xAEB016061404F25CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDC313FAA687BF25FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x35AEA56E7E27B263ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB61000F224EEF268ULL, 0x79747982AD1A9269ULL, 0xE0C0CE7120E9B26AULL, 0x0000000000000000ULL,
+    0x0DCC0FBF6FEA126CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6FB3040D008C7272ULL, 0xDC5A8204D639B273ULL,
+    0x110E8454F2748D1FULL, 0x0000000000000000ULL, 0x3EA6842D42143276ULL, 0xD7E40A0776489277ULL,
+    0x58E41C341A511278ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3174E8E7C109127DULL, 0x0000000000000000ULL, 0xE6CD92E0E0B1D27FULL,
+    0x45134B22407A5280ULL, 0xD70954A63281ACF2ULL, 0xC5BC802BB282E79BULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xF3180805F285AC60ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC8A5398014FCD288ULL, 0x0000000000000000ULL, 0x4DC0513E000E728AULL, 0x6D23BBA8728BD4E5ULL,
+    0x0000000000000000ULL, 0x34AFD8736538128DULL, 0x8C1A4891944CB28EULL, 0x459529136B67928FULL,
+    0x9753655FF290F33FULL, 0x0000000000000000ULL, 0xE132A204D292B357ULL, 0x0000000000000000ULL,
+    0xA670A6E330229294ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x144F316C015B1298ULL, 0x0000000000000000ULL, 0x95AF33D8D29AC3E8ULL, 0xC0C8F379929B0EF9ULL,
+    0xAA7474868F1A729CULL, 0xEF90DE67D4D6B29DULL, 0x0000000000000000ULL, 0x8A75D4EE129FBBE5ULL,
+    0x0000000000000000ULL, 0x06F0EAF5932552A1ULL, 0xC207B3EA72A23179ULL, 0x68B709B1CE7472A3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x70632A3FB4E2F2A7ULL,
+    0x2934197C92A89BFFULL, 0x0000000000000000ULL, 0x0F5E30D81236F2AAULL, 0x4B8A2EFD52AB1EB2ULL,
+    0xCBBB804B609692ACULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x33ED589E52B0526AULL, 0x0000000000000000ULL, 0x8FBDDA05F16912B2ULL, 0x18161974F89B72B3ULL,
+    0x8F788CE47FC3F2B4ULL, 0x0000000000000000ULL, 0x95DF089A3D45D2B6ULL, 0x9C1B97BED2B789E5ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7616296B23B1D2BBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1B803AEABECC12BFULL,
+    0xA48630D1B8CBD2C0ULL, 0x6CA49AF172C175EAULL, 0xEDDD12FCAE5F72C2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0507021734E4B2C6ULL, 0x0000000000000000ULL,
+    0xDE8B07983F2D72C8ULL, 0x0000000000000000ULL, 0x73753336373132CAULL, 0x88A8A0E0E64092CBULL,
+    0xD3FB634EB2CCA6F7ULL, 0x421593E0E5CD32CDULL, 0x0000000000000000ULL, 0xA60A30286FC072CFULL,
+    0x0000000000000000ULL, 0x574CAE73E472B2D1ULL, 0x0000000000000000ULL, 0xE2F05544EC2F72D3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xEBF53249D2DAF1F7ULL, 0x0000000000000000ULL,
+    0x7371AD00702B72DCULL, 0x0000000000000000ULL, 0x32051F3DB2DEE46CULL, 0xAB712728B966D2DFULL,
+    0xDA8B825A52E065F7ULL, 0x0DD53C42CD0932E1ULL, 0x0000000000000000ULL, 0xBD43ADE4FB4B32E3ULL,
+    0x0000000000000000ULL, 0x4D38DCAA52E52906ULL, 0xCEDF94BA9FEFD2E6ULL, 0xBE001FC0D2E72C61ULL,
+    0x2F4CE715697932E8ULL, 0x5BF15860821472E9ULL, 0x2DB01D42F2EAA20DULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9C01156DCE5A72EDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x554092BC72F0C48EULL, 0x2B9C96B8087112F1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x7EF3F70A72F53B93ULL, 0x0000000000000000ULL, 0xA798760312F7C3B0ULL,
+    0x1347809A12F82534ULL, 0x2A96ABAB5D8F92F9ULL, 0x0000000000000000ULL, 0x0BE92D04F2FB4D1AULL,
+    0x11E080BC601852FCULL, 0x1464973C33A7B2FDULL, 0x0000000000000000ULL, 0xB3EED8704160F2FFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x41F3B8151302F73CULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x68AE17A313050AF6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xF56D467465C1930DULL, 0x0000000000000000ULL, 0x193A6231330FC731ULL,
+    0x29E78C6B5310ED9EULL, 0x0000000000000000ULL, 0x2A327BD8B677B312ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE81F30B58C40F317ULL,
+    0x6AA6F89B2DB95318ULL, 0x5A22DB6E398A3319ULL, 0x0000000000000000ULL, 0xA42B15B6C19BD31BULL,
+    0x0000000000000000ULL, 0x5693E145D31D9F86ULL, 0x0000000000000000ULL, 0x3ACD7EACB31F3DE9ULL,
+    0xA4A06BC0AC06F320ULL, 0x0000000000000000ULL, 0xFAB58A7384CED322ULL, 0xAB578B16D3230EE2ULL,
+    0x0000000000000000ULL, 0x8E0823D27BAF1325ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xEC43220FEB61B328ULL, 0xD00B5DD6A65D3329ULL, 0x3B624B9866EAB32AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x404F79D8552A9330ULL, 0xDA74F68F511E7331ULL, 0x60AE82BE43493332ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC4236DD8B84BF336ULL, 0x97F6DA3B13370BB0ULL,
+    0x0000000000000000ULL, 0xDF10AFB95CC93339ULL, 0x0403F9BFF33A3DA6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xCFC9315F6851F33FULL,
+    0xA346C9251BC73340ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE56F1E4433436D63ULL,
+    0x0CC03BD5F9519344ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB70F2425A3497349ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x14006BE890B7134DULL, 0x0000000000000000ULL, 0x9F0324FD734F7B4EULL,
+    0x6BDC58ADE68D1350ULL, 0x3D7AB8B3EA399351ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1C02D38B4F225355ULL, 0x0000000000000000ULL, 0x4FEF860EEA723357ULL,
+    0xE0F157DB7B4B1358ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBF389D510B16535DULL, 0x12FEDE8E63A1135EULL, 0xF0EA2D7EB35FEE2BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x796810FD85625367ULL,
+    0x875732C0D36848BCULL, 0x0000000000000000ULL, 0x576A88786B18136AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2A63A60B1647F373ULL,
+    0x0000000000000000ULL, 0x0C9245EAF7971375ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCF9D86C28DBF7378ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1170CC0B7EFFD37CULL, 0x0000000000000000ULL, 0xB2434AB32B0C137EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xDC97C20513813C2AULL, 0xA82FCD50838B7382ULL, 0xB6DCDDAA25E5B383ULL,
+    0x52FFEE09138478CBULL, 0x0000000000000000ULL, 0x205A8AD54A96B386ULL, 0x210B2C71F38782A2ULL,
+    0x4E1A44D0AC325388ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x471C8AA73390AAD7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2CF8DD107393197FULL,
+    0x6E1CA28E9394BFE8ULL, 0x0000000000000000ULL, 0x7795E4FB19625396ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x993FEB95038F139DULL, 0xF34801F2A00F339EULL, 0x0000000000000000ULL,
+    0xB3607020B77A93A0ULL, 0x3FE63A63447553A1ULL, 0x0000000000000000ULL, 0xE356B5076AB2D3A3ULL,
+    0x0000000000000000ULL, 0xB7BA1706E635B3A5ULL, 0x364AFA271E37D3A6ULL, 0x7FA4BF48307693A7ULL,
+    0xDBB80CCD93A883EDULL, 0x74E9F63ECCB673A9ULL, 0xCB7C69722B24B3AAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDBAB95B8ADACF3AFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4B143488DF39B3B2ULL, 0x666F3E190A89F3B3ULL,
+    0xAB58D2B053B47EB0ULL, 0xCB93F1E4D8D3B3B5ULL, 0xD6F7BE45B53693B6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC817C15BD3B593BEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xEABC803C313F53C3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC0433F4493C6CE21ULL, 0x4797D53118F073C7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7E2E9C7BF3CAE5DEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE705E1FD57CCD3CDULL, 0x5602AE26E07493CEULL, 0x21501D6577D4B3CFULL,
+    0x6177DB8D53D06CA6ULL, 0xEA926A6AD96373D1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x684C028411FF53D4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD4C828657EEF73D9ULL, 0x27B8F4776B8C53DAULL, 0xD5A55CCC1CF053DBULL,
+    0x0000000000000000ULL, 0x9C58C783F3DDC86AULL, 0x87E5F2F3D3DE42BDULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1B814C1B518B73E2ULL, 0x19A8FF7BFB9E13E3ULL,
+    0x01225559E3C9D3E4ULL, 0xC056994453E59FC9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x635806C2DC86B3EBULL,
+    0x93DFED35B3EC89A9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4D21E60B1D4373F0ULL, 0x0000000000000000ULL, 0x6D34E588FCD3F3F2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x03EC348288EAF3F9ULL, 0x0000000000000000ULL, 0x8ACC9EDA73FBC18DULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB3F0CD4D42A8D3FEULL, 0xABB1DF3FB97913FFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xCEED70C5A8C4F402ULL, 0x4B5EB96A43215403ULL,
+    0x0000000000000000ULL, 0xA0FE28FAB1D43405ULL, 0x463F4B7094065BAFULL, 0x4B5E1D35B02F3407ULL,
+    0xC8A5BBA47F07B408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF3D7E392941099ABULL, 0xFF58154C725F5411ULL, 0x36B4E9BDD412807EULL, 0x0000000000000000ULL,
+    0xD66557FBE4441414ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2A9751BE02279418ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x3ADAA1ADE416341BULL,
+    0x4EBCCEFDD41C502CULL, 0x30739CD1141DFC17ULL, 0x52CF4DF195A4D41EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBFEF12DED421E36CULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x33B9EA8B027C1424ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x17419214F427044AULL,
+    0xEB96DE6C86E7B428ULL, 0x0000000000000000ULL, 0x7E6F4CFF91C2142AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE3FE8A68D049342EULL, 0xE63794B6542F5006ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x824B51E2D4563432ULL, 0x75D1E4BB4D829433ULL,
+    0x037DD7AC74349EAEULL, 0xD2249916A48D3435ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xACDC198954388360ULL, 0xDC872E8BFCC47439ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4E5FE9EEF07C543CULL, 0x0000000000000000ULL, 0xC44C1A18343E96EAULL, 0x8EBB2D4142B2143FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6EDADF000EE33443ULL,
+    0x0000000000000000ULL, 0x382334AB9445587DULL, 0x4F75A1E5EA5C1446ULL, 0x0000000000000000ULL,
+    0xF4E60A5DDB83F448ULL, 0xAB3A45609449B076ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x69A1F4C1D44C9272ULL, 0x0000000000000000ULL, 0x1A20952A006B744EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x4FCE1F43751FD451ULL, 0x87B78B20D885B452ULL, 0x421D227B96041453ULL,
+    0x49C0BD51EFE3D454ULL, 0x0000000000000000ULL, 0xF0832C38E5A61456ULL, 0x0000000000000000ULL,
+    0x925B65825458423FULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD3F26CBF545CC211ULL, 0x0000000000000000ULL, 0x2C01D775145EC63EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x120FFCCF2F2A7461ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3F221EE435DD1464ULL, 0x79C5002FA48A3465ULL, 0x0000000000000000ULL, 0xCE9C150F3D9A7467ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA2DC9FC3B69C146AULL, 0x0000000000000000ULL,
+    0x12342B30F8A8546CULL, 0x6510C98E0E43146DULL, 0x74785D5BBDF2546EULL, 0xD40647CDF538746FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8134D831419C7473ULL,
+    0x0000000000000000ULL, 0xC4B9A2D1A4BCF475ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x2E4DD3F77DD87479ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFB45FCC7147C54B7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBA04B0339506347FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBB26F285972A9483ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x169486554A3E3487ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6BEFA7D4006E548CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6049A369008CF490ULL, 0x0000000000000000ULL, 0xEBF1776DCD771492ULL, 0xE1F999A49DF5D493ULL,
+    0x0801187A17BA5494ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7687E84134B2149AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA2127038549DCE80ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x98992F8DF4A328B5ULL,
+    0xA95DEF16861734A4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x51EB7C5710EE34A7ULL,
+    0x0000000000000000ULL, 0xB50C57FDF4A9DF52ULL, 0x1B9F8FD9EA40F4AAULL, 0xF4D5DE08EF3B94ABULL,
+    0x7D60D33D7699D4ACULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC5152A1AC42E14B2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3EB04908988874B5ULL, 0x94F41404AD9414B6ULL, 0x69D2322C48CBD4B7ULL,
+    0x2DF9B05F7869D4B8ULL, 0x904C726EF022B4B9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA1220349A469B4BDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x11D0914F813894C0ULL, 0x5875B2BC3E6794C1ULL, 0xF88CC35E382314C2ULL, 0xFFD58E3AE3EB34C3ULL,
+    0x6E54949174C40BCBULL, 0x0000000000000000ULL, 0x4AEAE1EB115954C6ULL, 0xC9B55EC61C6D34C7ULL,
+    0x0000000000000000ULL, 0xE6F1E49662CE54C9ULL, 0x0B8782A0644E94CAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9669783F1CD414CDULL, 0x0000000000000000ULL, 0xB35BD846CB9C14CFULL,
+    0x0000000000000000ULL, 0x152246F1A42974D1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2A27FB83D4D8A76CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x34CB8B3FC38FB4DBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA20DD526A75F74E0ULL, 0x0000000000000000ULL, 0x577B7898C0E614E2ULL, 0x2A3E136A34E310EAULL,
+    0x10635FED74E4612FULL, 0xD804EFCED4E5DB2DULL, 0xF6CA3849030294E6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xFC07EA737EDB94EAULL, 0x0000000000000000ULL,
+    0x1873E9BD7278F4ECULL, 0x0000000000000000ULL, 0x94866546869FB4EEULL, 0x0000000000000000ULL,
+    0x1500B32D34F0BFB7ULL, 0x90A34BDFC39A74F1ULL, 0x537D164BD4F2B26CULL, 0x07CC186F54F3D3A8ULL,
+    0x0000000000000000ULL, 0x82C162CB14F52EB2ULL, 0x0000000000000000ULL, 0xA8EC260514F7D17BULL,
+    0x03841E4C14F8AF6CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3889B5A9EFF634FDULL, 0x0000000000000000ULL, 0x3A04FBFFC260B4FFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC02FC28C7321B502ULL, 0x0000000000000000ULL,
+    0xDC6CD7AECCE0F504ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA6AD243AE072750CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDEEEEFD83ACA550FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2A096B6E82EDB512ULL, 0x0000000000000000ULL,
+    0x065EC92E7C0AF514ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1E199359D5172C10ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x7DB59561F51C780AULL, 0xFB5102A00C51151DULL, 0xDEAB8C5EFFA3351EULL, 0x47DEC6E4D51F2AF0ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4AF8E80900983524ULL, 0xCEEBAA1CC6A8D525ULL, 0x0000000000000000ULL, 0xF8F00CD4B298D527ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x9597AF2E6A17352CULL, 0x922DAF960537152DULL, 0x0000000000000000ULL, 0x099FBA7683FF752FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x701AFEECEA9CB534ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x71AFEBFC86C61537ULL,
+    0xDB2CB9AA109AF538ULL, 0x0000000000000000ULL, 0x055C0F94953A24FEULL, 0x0000000000000000ULL,
+    0xB9EA6783D53C04EDULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0E07420938EA1541ULL, 0x0000000000000000ULL, 0x6F9C846A55753543ULL,
+    0x7428E2A359849544ULL, 0x7FA946469118D545ULL, 0x0000000000000000ULL, 0xCBDDB0CCB68EB547ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9CCF90B4554A4E07ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x08187ABDD54DA410ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0D96977AE6905550ULL, 0x07384841D5045551ULL, 0x02F09760F6DDF552ULL, 0x0000000000000000ULL,
+    0x4B42C2781AB3F554ULL, 0xAC43FDF1F555BEB1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2993A03D12B7F558ULL, 0x0000000000000000ULL, 0xCA00DDA6D409B55AULL, 0x0000000000000000ULL,
+    0xF1C14E6AB55C8FCEULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xAB09E9F7B565AF89ULL, 0x0000000000000000ULL, 0xA0B534BAE04B5567ULL,
+    0x0000000000000000ULL, 0x7BE672C4AF84D569ULL, 0xBD3530F3EF1DD56AULL, 0x0000000000000000ULL,
+    0xFBEB76606CE6B56CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7323921BD008156FULL,
+    0x6E90A8B5157083D7ULL, 0x370DFC8BB571B7FEULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF07F4085557849BBULL, 0x0000000000000000ULL, 0x960E822FB57A76CDULL, 0x0000000000000000ULL,
+    0x4A9E8AA0B278157CULL, 0x0000000000000000ULL, 0xFBD6FCAA3255357EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x4B0CB67BE0BCB581ULL, 0x80596984483B7582ULL, 0x0000000000000000ULL,
+    0x672DABDD1B055584ULL, 0xCDB3EF2DCA1A1585ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0F97ABBA1DDB9589ULL, 0x0000000000000000ULL, 0x19027740D0E9B58BULL,
+    0x0000000000000000ULL, 0xEF1B6270758D992CULL, 0xB40595BDDECB358EULL, 0xB4046097C90AB58FULL,
+    0x704C8D57AD5C1590ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x314D2F8D45AF5593ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x7BF4F32FAED95598ULL, 0x0000000000000000ULL, 0xDAB81BBE959A14B5ULL, 0xC9AA152C6FA1759BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC37ED6803C7C959FULL,
+    0x0000000000000000ULL, 0x661C25E3A15BD5A1ULL, 0x6466AA1AE6B215A2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xCCAD748C75A72ED8ULL,
+    0xEAD45C6216F795A8ULL, 0x1BFBF4A975A960CCULL, 0x19DCD3821ADEB5AAULL, 0x4F810AC05698F5ABULL,
+    0x2B26C5DBA52D15ACULL, 0x93F0EA5815B575ADULL, 0xAEAC4CD1B5AEDC33ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1582C5F935BC9E7FULL, 0x0000000000000000ULL, 0x406796120634F5BEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x21CBFFCD15C162D7ULL, 0x0000000000000000ULL, 0xB431272855C3E3BFULL,
+    0x0000000000000000ULL, 0x8FA4D56C3EAFB5C5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9F147817B5C9FF4DULL, 0x0000000000000000ULL, 0xFBB77C48BF7895CBULL,
+    0x0000000000000000ULL, 0x102418957948D5CDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xC1522B6B75D1227AULL, 0x2678613A787615D2ULL, 0x0000000000000000ULL,
+    0xD617B6E716F555D4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0270240D59C5B5D7ULL,
+    0x0609F28E604575D8ULL, 0x0000000000000000ULL, 0x05D837C77BA775DAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9B9F51DDFC5CB5DEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5314FD34CE16F5E4ULL, 0x0000000000000000ULL, 0xE5EFFB3B75E617E1ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x372BD365F5EAB350ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x2D1A0AB3D5ED7D7FULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x119D03B9ADCD75F6ULL, 0x0000000000000000ULL,
+    0xF388A964573ED5F8ULL, 0x46DB214C67A095F9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xAE5B1FD375FEAB1CULL, 0x636812CBF7C055FFULL,
+    0x4623793FDD569600ULL, 0x063B754636017288ULL, 0x0000000000000000ULL, 0x60BD91228CACF603ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x525795257A02B607ULL,
+    0x0000000000000000ULL, 0x077B3ABE4B94D609ULL, 0x0000000000000000ULL, 0x717AF79A5068760BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA98AA354DFA6F610ULL, 0x309BA3A145729611ULL, 0x3C9DB7BB5DE99612ULL, 0x0000000000000000ULL,
+    0x15A3FACA2D733614ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCA88007A3475B618ULL, 0x8B9147AB4F9DF619ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4381C2E38CE6361CULL, 0x0000000000000000ULL, 0xB2EC51EBF61E5B49ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD1E37EFEB6383623ULL,
+    0xED4219EF5EA21624ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5F96395BE7E69627ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2E1C418D2FE4962AULL, 0x328761B05106D62BULL,
+    0x35C8953CA49AF62CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x33AA6C2B4AA51630ULL, 0x5633AEF14C35B631ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFAC42482CC71B634ULL, 0x0000000000000000ULL, 0x2726B0FEE6339636ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB42F7D5937AD9639ULL, 0x5E55F91B163A0265ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x555EB1C2EDE4363FULL,
+    0x86C5BFD13F9AB640ULL, 0x0000000000000000ULL, 0x26C1BC48E54F5642ULL, 0x08EB6C99B521F643ULL,
+    0x1FBCD0CAF644AE5FULL, 0x9FF85E55E8841645ULL, 0x6FBAC34E3AF49646ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2A72B7CE1151F64AULL, 0x046EB351F60CF64BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD52A1480A26EB64EULL, 0x0000000000000000ULL,
+    0x8E697B4346687650ULL, 0x0000000000000000ULL, 0xEED7A1DB50E4D652ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x336F244647191655ULL, 0x0000000000000000ULL, 0x1C639D428AC39657ULL,
+    0xA5C19F29365898FBULL, 0x7C26918D019A1659ULL, 0xC038C8077FD4965AULL, 0x1E4F3F97F65B8092ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xAC2ED33B8D7C565EULL, 0x00595E4C565FA8F3ULL,
+    0xFE336FB20AD0D660ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x77174998836EF663ULL,
+    0x0000000000000000ULL, 0x09FFB851F2E1D665ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2E5BD016A3A3D668ULL, 0xC073C8AEF1481669ULL, 0x3263F7CE5BA6966AULL, 0x0000000000000000ULL,
+    0xF262661AD66CC181ULL, 0x89A6E87C4519D66DULL, 0x0000000000000000ULL, 0x2B0FC392966FA4A8ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x784E571F8C66D672ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCF045E8CD8D13675ULL, 0xD125E79589755676ULL, 0xD06663BDB67770ADULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x05882B43F67A72E0ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x15679BAC36812B79ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x621FF3014D7C5684ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1608EDCDD1D39687ULL,
+    0x0000000000000000ULL, 0xC83A9B10BF683689ULL, 0xAC41AFD0A9FC568AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x07909F0BA581968DULL, 0x0000000000000000ULL, 0x0BC8D581DB0CB68FULL,
+    0x327B0D6B7B41D690ULL, 0x3911B5751D667691ULL, 0xF5215CD974EBD692ULL, 0x0000000000000000ULL,
+    0xB84838E9603F7694ULL, 0x0000000000000000ULL, 0xAD7F2FEB5696E0EAULL, 0x0000000000000000ULL,
+    0x0631D63256986A22ULL, 0x9EE4041F1141D699ULL, 0x0000000000000000ULL, 0x6825A04E9A38D69BULL,
+    0x36BF1873D69C5AE7ULL, 0xE1C58C44B9E1569DULL, 0x0BC27C8F1FCDD69EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x765611940989F6A6ULL, 0x0000000000000000ULL,
+    0xE1638C59DB14F6A8ULL, 0xBBADDDB4A9F6B6A9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x522D9F5856B0C1BEULL, 0xAB0ABFD6290556B1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6FF8880696B67C9BULL, 0x0000000000000000ULL,
+    0x92FDF78E27A8F6B8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCB8E9B14D6BC43DBULL, 0xCC4A8A22989C96BDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xFBF9D5EA7CD4D6C1ULL, 0x0000000000000000ULL, 0xA7470B9E87ECB6C3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC491BD89E79836C7ULL,
+    0x6B3AF8E185C116C8ULL, 0x0000000000000000ULL, 0xA7DD4643123D96CAULL, 0x33F7EDB87A1E96CBULL,
+    0x0A589396643716CCULL, 0x8ED4B769DB1B56CDULL, 0x0000000000000000ULL, 0xF9F99C9C416796CFULL,
+    0x96EDF61CFF6DB6D0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x569D12968AC736D3ULL,
+    0x0793E8AC2C08D6D4ULL, 0x0000000000000000ULL, 0xEB21DCD8F97916D6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB023EFE956DA3866ULL, 0x67440B9CFBD556DBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC9B8078F5D0916DFULL,
+    0x0000000000000000ULL, 0xAE790BB3C6D736E1ULL, 0x0000000000000000ULL, 0x5518E3E57FB596E3ULL,
+    0x53DEEAE6569616E4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xAF9BFEC12D84B6EAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x53A83DBC3C0896EEULL, 0x87FDA810E73BD6EFULL,
+    0x0000000000000000ULL, 0xD462EB32F6F11190ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCCACDE9D96F53FC3ULL, 0x0000000000000000ULL, 0x28A45D18212476F7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC2FD0A50E28416FBULL,
+    0x859BC4A8F15F56FCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5CF57AA496FF3F36ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x16ACC2C497ED7703ULL,
+    0xDB9A825A95C3D704ULL, 0x0000000000000000ULL, 0x00550C1EE058D706ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x2C81FCCA370C749AULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3DBAF0162E10D711ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1887BE01688C3714ULL, 0x0000000000000000ULL, 0x3C7BF41811315716ULL, 0x0000000000000000ULL,
+    0xFF1699694B65D718ULL, 0x0000000000000000ULL, 0x25AC2ABDBAEAB71AULL, 0xD7AA3EE0D71BA7E2ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x809CA9A500167722ULL, 0x58389B9A35E15723ULL,
+    0x7938FA27A4D27724ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF6AE582F372731CCULL,
+    0x2DDB6B76E9D97728ULL, 0xF820AA55153BB729ULL, 0x0000000000000000ULL, 0x11DE80B4572B6098ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x02EC4F1DCD97372EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x016D391040A9B733ULL,
+    0xD2DAB715595F1734ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xDB1E53D98FEEF738ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x460CE6C8973C4833ULL, 0x0000000000000000ULL, 0x80765278927FB73EULL, 0x9A072B60F44A373FULL,
+    0x97B93A069A49B740ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2302DAFD14807743ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xED51B66F8288D746ULL, 0x0000000000000000ULL,
+    0x4F63E17EE101D748ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xAFE549717F38974CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x05D02BE7974F21FBULL,
+    0x16062D65BD4FB750ULL, 0xBA1821B721CD3751ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCBDE5170491F9754ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC4DE1D92287EF758ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6440A110375E9AD7ULL, 0x3E9D0F5ADBC2775FULL,
+    0x0000000000000000ULL, 0x980FA69F2C47D761ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1BDC31E5DF86D765ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF2C26C00D7683C19ULL, 0x15AC3053176963D9ULL, 0xDD8962BEA735776AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB558AA466015D770ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8EECE42C6846B773ULL,
+    0x0000000000000000ULL, 0x5FBDA76320A9B775ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x66916134110F7779ULL, 0x0000000000000000ULL, 0x0A7D9F20377BBD75ULL,
+    0x0000000000000000ULL, 0xE28F362C0D3E177DULL, 0x54035D316FC4177EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF961EE3A59CAD783ULL,
+    0x0000000000000000ULL, 0xEBEA80C835BA9785ULL, 0x551678F5B7864ED2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x8D361911378A2A44ULL, 0x9BF708061D00978BULL,
+    0x0000000000000000ULL, 0xB8577E16EC7DB78DULL, 0xE438BF3FF9A2778EULL, 0x847A7D8BBB83978FULL,
+    0x0000000000000000ULL, 0xDD67E407ED3CF791ULL, 0x8EF15B01E0967792ULL, 0x0000000000000000ULL,
+    0x39DE6816D794DE51ULL, 0x0000000000000000ULL, 0xB800DF70B79605B1ULL, 0x0000000000000000ULL,
+    0x790FC6A073DE9798ULL, 0x0000000000000000ULL, 0x44A7152E08C7B79AULL, 0x0000000000000000ULL,
+    0xE2E0E3039C6F379CULL, 0x0564352C341EF79DULL, 0x0000000000000000ULL, 0xAD9BA6D9B7A1D79FULL,
+    0xFE6C46A0CB5A97A0ULL, 0x8DD848CB97A1CEC9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xAC64AEA6432FB7A4ULL, 0x61A25DDB2A2A97A5ULL, 0x3FEB34F027B097A6ULL, 0xDF8BD541BF3E97A7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0463A476AE2A97AAULL, 0x0000000000000000ULL,
+    0x4658BDD4868AD7ACULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA720E058598D37AFULL,
+    0x0000000000000000ULL, 0xE356EF71645E97B1ULL, 0x0000000000000000ULL, 0xBE0CDC95B487F7B3ULL,
+    0x0B36CB544C58D7B4ULL, 0xCA36B58EA42B97B5ULL, 0x0000000000000000ULL, 0x0E09D285D7B7D403ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x889F8D5AFAB357BAULL, 0x0000000000000000ULL,
+    0x2E1DE2E80752F7BCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD8EC1FAAD7C38B68ULL,
+    0x0000000000000000ULL, 0xCBDC7BDF23FC77C5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB3688EB316C037C8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7FDE8835E1F357CBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0E793DE077CEC4D3ULL, 0x0000000000000000ULL,
+    0xD53BEF0C17D0F8EDULL, 0x44B8950C17D1F402ULL, 0x7E9EAB8BE67AD7D2ULL, 0xF657F4B4EA0F57D3ULL,
+    0x15C9F7B08CEE57D4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x737F2F3F5D3397D7ULL,
+    0x0000000000000000ULL, 0x954C97E1C065D7D9ULL, 0x4863F35D0A5637DAULL, 0x0795086F796C77DBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC5278AF017DFB5D1ULL,
+    0x0000000000000000ULL, 0x0C133B2BCA6497E1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xDAC891784AEA97E6ULL, 0xDEFE0DA754F6D7E7ULL,
+    0xE062844F17E81812ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x9B4207C757EBFCD0ULL,
+    0x0000000000000000ULL, 0x733D66C277EDB129ULL, 0xB4217729D7EECD31ULL, 0x3C7C90D6B9C8F7EFULL,
+    0x0000000000000000ULL, 0x80B79A9E278977F1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0E3CAB1897F45240ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB406D60CD35197F7ULL,
+    0x5384795DF7F85CD2ULL, 0x63925868DFAED7F9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE2621CB8D607B7FDULL, 0x837DD7EAA9F7B7FEULL, 0x0000000000000000ULL,
+    0x07AE92FA68B53800ULL, 0xEAA6B65114D8D801ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1A78ADA494DAF805ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x4975D6966E5FD808ULL, 0x1385CB9358094931ULL, 0x13D206D9827EF80AULL, 0x0000000000000000ULL,
+    0xCF28954AF80C2AA2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x3BE5345490B3B80FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA450FEEDD8127932ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4DAC87A2AECB7816ULL, 0x0000000000000000ULL,
+    0x2DB06B86F818395FULL, 0x0000000000000000ULL, 0x065BBCC7F527981AULL, 0x0000000000000000ULL,
+    0x66235B7CF244381CULL, 0x0000000000000000ULL, 0x9384806EE078D81EULL, 0x2F2F6E73B81FBE99ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD335B4E198225D80ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD353E2B996029825ULL, 0x237D1EBE981E9826ULL, 0xA102F1F23827C52FULL,
+    0xAAD01F4E73B5D828ULL, 0xF7EA54445D2E5829ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xAE6975AB782FBF50ULL,
+    0xF27BA04E1830F274ULL, 0x4E6186B407FCD831ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x01ACE83921E0F834ULL, 0x900C200538357727ULL, 0x5C57EBC05836737CULL, 0x0000000000000000ULL,
+    0x1C82F291A0221838ULL, 0xEA70AE49257D7839ULL, 0x0000000000000000ULL, 0x345CE867B452783BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x9F4CA098F83F57F1ULL,
+    0x27AE7E2FA24F9840ULL, 0x0000000000000000ULL, 0xAA4BE9FF653AD842ULL, 0xE6A1C86B9843C595ULL,
+    0x0000000000000000ULL, 0xCA5704DC86421845ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x82A6AD789D6C5849ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8C231DFC1C22F84CULL, 0x0000000000000000ULL, 0xA514756041AC984EULL, 0xE8A417DC1534784FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3E7D22A003B01852ULL, 0xB94CDEF03F507853ULL,
+    0xCD673B5EFCD31854ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xEB150587C1C0785CULL, 0x93F8F912DCB2D85DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x63DEF939786445BCULL, 0x0000000000000000ULL, 0x17355D55586624AEULL, 0xFCB042D6EDB1F867ULL,
+    0x6694E2D76B631868ULL, 0x5C086CED38690614ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC9CBA51F3E41B86EULL, 0x9420E7B1E1BF386FULL,
+    0x70F6EFD6D87016EAULL, 0x44DBB53B9871AC33ULL, 0xBB865667BA78D872ULL, 0xC8697F956D037873ULL,
+    0x0000000000000000ULL, 0x81BE1B2A78754CBAULL, 0x43B161BFD6791876ULL, 0x0000000000000000ULL,
+    0xC0EA4844F8783BC9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x5180D450587D5E66ULL, 0xCA0640EF904C587EULL, 0xA40236FB69A6B87FULL,
+    0x4F5FEC167E649880ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF2DC4AFFBD04F883ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA9E5750889325887ULL,
+    0xC6F8E9B118883F27ULL, 0xAA26EB9BF98F5889ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x948AE281DD52788DULL, 0xF57AAC47CF90988EULL, 0x416D47BDF88F43FEULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x04A9C441F6A51892ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD41E894BF896847FULL, 0x0000000000000000ULL,
+    0x642211A9736E3898ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x958AEDF84C7A989EULL, 0x0000000000000000ULL,
+    0x1C8CE261F694F8A0ULL, 0x0000000000000000ULL, 0x3060328EF8A2E309ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x248D92DAF8A54874ULL, 0xB77B0FCE942DB8A6ULL, 0x0000000000000000ULL,
+    0xE72F055178A8F1E9ULL, 0x0000000000000000ULL, 0xFFA2A442F8AAE7C5ULL, 0x0F97EFA7A23AF8ABULL,
+    0x0000000000000000ULL, 0xFF67DD4BC4F3F8ADULL, 0xFE42879DC13FF8AEULL, 0xECD66546F86398AFULL,
+    0x71DFA001404C18B0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB28CE1C90FF058B4ULL, 0x0000000000000000ULL, 0xD804CEFEB76218B6ULL, 0x568452B289F098B7ULL,
+    0xE30EBB29702578B8ULL, 0xA2284AF0E87618B9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x96F63E16489AF8BCULL, 0xD325B52BC05098BDULL, 0xB830D58B38BE001CULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1FB628EAE936D8C5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xF60DD0B8F8C878D1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6AA11778B8CB0752ULL,
+    0xE0AE5208BB6A78CCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xA60A14D568F5D8CFULL,
+    0x72CF3064EECFD8D0ULL, 0x122C1D5833F1D8D1ULL, 0x0000000000000000ULL, 0x8ECF2AEBD8D368E8ULL,
+    0xC06168118CA118D4ULL, 0x0000000000000000ULL, 0xC9FC13DB7AE2B8D6ULL, 0x853F2F946E5438D7ULL,
+    0x0000000000000000ULL, 0x81D7C183D77378D9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA7A6F4C3CA2438DEULL, 0x89D7752F723BD8DFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6BFA65F2D1D7B8E3ULL,
+    0x0000000000000000ULL, 0x4918B90C6731F8E5ULL, 0x0F420A6CA2F478E6ULL, 0x2780667A61EAF8E7ULL,
+    0x0858D803F8E8C17FULL, 0x0000000000000000ULL, 0x853C1874F8EA039CULL, 0xCE5E08E0F2F558EBULL,
+    0x0000000000000000ULL, 0x09BEB6D74B7898EDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB5BBBB93B8F02CDDULL, 0xFEEC35D1195A78F1ULL, 0x6CAF7FA3E3C018F2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7EBCC7CEEF3F18F7ULL,
+    0xC57250040F8878F8ULL, 0x0000000000000000ULL, 0x0E065CC9AA8A38FAULL, 0x2622CF4E39AC98FBULL,
+    0x9D1256E218FCEE01ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x2FBF7F6E39015634ULL, 0x2C435B83E3845902ULL, 0xFA7E1C751756D903ULL,
+    0xBF0FED0DEE45F904ULL, 0x9325E876E4573905ULL, 0x3030EFC99E997906ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x286E03685355190AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x13BB82D2B91079A4ULL, 0x814782FC131AD911ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xDEE9956BBEC7D914ULL, 0x11933ECC44899915ULL, 0x0000000000000000ULL, 0x281FA2E8F7CE1917ULL,
+    0x424AFB9DF918680EULL, 0x939CF4883748D919ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBD1EF660791C81C7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6E72760F28EF3921ULL, 0x0000000000000000ULL, 0x6F1705B39923563AULL,
+    0x92E5C7432F659924ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x13EE9274D097F928ULL, 0x0000000000000000ULL, 0x8D2903E845E5592AULL, 0x0000000000000000ULL,
+    0x4704740CF6F2F92CULL, 0x0000000000000000ULL, 0xB3BC029F487ED92EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC8424B545932C08BULL, 0x0000000000000000ULL,
+    0x3B7B016990541934ULL, 0x4BD8AC1CA1BF3935ULL, 0xCB0E5C904D039936ULL, 0x0000000000000000ULL,
+    0x13A5CBB2C68A5938ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE24EA93736E6193BULL,
+    0xD2A0896FF93CBA9CULL, 0xABF4F08E57B1193DULL, 0x6865EC14393EA3EDULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x30126B58F4271943ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2C4DE8B9D06C5946ULL, 0x98813CBB9E8E1947ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x4C8C4B45D433194AULL, 0xCFBDFB7B994B63EEULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7FC4D9340B2C194FULL,
+    0x0000000000000000ULL, 0x4FB1EDDC45731951ULL, 0xE56FE7A0547BF952ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xC36C20A810C47955ULL, 0x25B2B79D1956C3A5ULL, 0x0000000000000000ULL,
+    0x24C6B0AB6852D958ULL, 0xBAA3594AA5BDD959ULL, 0x05E7E6FD3951795AULL, 0x0000000000000000ULL,
+    0xF6E159BBEE99F95CULL, 0xE73DCB30FDACB95DULL, 0x391418DB8C51795EULL, 0x6A796B5C67F5595FULL,
+    0x5A26DA71A0BF1960ULL, 0x7B9D2F5ADF103961ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD2A85BAC37463964ULL, 0x0D2E4903F26E3965ULL, 0xE36CE1F84170D966ULL, 0x82AC213E39670E40ULL,
+    0x037B7E04E48FB968ULL, 0x969C7CD9E4D7F969ULL, 0x0000000000000000ULL, 0xED5F01B088A9796BULL,
+    0x0000000000000000ULL, 0x620B1AAF3FD1996DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x75425F3225F73970ULL, 0x4A27E2ECD9713BCFULL, 0x0000000000000000ULL, 0x297589EE99735904ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x5256700DDED95976ULL, 0x43FEA80097EFD977ULL,
+    0x0000000000000000ULL, 0x1A2C7224D57D3979ULL, 0x0000000000000000ULL, 0xD471844FEDD5597BULL,
+    0x9CD016732252797CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xCC8872D6197FD445ULL,
+    0xB563147E2A5E7980ULL, 0x5C969AA0C785F981ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9A19CC6F62371985ULL, 0x0000000000000000ULL, 0xF2DD8FCED5543987ULL,
+    0x0000000000000000ULL, 0x6015B114F364B989ULL, 0xAD7DC7068135998AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xBD65B18E1B5E598EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD6F4345AB2237991ULL, 0x0000000000000000ULL, 0xD2D3C3EC72E21993ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD5C98280D99681FCULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x135D039E6EC5D99BULL,
+    0x08499229D99C43F6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE5A3F1A905DEB9A1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5A08639AF75BB9A4ULL, 0x0000000000000000ULL, 0xBF111514A0E139A6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0A2757D5E8A9F9A9ULL, 0x0000000000000000ULL, 0x99660E96CFE179ABULL,
+    0x0000000000000000ULL, 0x4EA6BF48DC0E19ADULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD894F656A8CBD9B0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xE1B9EC5A98D479B3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x23B47A5F3F9ED9B6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xB3D506A6D743F9BCULL, 0x0000000000000000ULL, 0xE6189DDA56E359BEULL, 0x0000000000000000ULL,
+    0x010AB4C838D779C0ULL, 0xFA741372D9C18438ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD89BB278230979C9ULL, 0x0000000000000000ULL, 0x14C319A8886CF9CBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x162F7506626C19CFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x81FA7349C4A8B9D5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x9C74D0475A4599D9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xDFA86CD059DCBBE2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC15C3C6E1896F9E2ULL, 0xF845FE64E470F9E3ULL,
+    0x0000000000000000ULL, 0x5E09E1E09D9C19E5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xBA004E25D5F059ECULL, 0x0000000000000000ULL, 0x55A02C5B6D5B59EEULL, 0x0000000000000000ULL,
+    0x3662714CE15E99F0ULL, 0x0000000000000000ULL, 0x1C661B3E4467B9F2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x73DEE778B9F6B7D3ULL, 0x7477DC1D272A59F7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xFE11F30C5CDE79FCULL, 0x1416F62B1A8F99FDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCA9186E56A49DA01ULL, 0x4EA86F599F565A02ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1337BC6A8536FA05ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x6F572FD0C3CCBA08ULL, 0x0000000000000000ULL, 0x1334E6578EB6DA0AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD4B480FDE9227A0FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1DE1C965B5DF3A13ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x216E25EE957D5A17ULL,
+    0x0000000000000000ULL, 0x0E83DA81BCA71A19ULL, 0x0000000000000000ULL, 0xD80C5830FA1BE726ULL,
+    0xE2C5D9E8471BDA1CULL, 0x0000000000000000ULL, 0x303456969A1E3C32ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x21B9AD6ADA22ABA4ULL, 0x0000000000000000ULL,
+    0xE828D9AEB7BC5A24ULL, 0x0000000000000000ULL, 0x56F884968D6B9A26ULL, 0xB17C52B9251A5A27ULL,
+    0x0000000000000000ULL, 0x897E66F11A29729AULL, 0x0000000000000000ULL, 0x47F59D6AFBDC5A2BULL,
+    0x0000000000000000ULL, 0xE96FFF61091C5A2DULL, 0xDA98D1FEE04E5A2EULL, 0xC1E2B998FA2FCFEDULL,
+    0xBFBE7CCABA304AFFULL, 0x54BBE6B5BA31FEACULL, 0x0000000000000000ULL, 0x2E36074CBB13BA33ULL,
+    0xB49EFE1CC3A0FA34ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x377D3F2B25BABA3BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xBACD80619EE2DA3EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE7AE5C40BA41FA0FULL, 0xC302E7A9BC3DFA42ULL, 0x6D0BCD52FA434C29ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x3A5C04AFDA4D4BD5ULL, 0xA8A51CC13A4E0190ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x06AC2DB52F32FA51ULL, 0x31102F7F05A01A52ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x02F88A5B92AC5A59ULL, 0x732207D10B739A5AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x24E73875D1C19A5FULL,
+    0x0000000000000000ULL, 0x4CC1235E95325A61ULL, 0xA79C2EAD579CFA62ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA018A7E50ACB9A6AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x39059CEFAF141A6FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x375766DE7A727219ULL, 0x6D6F09864EA9FA73ULL,
+    0x1CAD33F48C2FDA74ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xED0B51030741DA78ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x72B7C7BF9A7CFAD0ULL, 0x0000000000000000ULL, 0xAAC6FB5A69185A7EULL, 0xC8CB196D0919DA7FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xFCE3BF3030F09A89ULL, 0xFC29E31F6FE51A8AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA02CCE1188253A8EULL, 0x8FF8E07ABA8F118BULL,
+    0x0000000000000000ULL, 0xFFC353B4010D1A91ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x62FD43C89A949C34ULL, 0x0000000000000000ULL, 0x95974D643EE27A96ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x99DCDB82BA99F971ULL, 0x1F7275C7A19FDA9AULL, 0x0000000000000000ULL,
+    0x4256A8822DA5DA9CULL, 0x0000000000000000ULL, 0x135E61B31A9EDE1CULL, 0x96A415524FCDBA9FULL,
+    0x8FDB112FB2315AA0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x99CB18B87AA49F79ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBB0370FE3AA7551FULL,
+    0x613C620A1AA88A34ULL, 0xA5E4F22C9378DAA9ULL, 0x7A409389FDEFDAAAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x45A4FDC08A97BAADULL, 0x0D299EF527BABAAEULL, 0xF3F46790EE093AAFULL,
+    0x0000000000000000ULL, 0xB84C2790AFB5DAB1ULL, 0x0000000000000000ULL, 0x0D6EE9395AB35C3BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA9A224B44F635AB6ULL, 0x3E457D631AB72F2DULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3EF56B7C7ABEF188ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC0C79C51B5C39AC3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2616960B0DFC7AC7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE2A675751ACA2A68ULL, 0x0000000000000000ULL,
+    0x343E92127ACC5F65ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBD799493FACF39E3ULL,
+    0xD423E81612213AD0ULL, 0x7F326AC5DA38BAD1ULL, 0xA58000E0FAD2F0A1ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x01375F13AFCE1AD5ULL, 0xFEA6133978813AD6ULL, 0xB31CAC0133E57AD7ULL,
+    0xD1CA488BCE8B7AD8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xCDDDA7B242525ADCULL, 0x5DBA6B0874803ADDULL, 0xF49638446CF59ADEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA071403362E4FAE1ULL, 0x736F5750596A5AE2ULL, 0x0000000000000000ULL,
+    0xC55EDF48A1255AE4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x42515AC904833AE7ULL,
+    0xB8B6E5BDC7ED7AE8ULL, 0x0000000000000000ULL, 0xD213DA72C030FAEAULL, 0x857A0FF9B0CE1AEBULL,
+    0x0000000000000000ULL, 0x15368C5702BD3AEDULL, 0x2FA5D7719A489AEEULL, 0x6A8D2ED27AEFB7B4ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC97683819C603AF4ULL, 0x0000000000000000ULL, 0x1FAD7C53E8A05AF6ULL, 0x6294CFE8E1BDDAF7ULL,
+    0xC17F96563AF8B355ULL, 0x9095E791689A1AF9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8D43D8CF94F5DAFCULL, 0x0000000000000000ULL, 0xC4CE9F4190BC7AFEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x18A4E57E5B0103D8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x200B63257B07FBD9ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xF97888BC7B0DE406ULL, 0xC64627790F0F9B0EULL, 0x0000000000000000ULL,
+    0x7A5D6A1E904B7B10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0FB5BA21B8F21B13ULL,
+    0xB3E6DFE2FA6CBB14ULL, 0x12CD2A70088A7B15ULL, 0x0000000000000000ULL, 0x1D85FBC588479B17ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1EBED1CDFB1B7E08ULL,
+    0x493CFA98A1F73B1CULL, 0x0000000000000000ULL, 0x67EF3E135B1EDF27ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD33EBA363A773B22ULL, 0x0000000000000000ULL,
+    0xE6ACFB55544A9B24ULL, 0x4B3D7E7633179B25ULL, 0x3CDD33731DBB7B26ULL, 0x0000000000000000ULL,
+    0xC11E5A0E0DD93B28ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB5A99CBB821C7B2DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x28052DC0192BDB31ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x99481C7D8AEC7B37ULL,
+    0x7ECCB0989A093B38ULL, 0xB8B0A68FFB39511FULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD29691B09F7DDB3DULL, 0x15A363543B3EC47FULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x88B21DC71E711B41ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x753B101EE7383B49ULL, 0x479E03EFA9B0BB4AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x9B4B9F628CBABB4EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x307199D09B907B51ULL, 0x9D4876625C57FB52ULL, 0x3A8220D0B30A1B53ULL,
+    0x41FA1A0D7B54AC67ULL, 0x123DCD7D55AF9B55ULL, 0xF14FF87B7E4E7B56ULL, 0x7DFCFE90716ABB57ULL,
+    0x81B9EB24E99EDB58ULL, 0x0000000000000000ULL, 0x3FF5293DD9ECDB5AULL, 0x65AFF7F2C3937B5BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1D42E0FE0BA03B5EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xAD0745339B614BC1ULL, 0x75F7EF4AFB62B902ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xF5DDE84224EBDB65ULL, 0x3935A1793B669F5AULL, 0xB6B02427D7969B67ULL,
+    0x0000000000000000ULL, 0xE12C5854FBD39B69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA43BEC4D25413B6CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x22681962A4819B70ULL, 0xBD9C79DA1B717F41ULL, 0x35EB8B8B6E279B72ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x9FCE9F1F1B77E4A9ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x490216E9FB7D3B3DULL, 0x0000000000000000ULL, 0x0DA24A928815DB7FULL,
+    0x0000000000000000ULL, 0x11F29DC1E9683B81ULL, 0x0000000000000000ULL, 0xB254D28F17711B83ULL,
+    0xC51E1FBDF220BB84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5E9CCE7A1195BB87ULL,
+    0x0000000000000000ULL, 0x82191C56B6A39B89ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD3E5991E9B8D8EC9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB455432397CE3B91ULL, 0x0000000000000000ULL, 0x22D5C1870039DB93ULL,
+    0x5113DE7B03B77B94ULL, 0xC9E7E43AB33E5B95ULL, 0x67E2CD268E389B96ULL, 0xA9F34215144EBB97ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5108CAB072CC7BA0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA45B7DFBAFE25BA5ULL, 0x9B7B791C3F321BA6ULL, 0x0000000000000000ULL,
+    0x650FEC11EEDAFBA8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0A40D266DE5BDBADULL, 0xEB34A8168E9A9BAEULL, 0x970D6A8D22D37BAFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1C031F96FFD87BB2ULL, 0x0000000000000000ULL,
+    0x255549123BB48A17ULL, 0x0000000000000000ULL, 0x5E3C4B2C6E909BB6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x45096AD0537AFBB9ULL, 0x3E078BA3DBBAA484ULL, 0x0000000000000000ULL,
+    0x8E78DB68EA933BBCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x590CC397BBBFA860ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x31BEB2E19BC3F2F0ULL,
+    0xB9C2501F57137BC4ULL, 0xB1437D058C461BC5ULL, 0x6EA9870E4FFADBC6ULL, 0xFBFC01955FB47BC7ULL,
+    0x293683DFAFC8FBC8ULL, 0xD2C9F1816B16FBC9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xE6C2FABC094D5BCCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7082DDA5B0601BCFULL,
+    0x0000000000000000ULL, 0x4C416FF99DE1BBD1ULL, 0x0000000000000000ULL, 0x343877A63BD36F98ULL,
+    0xE200AE044E849BD4ULL, 0xC0B7A368E495DBD5ULL, 0x6FA1F6FE59CA1BD6ULL, 0x30CC4BA2E437FBD7ULL,
+    0x88A6493C3BD8F4F8ULL, 0xC49BBD5A6E255BD9ULL, 0x26ED611CCEBF1BDAULL, 0x0000000000000000ULL,
+    0x8D5D6D75CDE09BDCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x7F4A81C07BE01889ULL, 0x1B85F29788F99BE1ULL, 0x09B776456AB15BE2ULL, 0x43D61A2DF55F9BE3ULL,
+    0x0000000000000000ULL, 0xF18F7A3165211BE5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x06AA96865BE8D86EULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD0576D938D063BEBULL,
+    0xC9F5FE3718919BECULL, 0x0000000000000000ULL, 0x56D21FD403541BEEULL, 0xE0ED87A61BEF6EA7ULL,
+    0xB1C8604D7354BBF0ULL, 0x2709DAC4DA929BF1ULL, 0xD3C7D290C0B53BF2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x404A2EE9A6AEFBF8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x478C069BA22CFBFBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x36F136D419F7FBFEULL, 0x19FE7093B9061BFFULL,
+    0x390ADF0D11F35C00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF84A9A09D247FC03ULL,
+    0x0000000000000000ULL, 0x8255E543CCEEDC05ULL, 0xCC419134B01C5C06ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8E3D9C613A5A1C0BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0AE7FB19BDCCBC0EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x14F1C8C5D08C5C11ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA4B9B0BE6DA79C16ULL, 0x93885C85FC17D323ULL,
+    0xB2945182DC183831ULL, 0xD1FC39378CC25C19ULL, 0x69405082E190FC1AULL, 0x0000000000000000ULL,
+    0xC4E9CFC07B4C1C1CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x134DB7DEDC1F92E1ULL,
+    0x0000000000000000ULL, 0xE0DA36F4BC21A75CULL, 0x666B082D2C5E9C22ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x886A635ABC27AE7AULL,
+    0xD7A590187B459C28ULL, 0x7AA9D9AA0B8E1C29ULL, 0x81A5B73EA3931C2AULL, 0x99D4568E84495C2BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1213A43FB94D3C2EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x59384DA39C32FD0CULL, 0xA7D0A343F6983C33ULL,
+    0x8E23951C1C34C9EAULL, 0xE5E9E4E6FC35FC77ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xE2CF31AC45DB5C38ULL, 0xDB0AE2926CC7DC39ULL, 0x90E540995C3AFDB0ULL, 0x037BCD987C3BD26CULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x32F231F888D7FC3FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x584487321C423378ULL, 0x12857EB980BE5C43ULL,
+    0x6137194747DB5C44ULL, 0x6F0504805C4518E3ULL, 0x07F609FDD1B89C46ULL, 0x1F63031D01CCFC47ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xFDA853C0AE99FC4BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x79700C9D7C510A86ULL, 0x0000000000000000ULL, 0x2CE6AD060A6EFC53ULL,
+    0x73BA5F22E1E3DC54ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xEE604989BC570D8EULL,
+    0x9C06C262FC5808B7ULL, 0xD9AE59FD1A6FDC59ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xEBFFDCEEDC5E9184ULL, 0x1143A2D36123FC5FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x8990B9921C62DB8DULL, 0x0000000000000000ULL,
+    0x20360B947C64D56FULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6F5303F3DA193C69ULL, 0xDEA1EE8A3C6AB63FULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x44A1E0A9DC6D6CF6ULL, 0x507BCD70F26D1C6EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x8B777728DC71E09FULL, 0x6DB795D21C293C72ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBF0463B34E959C75ULL, 0x0000000000000000ULL, 0xC6B2F2A19C77C847ULL,
+    0xC479B12DFC781191ULL, 0x162EE7CD29507C79ULL, 0xE6C949E2F3FD5C7AULL, 0x9643A2D21EA8BC7BULL,
+    0x37EC302ECFEDFC7CULL, 0x0978F599121EDC7DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8F346B15F18DFC84ULL, 0x78E6260A1F677C85ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x9794A62A4A29BC88ULL, 0x86E6CC283C894E4EULL, 0x29B0AC3E366FBC8AULL, 0x0000000000000000ULL,
+    0x0E7B24D690E31C8CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB5921D83FF453C8FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xC187F20ADC9430D7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6F44680E0AA27C97ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3A73EFCDB8493C9AULL, 0x507237B85C9BCA10ULL,
+    0x0000000000000000ULL, 0x1FBE708D85DA5C9DULL, 0xA9A2CAF337F3DC9EULL, 0xC25E4BB5003D9C9FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x277420617CA60AA4ULL, 0x6B78F08B30C9FCA7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE492543391ECFCADULL, 0xAFF5C667E15BFCAEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x01E333BD9CB6E306ULL, 0x55515FAE7D227CB7ULL,
+    0x0000000000000000ULL, 0x5CC49088DCB94EBAULL, 0x4750304C7CBA3968ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA355E4DEFCE6FCC2ULL, 0x8A676819DFB9DCC3ULL,
+    0x31D72F649CC4ABA7ULL, 0x0000000000000000ULL, 0x3C0BEFFC7CC6DE76ULL, 0xEFB0DEDFF2F17CC7ULL,
+    0x0000000000000000ULL, 0x4EA94660C50EDCC9ULL, 0x4F56CAC8BC0C9CCAULL, 0x7D55C1ED32EF9CCBULL,
+    0x0000000000000000ULL, 0x16DF0D4505331CCDULL, 0x90B2B71E2C027CCEULL, 0x0000000000000000ULL,
+    0x5E7497947C57DCD0ULL, 0x8153739B5CD14366ULL, 0xAEFBDC80B54EDCD2ULL, 0x0000000000000000ULL,
+    0xEB773BA1BCD412FDULL, 0xB9B29EB3118E7CD5ULL, 0xB47CB1AEF4337CD6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6D72648BA707BCD9ULL, 0x109B1E327CDA9D74ULL, 0xE96E5A3FCDD8DCDBULL,
+    0x0000000000000000ULL, 0x2591C8B3616F7CDDULL, 0x0000000000000000ULL, 0xF93D3C8F34AB9CDFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x636C0B64758D3CE2ULL, 0xD8B8399D23183CE3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6E542E051CE7ACACULL,
+    0x0000000000000000ULL, 0x73FBB64C3B5B3CE9ULL, 0xB2A569B41CEAD8E8ULL, 0x0000000000000000ULL,
+    0x252D008A3CECA987ULL, 0x0000000000000000ULL, 0xE4D624927CEEEEEBULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC4F50FCD9CF3C02EULL,
+    0x0C383DC1FCF49724ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x8857FEA6BDFFBCF9ULL, 0x406847597A0DBCFAULL, 0x0000000000000000ULL,
+    0x5AD156D741F95CFCULL, 0xB0FE43A951F73CFDULL, 0xC1080781E966BCFEULL, 0x0850E43B24821CFFULL,
+    0x4CFE0FC8FD009B62ULL, 0xA237790BDD0181D2ULL, 0xBDF70C97B00C1D02ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE07BCAB748C8BD05ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA9D13B2136683D0AULL, 0x0000000000000000ULL,
+    0x37763A8F8F5F9D0CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA94D0A4A05789D11ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x49D37C1785759D16ULL, 0x5FF6A7593D17ED4BULL,
+    0x0000000000000000ULL, 0xE352329ABD19E410ULL, 0xF2FD4096BF5AFD1AULL, 0x0CE0E0E1489B3D1BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xE1A86017CDBE1D29ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x85E7965AE79C3D2DULL, 0x5AA935838B123D2EULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3B00AC1A0B5FDD32ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3BD9E2053D36254AULL, 0x898F35941E399D37ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xBB32EB61AC39FD3AULL, 0x36675A56CBB87D3BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x77B374A72338FD3FULL,
+    0x0000000000000000ULL, 0x1E9C3FA1834EBD41ULL, 0x18D9CCDF1548FD42ULL, 0x0000000000000000ULL,
+    0x2DB3BED59EF09D44ULL, 0xCE1F16BF3D454EE1ULL, 0x0000000000000000ULL, 0x6508BBD154CD1D47ULL,
+    0x97DA3CEA94C63D48ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8F5AF20D09D73D4BULL,
+    0x9B6345CFFD4CD95AULL, 0xEA8655FFD940DD4DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x9BA041C506FE9D50ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x32909F063601BD53ULL,
+    0xB4356F1DD601DD54ULL, 0xEF4EFE925D55BC9BULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA1790F3FC83E3D58ULL, 0x0000000000000000ULL, 0x36FEDD894A015D5AULL, 0xF7BBEE7D0D4ABD5BULL,
+    0x30A6C705AA7FFD5CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDD2913317FD09D5FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xBBAC76C1151E3D63ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xFBCF5C4E147CDD66ULL, 0x0000000000000000ULL,
+    0xA36941A008F57D68ULL, 0x0000000000000000ULL, 0x49F6D66984C8FD6AULL, 0xBAE26F296F991D6BULL,
+    0x0000000000000000ULL, 0x1266999A89F57D6DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1BE7815CDDA89D72ULL, 0x0000000000000000ULL,
+    0x2B6284077A7DFD74ULL, 0x9A8B7AC13323DD75ULL, 0x0000000000000000ULL, 0x5D8FB50286551D77ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6BE499124D8F7D7BULL,
+    0x277EB9059980FD7CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xF8E3CCDF23245D7FULL,
+    0x6E49467E9D80C599ULL, 0x19B3D3F65351DD81ULL, 0x9D88077149EBDD82ULL, 0x826A2AB2F360DD83ULL,
+    0xAE98C4A54C06FD84ULL, 0x0000000000000000ULL, 0x0F0BC32A2DD1BD86ULL, 0x0000000000000000ULL,
+    0x0C7F15F593F45D88ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xBE07BCB4BD8DF9D9ULL, 0x0000000000000000ULL, 0xD0A1C1EE1D8FA52CULL,
+    0x039414C41D909825ULL, 0x87BB9CF0C234BD91ULL, 0x0000000000000000ULL, 0xBCFC8300C32B9D93ULL,
+    0x0000000000000000ULL, 0x2E6609B31EDB5D95ULL, 0x6BE9729E4F965D96ULL, 0x18F36A32EB2ADD97ULL,
+    0x0000000000000000ULL, 0xABC6FB3E88E0FD99ULL, 0x8312C2260F87FD9AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2475F1BD7D9EEFEBULL, 0x10D97F1EAAE77D9FULL,
+    0x0000000000000000ULL, 0x5A4E4F42CA6D9DA1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x6DCE6B47BDA520B0ULL, 0xDB74AC4DDDA6C2FAULL, 0x0000000000000000ULL,
+    0x8DFC281FAD1F7DA8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x9A2E3183AA1DFDABULL,
+    0x0000000000000000ULL, 0x511DAFFB9DAD635DULL, 0xBF8F9C1E5DAE8BCBULL, 0xDC8BD143FDAF531FULL,
+    0xAA4D298EDDB0A1E1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xA616765C0FF25DB6ULL, 0x0000000000000000ULL,
+    0x3B0C3DE2B7623DB8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2C21EDD84522FDBBULL,
+    0x594DB2F4D006BDBCULL, 0x2B5AE389FCE6BDBDULL, 0xC76DDE89FDF61DBEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC89F3F5AFDC26DF4ULL, 0x6D1FD0FD817B7DC3ULL,
+    0x6A37AFC1824F9DC4ULL, 0x0000000000000000ULL, 0xFC1AAD338C6FBDC6ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xC667C7A4C2D3FDC9ULL, 0x894514939C03FDCAULL, 0x0000000000000000ULL,
+    0xA28A5D55D59D9DCCULL, 0x2112E1C8B5D95DCDULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5FEC4C10580ABDD0ULL, 0xA735E3CA165F1DD1ULL, 0xE24E2B9A5DD2C2DEULL, 0xAE2365A460559DD3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xA7057DD9ECCD7DD8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x650FDBAAA5333DDBULL,
+    0x0000000000000000ULL, 0x6E87D3A5C6097DDDULL, 0xA7FF16523DDEE0C0ULL, 0x15E76FD1651C7DDFULL,
+    0xCE1EA4EC3DAD3DE0ULL, 0x0000000000000000ULL, 0x96B79993FDE292ACULL, 0x94E0CA9E74089DE3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xF6C02C33AD745DE9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x52DA43644F48DDF4ULL, 0x773F754C4AA8DDF5ULL, 0x5EED0F225C32BDF6ULL, 0x395A869897F29DF7ULL,
+    0x4D7EA73F5DF86B2CULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3ABE696567215DFCULL, 0x0000000000000000ULL, 0xE87F90391DFEC513ULL, 0xA2E3517A9DFFF864ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xC950BDAA556EBE02ULL, 0xABBC82EEBA2E7E03ULL,
+    0x378C21815E04E773ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x06B7D6FD3BD31E08ULL, 0x0000000000000000ULL, 0xAD04C4478BA6BE0AULL, 0x2B71C02C0B46DE0BULL,
+    0x0000000000000000ULL, 0x5CE8F39D2BA6FE0DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xD37197A15E152676ULL, 0x0AE9C929A956BE16ULL, 0x6634069E676D3E17ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5C5ADD785E1C1F8FULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2FC3EF351AD99E1FULL,
+    0x297C870C0E8AFE20ULL, 0x0000000000000000ULL, 0x6375CF784D017E22ULL, 0x95E66DF2DE23B184ULL,
+    0x0000000000000000ULL, 0x08FBFEEDBDE0BE25ULL, 0x0000000000000000ULL, 0x09D36189EB7CFE27ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x5BF2F90B9D3BBE2AULL, 0x6DBA5BE601A09E2BULL,
+    0x72F582299E2C8705ULL, 0x0000000000000000ULL, 0xB690353CFBF5BE2EULL, 0x9A660FFDB0D3FE2FULL,
+    0x5AC0C98535733E30ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xC709D4DE659E5E33ULL,
+    0x50090191AF349E34ULL, 0x0000000000000000ULL, 0xC21C1A6C3E366608ULL, 0x640A68293E37987FULL,
+    0x0D3C0C263E389AE7ULL, 0xDB8CAD366417FE39ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB3B2C803F1AD3E41ULL, 0x88068669F9FE5E42ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4028CF9EE4A59E47ULL,
+    0x0000000000000000ULL, 0x9009E5898AA9FE49ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xEC7EA3251E4D322DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x86A17E4000151E50ULL, 0x4179F9B45E51531FULL, 0x6FB448ED5E52A182ULL, 0x0000000000000000ULL,
+    0x26648651E9CD5E54ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x82CC37A15E59BF0BULL, 0x1120319EFE5AB173ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0D5563D059539E5EULL, 0x1FBC48B6EDFB9E5FULL,
+    0x0000000000000000ULL, 0xA8047DF6A1AE3E61ULL, 0x0000000000000000ULL, 0xE994A22777B2BE63ULL,
+    0x0000000000000000ULL, 0x0F42DD905E65DE76ULL, 0x98EB60433AC4FE66ULL, 0x0796531BBE6727CBULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2C4ED40431531E6AULL, 0x2E879D7DA41C3E6BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x513B6AF6C73E9E71ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x8D3F612259555E74ULL, 0x2EA17B595867BE75ULL, 0xA35D10DF3CC53E76ULL, 0x0000000000000000ULL,
+    0xBC970D3CE5FE5E78ULL, 0xF20A2557C8C03E79ULL, 0x0000000000000000ULL, 0xFB0B2CE91724DE7BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xD0ECD748EB853E7FULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB02794A1A84ADE83ULL,
+    0x82B312C01CC51E84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x9C3C46FE5E870EACULL,
+    0xF36DBE076AEFDE88ULL, 0xF070F7EE1E89881FULL, 0x0000000000000000ULL, 0x9A636B082C443E8BULL,
+    0x0EBA6E1B1E8C918DULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xCE7B34E1FE918405ULL, 0x17FAB01CD0FD3E92ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xEFEF1B7B42CF7E95ULL, 0x0000000000000000ULL, 0x0BB887B877BB7E97ULL,
+    0x0000000000000000ULL, 0x33B524E062FA7E99ULL, 0x9828CD25F4191E9AULL, 0x24F180827E9B627AULL,
+    0x0000000000000000ULL, 0xE0761B08D853BE9DULL, 0x0000000000000000ULL, 0xC3646CDB7E9F62C4ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x16F91C09FB895EA3ULL,
+    0x0000000000000000ULL, 0x6E4A7913BEA50AB6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x5197B28A6AC3DEA8ULL, 0x0000000000000000ULL, 0x45639B54C0DC9EAAULL, 0x3E514165BEAB8077ULL,
+    0x153F65941D2D7EACULL, 0x0000000000000000ULL, 0x7EC7D1B3FEAE9CD6ULL, 0x0000000000000000ULL,
+    0x23DE93FD02A51EB0ULL, 0x3BEDDF59C83EBEB1ULL, 0xC43EAECE393EFEB2ULL, 0x0000000000000000ULL,
+    0xB5A09C98EBB33EB4ULL, 0xA8EC2F45FEB581BEULL, 0x0000000000000000ULL, 0x33FE0889CCFFDEB7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x95E7A41DE7885EBAULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1433F91A0B4FBEC0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xDEB651ED45621EC3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x193443CB0105DEC8ULL, 0x8FD8BBE341117EC9ULL, 0x107605A8DECA62B3ULL, 0x72D681E98C1FBECBULL,
+    0x3E4D0CE834251ECCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x76BB45F3164F1ECFULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x65821967CEFE7ED2ULL, 0xFF69DA6AF0F03ED3ULL,
+    0x88C9FF54DED4819BULL, 0xF92F6FED0F023ED5ULL, 0x69E9A00A9ED6D77DULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xFFFC5707DEDA8543ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x38DEBD1EC6331EDEULL, 0x7ACF69B69E59DEDFULL,
+    0x0000000000000000ULL, 0x665632A494D25EE1ULL, 0x2FA34103FEE2C728ULL, 0x0000000000000000ULL,
+    0x3B99086E7EE49434ULL, 0xDB69480CF807FEE5ULL, 0xF4EBCB074F3A1EE6ULL, 0xA871C0251EE7D4E0ULL,
+    0x0000000000000000ULL, 0xCAB8400038D71EE9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x04BEBE0654A13EEDULL, 0x0000000000000000ULL, 0x57121E8B9EEF6F7EULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x718B4CA5FEF84973ULL, 0xF5BEC237FEF90A48ULL, 0x3BB942E050671EFAULL, 0xD29082852B159EFBULL,
+    0x09FC3DAEAF437EFCULL, 0x0000000000000000ULL, 0xD7B9635627319EFEULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xB4C9E945B4B8BF01ULL, 0xA7BDD2E0958B1F02ULL, 0xA7B23EF83F033421ULL,
+    0x0000000000000000ULL, 0xF8E7A25B1F05D8F8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x6CFBA3C52EF51F0AULL, 0xCB0E416A65CCDF0BULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x93019996FF0FE42FULL,
+    0xAA17BB312F121F10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB8E5ED967F162DD8ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7BDB6B4324CE5F1AULL, 0x608906971F1BBD16ULL,
+    0x0000000000000000ULL, 0xF6EB7BD05B551F1DULL, 0x0000000000000000ULL, 0x92C7FCECDA66DF1FULL,
+    0x0000000000000000ULL, 0x542DD79C140FDF21ULL, 0x68C29E8FD2181F22ULL, 0x0000000000000000ULL,
+    0x9223D3B1A4399F24ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x619890741F278901ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0263EE0E04BD9F2AULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xA505987B1F2D962AULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x9DF3B823B4225F30ULL, 0x0000000000000000ULL, 0x5203220FBF327D45ULL, 0x2288C2D4A0A91F33ULL,
+    0x26A843FCECA1DF34ULL, 0x0000000000000000ULL, 0x76C19D9E0725DF36ULL, 0x30172E3B017FDF37ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x3135B71AA6EADF3BULL,
+    0xEE7F0F391BBC1F3CULL, 0x1853C998383C7F3DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x7319C7451F41CA66ULL, 0x708719FB1F42BA22ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xD370C2DC58983F48ULL, 0x8C89EEA15F49D6E3ULL, 0x0000000000000000ULL, 0x4E1E051D2E887F4BULL,
+    0x50179D8801409F4CULL, 0x5FD4849A1F4DB248ULL, 0x2D488619BF4E8E96ULL, 0x0000000000000000ULL,
+    0xE6D960089F5000D3ULL, 0x0000000000000000ULL, 0xC8076F1A7FBA7F52ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x39B85028DF555272ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x18D6DC5A1F58AD26ULL, 0xE93EE5AC7F593393ULL, 0xE90570748F5FFF5AULL, 0x0000000000000000ULL,
+    0x2650089D90233F5CULL, 0x14FD17D63A979F5DULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xE6F6808E9F62E1EBULL, 0x376141381B1EBF63ULL,
+    0x0000000000000000ULL, 0xF8C8297B9F6510F0ULL, 0x7BD40DE940CCDF66ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7CC450761F6B518DULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3A69C8066A27FF6EULL, 0x0000000000000000ULL,
+    0x5897B21A5F70D71AULL, 0x0000000000000000ULL, 0x53BA438651B39F72ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xD9E4F7FA74C0BF76ULL, 0xCD5CFDFB7FBF9F77ULL,
+    0x85458B0248329F78ULL, 0x5A47B063DF795405ULL, 0x0000000000000000ULL, 0x2F69347399D49F7BULL,
+    0x0000000000000000ULL, 0xA16AE3759DC09F7DULL, 0x0000000000000000ULL, 0x4A51443EF5907F7FULL,
+    0x0000000000000000ULL, 0xEFCB9CFBD750DF81ULL, 0x8D383F7D7F825F66ULL, 0x0000000000000000ULL,
+    0x5492CE4E9E3E9F84ULL, 0x7DAE74651F854859ULL, 0x2C278EAC56BB7F86ULL, 0x0000000000000000ULL,
+    0xEDF04F3777703F88ULL, 0xCB49EFB403B9FF89ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x2AB4ED642995FF8EULL, 0x01E611257F8F5B96ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x23A49A185A45DF92ULL, 0x0000000000000000ULL,
+    0xD703FD286AA11F94ULL, 0x0000000000000000ULL, 0xA233DA9EDFE2FF96ULL, 0xC3965E876483BF97ULL,
+    0x0000000000000000ULL, 0x36C60333FF996B34ULL, 0x0000000000000000ULL, 0xD3DE82C25F9B38D4ULL,
+    0x0000000000000000ULL, 0xD92F8C467F9D40EEULL, 0xF44A91C212F53F9EULL, 0x97EA1549ABCB9F9FULL,
+    0xCA75BB618AEABFA0ULL, 0x2C2AC7FA1FA1D95AULL, 0x0000000000000000ULL, 0xF710358A87ABDFA3ULL,
+    0x0000000000000000ULL, 0xB364D5F9B426BFA5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x684313458CE29FA8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xEFC7B80BB8585FB2ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xB9788AAE99F5DFB7ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x27F60D8290C07FBAULL, 0x0000000000000000ULL,
+    0x7CA397FDFA70BFBCULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7ADFD822AA09BFC3ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xB0EABDF8DECFFFC6ULL, 0x79A3E371BFC73808ULL,
+    0x0000000000000000ULL, 0xD770E5E7C4E81FC9ULL, 0x0000000000000000ULL, 0xA48E2CCA0B221FCBULL,
+    0x0000000000000000ULL, 0xFBD54A9C1D06BFCDULL, 0x03B4001BDFCE7869ULL, 0xEBB537FEC2CFFFCFULL,
+    0x0000000000000000ULL, 0xF53A92EE1FD1CE8AULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2A147320BFDB3A74ULL,
+    0x1106B3CCFA717FDCULL, 0x63EDB91A5FDDD873ULL, 0x0000000000000000ULL, 0x7233E6368A3EBFDFULL,
+    0x0000000000000000ULL, 0xD0EF819AAA3A9FE1ULL, 0xABB3DA3366863FE2ULL, 0x183700A452BB3FE3ULL,
+    0x0000000000000000ULL, 0x30D7632E7FE5804AULL, 0x7863E02E3FE605E4ULL, 0x0000000000000000ULL,
+    0x42A05334D1987FE8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xDFEC2EBE466FBFECULL, 0xAF2B4F25214DBFEDULL, 0x0000000000000000ULL, 0x45C6EAF4FF55BFEFULL,
+    0x5CE4AC481039BFF0ULL, 0x0000000000000000ULL, 0xBAF4D2FAE23F3FF2ULL, 0x8A105F6BD7575FF3ULL,
+    0x1538CB1DDFF49390ULL, 0x0000000000000000ULL, 0x233C7114CA28DFF6ULL, 0x0000000000000000ULL,
+    0x0FFBC5F0B4F57FF8ULL, 0x0000000000000000ULL, 0xCF1DAF001FFA7FEFULL, 0x64D15DF5CBA13FFBULL,
+    0x0000000000000000ULL, 0x9DF8AEC440389FFDULL, 0x0000000000000000ULL, 0x0000000000000000ULL};
+
+static const uint16_t PROGMEM CUCKOO_MOVES[CUCKOO_TABLE_SIZE] = {
+    0x104B, 0xB0CC, 0x0000, 0x0000, 0x2C7A, 0x0000, 0x0000, 0x3AEC, 0x0000, 0x35BE, 0x8B3A, 0x9BFF, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA412, 0x0000, 0x83F9, 0x9862, 0x0000, 0x0000, 0x8422, 0x3A30, 0x379F, 0xAAF3, 0x0000, 0x0000, 0x43DD, 0x0000, 0x0000, 0x0000,
+    0x3457, 0x0000, 0x0000, 0x94AA, 0x0000, 0xBB35, 0x0000, 0x0000, 0x0000, 0x84A0, 0x510C, 0x0000, 0x430E, 0x2161, 0x5F7E, 0x0000,
+    0x56E4, 0xA434, 0x8291, 0x44E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA005, 0x0000, 0xA56A, 0xBB2D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2B74, 0xBDBD, 0x965B, 0x9010, 0x4430, 0x0000, 0x0000, 0xAC38, 0x0000, 0x5CBB, 0x0000, 0x0000, 0x0000, 0x0000, 0x12D5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x44BA, 0x0000, 0x18F4, 0x0000, 0x0000, 0x18AC, 0x0000, 0x0000,
+    0x0000, 0xB51B, 0x4334, 0x0000, 0x8723, 0x0000, 0x0000, 0x0000, 0xBCF4, 0x176E, 0x0000, 0x3134, 0x0000, 0x0000, 0x0000, 0x44DC,
+    0x0000, 0x53D7, 0x0000, 0xB8AA, 0xA660, 0x0000, 0x3F7E, 0xA6DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9534, 0x7B77, 0x0000,
+    0x2529, 0x0000, 0x0000, 0x0000, 0x810D, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BBD, 0x1935, 0x9A29, 0xBD7D, 0x0000, 0x24E5, 0xA8A6,
+    0x0000, 0x0000, 0x2AB1, 0xB556, 0x0000, 0x0000, 0x0000, 0x0000, 0x5828, 0x0000, 0x0000, 0x2731, 0x28B4, 0x4009, 0x0000, 0x9BAF,
+    0x98AA, 0x99A7, 0x30C5, 0x0000, 0x4370, 0x0000, 0x518D, 0x0000, 0x4A6F, 0x0000, 0x30E3, 0x3314, 0x4042, 0x0000, 0x98E6, 0x76AB,
+    0xB396, 0x0000, 0x9C36, 0x45E5, 0x0000, 0x0000, 0x47A7, 0x0000, 0x0000, 0xA4F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x46E3, 0x0000, 0x408A, 0x0000, 0x9A6A, 0x0000, 0x9830, 0x4823, 0x3A2E, 0x0000, 0x26BE, 0x862A, 0x4AED, 0x0000, 0x0000, 0x0000,
+    0xA298, 0x0000, 0x0000, 0xA397, 0x0000, 0x0000, 0xA79F, 0x0000, 0x0000, 0x33FF, 0x1394, 0x0000, 0x0000, 0x214C, 0x0000, 0xB3D6,
+    0x21D5, 0x3866, 0x0000, 0xA7AE, 0x46A8, 0x9238, 0x22DD, 0x0000, 0x0000, 0x43F7, 0x3925, 0x0000, 0x0000, 0x0000, 0x9AAF, 0x0000,
+    0x92BA, 0xA314, 0x9620, 0x0000, 0x0000, 0x0000, 0x4772, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD7E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3A2F, 0x4515, 0xA496, 0x0000, 0x85FA, 0x0000, 0xAE7F, 0x0000, 0x9411, 0x3196, 0x0000, 0x92CD,
+    0x0000, 0x0000, 0x0000, 0x1AB4, 0xA5EC, 0x0000, 0x1154, 0x0000, 0x924A, 0x0000, 0x20D5, 0x0000, 0x40A6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA430, 0x0000, 0xA93F, 0xB04A, 0x0000, 0x4328, 0x0000, 0x0000, 0x8A70, 0x15E6, 0x0000, 0x477D, 0xB7E7,
+    0x0000, 0xA731, 0x0000, 0x0000, 0x0000, 0x331C, 0x0000, 0x0000, 0x0000, 0xACFB, 0x43A3, 0x36A2, 0x0000, 0x91F7, 0x262A, 0x30EB,
+    0x0000, 0x0000, 0x0000, 0x40D8, 0x9EFC, 0x0000, 0xB2D3, 0xAE7A, 0x0000, 0x16A0, 0x3469, 0x0000, 0xA124, 0x44D5, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x46BA, 0xAB7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x33A6, 0x4975, 0x3C75, 0x9866, 0x0000,
+    0x4496, 0x451D, 0x0000, 0x93AE, 0x0000, 0xA08B, 0x0000, 0x0000, 0x0000, 0x0000, 0x4250, 0x0000, 0x0000, 0x3D7D, 0x42F3, 0x0000,
+    0x0000, 0x0000, 0x5B33, 0x0000, 0x7BBF, 0x5619, 0xA3DF, 0x0000, 0x0000, 0x0000, 0x5251, 0xA153, 0x0000, 0x0000, 0x0000, 0x9B6F,
+    0x0000, 0xBC7A, 0x928C, 0x0000, 0x4E3B, 0x4B6F, 0x0000, 0x40D1, 0xA72A, 0x2298, 0x0000, 0x424D, 0x3334, 0x3292, 0x745B, 0x0000,
+    0xA2E3, 0x0000, 0x9471, 0x0000, 0xA6B5, 0xA20C, 0x0000, 0x0000, 0x94BA, 0x0000, 0x40DE, 0x91FF, 0x0000, 0x4A7B, 0x0000, 0x43AE,
+    0x0000, 0xAF3E, 0x330D, 0x3620, 0x96AA, 0x0000, 0x0000, 0xABB6, 0x0000, 0x0000, 0xAA3A, 0x920B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x93D7, 0x0000, 0x4030, 0x808B, 0x0000, 0x86A1, 0x29EE, 0x0000, 0xA51C, 0x46E2, 0x9765, 0x0000, 0x0000, 0x0000, 0x10CD, 0x8B35,
+    0x0000, 0x0000, 0x0000, 0x3862, 0x0000, 0x0000, 0x0000, 0x465C, 0x48F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x339E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA479, 0x0000, 0x0000, 0x0000, 0x431A, 0x0000, 0x41FF, 0x2829, 0xA832, 0x3AAC, 0x3046, 0x4161, 0x0000, 0x0000,
+    0xA671, 0x9DB7, 0x434F, 0x0000, 0x0000, 0x0000, 0xBAF2, 0x1767, 0xA29A, 0x0000, 0x530D, 0xA155, 0x9966, 0x2AF2, 0x0000, 0xA93C,
+    0x0000, 0xA63C, 0x0000, 0x0000, 0x8354, 0x0000, 0x0000, 0x2563, 0x9455, 0x10D4, 0x4AB2, 0xA862, 0x9CF4, 0x0000, 0x0000, 0x0000,
+    0x27E6, 0x0000, 0x0000, 0x930E, 0x8766, 0x0000, 0x0000, 0x22EF, 0x8939, 0x0000, 0x0000, 0x0000, 0x0000, 0x48FB, 0x0000, 0x0000,
+    0x414D, 0x45F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3EBD, 0xA19B, 0x7D3A, 0x0000, 0x2293, 0x8116, 0xAAAE, 0xA71D, 0x0000,
+    0xA020, 0x365C, 0x0000, 0x0000, 0x320C, 0x0000, 0x96FB, 0x809D, 0xA6B2, 0x465F, 0x3494, 0x33DF, 0x4438, 0x3515, 0x3365, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1F1, 0x3824, 0x0000, 0x40D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x26A3, 0x9092, 0xA31E,
+    0x39F7, 0x0000, 0x4F3E, 0x0000, 0x0000, 0x0000, 0x0000, 0x9927, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x43AA, 0x58EA, 0x373C,
+    0x0000, 0xB96E, 0x0000, 0x32CF, 0x0000, 0xA1B0, 0x0000, 0x0000, 0x0000, 0xB34E, 0xAAB8, 0x0000, 0x276F, 0xA1F8, 0x0000, 0x0000,
+    0x4939, 0x0000, 0x0000, 0x0000, 0x9365, 0x2264, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A3, 0x0000, 0x0000, 0x0000, 0xB355, 0x0000, 0x0000, 0x555D, 0xA9F7, 0x0000,
+    0x0000, 0xA8EC, 0x2B7F, 0x0000, 0x0000, 0x0000, 0xAEFF, 0x0000, 0x0000, 0x4C78, 0x0000, 0x0000, 0x0000, 0x0000, 0x79AC, 0x0000,
+    0x0000, 0x16E1, 0x0000, 0x0000, 0x4DB7, 0x0000, 0x25F3, 0x9261, 0x9821, 0x924E, 0x0000, 0x863C, 0x0000, 0x0000, 0x0000, 0x96F3,
+    0x0000, 0xA4F7, 0x48E7, 0x0000, 0x215A, 0x993C, 0x9AED, 0xA20A, 0x0000, 0x0000, 0x361D, 0x782A, 0x0000, 0x0000, 0x0000, 0x30BA,
+    0x4779, 0x3630, 0x8522, 0xA620, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA19E, 0x35EF, 0x297A, 0xA7F7, 0x4BB5, 0x25B9, 0x0000,
+    0xA417, 0x0000, 0x0000, 0x0000, 0x3086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E9, 0xAEBB, 0x0000, 0x0000, 0x0000, 0xA65D,
+    0x0000, 0x3EFD, 0x12D1, 0x0000, 0x575E, 0x0000, 0x0000, 0x4293, 0x0000, 0x0000, 0x42DD, 0x7622, 0x924D, 0x0000, 0x5A70, 0x0000,
+    0x9975, 0x23B8, 0x172D, 0x1974, 0x0000, 0x0000, 0x0000, 0x4824, 0x1763, 0x0000, 0x0000, 0x2725, 0x916D, 0x0000, 0x4C33, 0x0000,
+    0xA2F3, 0x0000, 0x86B5, 0x0000, 0x94A2, 0x0000, 0x0000, 0x8526, 0xA24C, 0xA119, 0xB49B, 0x0000, 0x0000, 0x3C38, 0x0000, 0x110A,
+    0x0000, 0x39BE, 0x5C7A, 0x0000, 0x0000, 0x9134, 0x4005, 0x975F, 0x7767, 0x95A6, 0x3ABA, 0x223E, 0x328C, 0xA8A5, 0xA238, 0x0000,
+    0x0000, 0x0000, 0x309A, 0x0000, 0x0000, 0x0000, 0x246C, 0xB59E, 0x0000, 0xA18F, 0x0000, 0x0000, 0x0000, 0x4251, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x42CD, 0x0000, 0x308A, 0x0000, 0x0000, 0x0000, 0x0000, 0x86F0, 0x33AE, 0x0000, 0xA16D, 0x0000,
+    0x0000, 0xB459, 0x0000, 0x0000, 0x70D4, 0x0000, 0x0000, 0x0000, 0xA0E3, 0x0000, 0x84E1, 0x0000, 0x324B, 0x0000, 0x0000, 0x3471,
+    0x2738, 0x0000, 0x3AFB, 0x0000, 0x0000, 0x0000, 0xA3A3, 0x38E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA455, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4934, 0x0000, 0x7A7A, 0x4829, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A2E, 0x2362, 0x0000,
+    0xA259, 0xA10C, 0x0000, 0x7AB4, 0x0000, 0x0000, 0x3324, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA975, 0x0000, 0x4044, 0x0000,
+    0x0000, 0x1050, 0x0000, 0x0000, 0x0000, 0x0000, 0xA71E, 0x0000, 0x0000, 0xB418, 0x25A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4B34, 0x0000, 0x4825, 0xAFBF, 0x8674, 0x36DD, 0x0000, 0x0000, 0x0000, 0x131D, 0x0000, 0x0000, 0x0000, 0x9EFD, 0x47F4,
+    0x0000, 0xACB4, 0x0000, 0x0000, 0x272E, 0x1B3D, 0x3079, 0x0000, 0x0000, 0x0000, 0xA168, 0x0000, 0x96EB, 0x4BAF, 0x1088, 0x4EBB,
+    0x786B, 0x0000, 0x90B2, 0x0000, 0x0000, 0xB049, 0x3871, 0xA65E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA4B2, 0x32CD, 0x0000, 0x0000, 0x0000, 0x2077, 0x8AF2, 0x46AA, 0x0000, 0x251D, 0xB458, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA72,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xACB5, 0x0000, 0x8DFE, 0x0000, 0x0000, 0x0000, 0x4BF6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4A79, 0x353C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6DC, 0xA08A, 0x8578, 0x0000, 0x85E5, 0xB597, 0x0000, 0x3E7C, 0x1290,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x939E, 0x0000, 0xA106, 0x4B33, 0x0000, 0x44A4, 0x0000, 0x2223, 0x3EFC, 0x9CB7, 0x0000,
+    0xA046, 0x0000, 0xB419, 0x0000, 0x0000, 0x0000, 0xB65A, 0x0000, 0x896C, 0x41AE, 0xA96C, 0x886A, 0x0000, 0xA1B6, 0x4D77, 0x0000,
+    0x0000, 0x0000, 0x7ABB, 0x0000, 0x9114, 0x8D3B, 0x3CF4, 0x0000, 0x0000, 0xA0DB, 0x0000, 0x48EA, 0x0000, 0xA65F, 0xA0C7, 0x0000,
+    0xB397, 0xA209, 0x266B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8936, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3087, 0x0000, 0x0000, 0x4210, 0x876F, 0x0000, 0x9775, 0x8499, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4220, 0x0000, 0x4CB4,
+    0x3C31, 0x86AC, 0x40DB, 0x0000, 0x0000, 0x4AFD, 0x0000, 0x0000, 0x796F, 0x0000, 0xA230, 0x0000, 0x0000, 0x0000, 0x0000, 0x739F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x826D, 0x0000, 0x4CB3, 0x5048, 0x0000, 0x7BFE, 0x4168, 0x0000, 0x2313, 0x315D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42A2, 0x214E, 0x0000, 0x0000, 0x0000, 0x2A70, 0x0000, 0x8B74, 0x0000, 0x0000,
+    0x9AAC, 0x0000, 0x0000, 0x0000, 0x3042, 0x0000, 0x0000, 0x9D76, 0x0000, 0x0000, 0x731D, 0x0000, 0x453C, 0x0000, 0xA1D7, 0x0000,
+    0xA1CE, 0x4002, 0xA071, 0x32DB, 0x35A6, 0x0000, 0x56A3, 0x596D, 0x0000, 0x0000, 0x0000, 0x0000, 0x35AE, 0x131B, 0x0000, 0xA461,
+    0x0000, 0xB292, 0x0000, 0x0000, 0x9E7C, 0x0000, 0x0000, 0x0000, 0x9046, 0x81A2, 0x0000, 0x7156, 0x97E7, 0x0000, 0x336D, 0x0000,
+    0x0000, 0x0000, 0x90C6, 0x0000, 0x0000, 0x459E, 0x0000, 0x772B, 0x0000, 0x0000, 0x0000, 0x8BB5, 0x0000, 0x496E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x935D, 0x0000, 0x0000, 0x9AEF, 0x866B, 0x0000, 0x8AFD, 0xAB7B, 0x0000, 0x0000, 0x0000, 0x0000, 0xA738, 0x0000,
+    0x26E2, 0x3524, 0x8370, 0x2012, 0x0000, 0xA2FB, 0x44EB, 0x0000, 0x0000, 0x0000, 0x12DA, 0x34D6, 0x0000, 0x0000, 0x4084, 0x0000,
+    0x7299, 0x3020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42D4, 0x0000, 0x58A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x2A31, 0x2419,
+    0x0000, 0x714F, 0x3AAF, 0x80D5, 0x0000, 0x2252, 0x92D3, 0x86E4, 0x0000, 0x0000, 0xA51D, 0x0000, 0xA71F, 0x84BF, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9004, 0x1523, 0x5459, 0x369D, 0x82DD, 0xA72E, 0x3E3A, 0x0000, 0xA114, 0x3453, 0x0000, 0x0000,
+    0xAE7B, 0xA863, 0x0000, 0x27AC, 0x0000, 0x0000, 0x0000, 0x86ED, 0xB55E, 0x0000, 0x320D, 0x0000, 0xB083, 0x928E, 0x87E6, 0x0000,
+    0x0000, 0x30FB, 0x0000, 0x5EFC, 0x0000, 0x0000, 0x3628, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9517, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA51B, 0x0000, 0x4C38, 0x9C32, 0x0000, 0x0000, 0xA829, 0x418E, 0x0000, 0x0000, 0x3EBE, 0x466B, 0x4051,
+    0x8315, 0x8397, 0x3975, 0x0000, 0x0000, 0x0000, 0xA1AE, 0x0000, 0x0000, 0x1258, 0x0000, 0xA085, 0xA0DE, 0x420E, 0x0000, 0x30F3,
+    0x0000, 0x4E7B, 0x0000, 0x0000, 0x43B6, 0xA2D3, 0x0000, 0xB869, 0x0000, 0x0000, 0x5B2D, 0x0000, 0x0000, 0xAA2B, 0x0000, 0x0000,
+    0x0000, 0x4497, 0x0000, 0xB24A, 0x22D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A38, 0x3C36, 0x0000, 0x5210, 0x3A79, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92E3, 0x0000, 0x0000, 0x9196, 0x739D, 0x0000, 0x0000, 0x48E4, 0x0000, 0xA530, 0x0000,
+    0x0000, 0x4E3D, 0x26AC, 0x0000, 0xACF7, 0x0000, 0x83E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x36DF, 0x9CB6, 0x5292, 0x0000, 0xA20F, 0x70D2, 0x0000, 0x4973, 0x4D36, 0x0000, 0x86E9, 0x0000, 0x5AEC, 0x9597,
+    0xA927, 0x0000, 0x375E, 0x9059, 0x0000, 0xA8E6, 0x0000, 0x0000, 0x48A6, 0xAAED, 0xA865, 0x0000, 0x0000, 0x0000, 0x37FF, 0x0000,
+    0x0000, 0x0000, 0xA5E5, 0xB724, 0x0000, 0xB356, 0xBC38, 0x155B, 0x9ABA, 0x369B, 0x0000, 0x31B6, 0x0000, 0xA4E8, 0x0000, 0xA048,
+    0x0000, 0x40C4, 0x0000, 0x0000, 0x46B5, 0x0000, 0x9044, 0x14DD, 0x0000, 0x0000, 0x497A, 0x3259, 0x1421, 0x0000, 0x0000, 0x0000,
+    0x1B7C, 0xA3F9, 0x0000, 0x0000, 0x0000, 0x4FBF, 0x483B, 0x0000, 0x0000, 0xA56D, 0x42CF, 0x0000, 0x90C4, 0xB8EB, 0x0000, 0x1299,
+    0x0000, 0x3CB7, 0x0000, 0x0000, 0x44B6, 0x4725, 0x0000, 0x0000, 0x4A2C, 0x43DF, 0x9006, 0x0000, 0x0000, 0x969C, 0x0000, 0x0000,
+    0xAAF9, 0x218D, 0x328D, 0x424B, 0x0000, 0x8563, 0x0000, 0xAC31, 0x0000, 0x0000, 0x0000, 0x97F7, 0x0000, 0x0000, 0x30C7, 0x0000,
+    0x2766, 0x0000, 0x166A, 0x0000, 0x83B8, 0x0000, 0x0000, 0x9E39, 0x0000, 0x78B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2772, 0x0000, 0x0000, 0x8C39, 0x26A1, 0x45A4, 0x9822, 0x0000, 0x86F6, 0x97AE, 0x9879, 0x7290, 0x8298, 0x0000, 0xA92B,
+    0x0000, 0x0000, 0x818D, 0x296E, 0x4B3E, 0x0000, 0xAB3A, 0xA8E5, 0x3038, 0x0000, 0x0000, 0x0000, 0x0000, 0x514C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA75E, 0x0000, 0x4D76, 0x0000, 0x9A2C, 0x0000, 0x0000, 0xA24F, 0x0000, 0x0000, 0x0000, 0x9E3C,
+    0x0000, 0xAD7C, 0x0000, 0x0000, 0x9003, 0x0000, 0x0000, 0x3209, 0x0000, 0x0000, 0x437D, 0x99F7, 0x0000, 0x0000, 0x98E4, 0x0000,
+    0x835F, 0x596C, 0x0000, 0x0000, 0x0000, 0xA31C, 0x0000, 0x0000, 0xA7B6, 0x0000, 0x0000, 0x0000, 0x7763, 0x0000, 0xA47E, 0x4BB7,
+    0x0000, 0x0000, 0x0000, 0x2009, 0xA61A, 0x0000, 0x0000, 0x0000, 0x5AB3, 0x0000, 0x5A72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x40E7, 0x218F, 0x9106, 0x0000, 0x320A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAFB, 0x0000, 0x455C, 0x0000,
+    0x0000, 0x0000, 0x7A78, 0x4083, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CB5, 0x0000, 0xA416, 0x7872, 0xAA6F, 0x4EFC, 0x5AF2, 0x0000,
+    0x0000, 0x44A0, 0x8B76, 0x84E8, 0x0000, 0xAD3C, 0x449A, 0x0000, 0x0000, 0x0000, 0x0000, 0x74A3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x435D, 0x1CB8, 0x465E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4010, 0x0000, 0x0000, 0x0000, 0x49FC,
+    0x423E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6F6, 0x0000, 0x0000, 0x9B6E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2BF6, 0xBDBF, 0x0000, 0x3155, 0x0000, 0xAB7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x72D5, 0x4D37,
+    0x3BAF, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6DD, 0x0000, 0x16A9, 0x2939, 0x0000, 0x0000, 0x0000, 0x510D, 0xA939, 0xB252, 0x0000,
+    0x28AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A2A, 0x0000, 0xA0EB, 0x0000, 0x1CBC, 0x4D3D, 0x7197, 0x0000, 0x0000, 0x0000,
+    0x40AF, 0x4AF2, 0x0000, 0x0000, 0xAC36, 0x0000, 0x0000, 0x139D, 0x0000, 0xA867, 0x0000, 0xADFF, 0x896E, 0x239C, 0x0000, 0x7460,
+    0x0000, 0x0000, 0x351C, 0x0000, 0x0000, 0x47A6, 0x0000, 0x0000, 0x0000, 0x38EB, 0x0000, 0x41DC, 0x43B8, 0x3418, 0x369F, 0x0000,
+    0x0000, 0x0000, 0xA049, 0xA5BE, 0x0000, 0x47E6, 0x0000, 0x3597, 0x0000, 0x8252, 0x0000, 0x0000, 0xA4FB, 0x0000, 0x4A30, 0x94E3,
+    0x0000, 0x29AF, 0x0000, 0x0000, 0x0000, 0x8CFA, 0x0000, 0x0000, 0x0000, 0x1AFC, 0xA92D, 0x0000, 0x0000, 0x3003, 0x9516, 0x0000,
+    0x0000, 0x0000, 0xBAB3, 0xB38F, 0x0000, 0x424F, 0x0000, 0x0000, 0x0000, 0x751A, 0xA25B, 0xA0BA, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1460, 0x0000, 0x0000, 0x8B7B, 0x0000, 0xA010, 0x0000, 0xAD35, 0x551B, 0xBBB7, 0x8B7F, 0x0000, 0x0000, 0x74E4, 0x5BAF,
+    0x3638, 0xAEBF, 0x0000, 0x9A2A, 0x0000, 0x0000, 0x5DBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4E3A, 0x0000, 0x4059, 0x0000, 0xA37D, 0x90F3, 0x0000, 0x4530, 0x9630, 0x1B77, 0x0000, 0x47B3, 0x0000, 0x0000, 0x1BF5, 0x0000,
+    0x54DB, 0x0000, 0x41B6, 0x53D6, 0x20D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x33BE, 0x3059, 0x0000, 0x9469, 0x3827, 0x8065, 0xB395,
+    0x8832, 0x0000, 0x0000, 0x0000, 0x0000, 0xBB75, 0x9043, 0x0000, 0x0000, 0x18B1, 0x0000, 0xA044, 0x9925, 0x456D, 0x0000, 0x1629,
+    0x0000, 0x0000, 0xBA71, 0x98E7, 0x7093, 0xA292, 0x0000, 0x1D3E, 0x0000, 0x0000, 0x0000, 0x3495, 0x0000, 0x0000, 0xB211, 0x806E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9415, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x8211, 0x0000, 0x0000, 0x0000, 0x961C, 0x43F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A6A, 0x0000, 0x0000, 0x23DD, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x8738, 0x0000, 0x461E, 0x0000, 0x44D4, 0x0000, 0x0000, 0x0000, 0xBB76, 0x0000, 0xA65C, 0x0000, 0x473C,
+    0x82EF, 0x59AE, 0xBD76, 0x45EF, 0xA3DD, 0x7AF1, 0x1A32, 0xB5DE, 0x4458, 0x0000, 0x51CE, 0xB45A, 0x0000, 0xB210, 0x0000, 0xB411,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CFB, 0x0000, 0xA362, 0xAA2D, 0x0000, 0x2DFE, 0x141A, 0x52CC, 0x84DC, 0x25DE, 0x825B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555E, 0x7219, 0x0000, 0x920D, 0x0000, 0xA9BB, 0x0000, 0xA4EB, 0xA6DE, 0x41D5, 0x0000,
+    0x0000, 0x0000, 0x59AF, 0x0000, 0x0000, 0x0000, 0x924C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA4D5, 0x452F, 0xB7A6, 0xA018,
+    0x0000, 0x8C7A, 0x0000, 0x487C, 0x0000, 0x0000, 0x0000, 0xB619, 0x9375, 0x0000, 0x0000, 0x0000, 0x90FB, 0xA276, 0x0000, 0xA8BD,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x469D, 0x0000, 0x4CF6, 0x0000, 0xA61D, 0xAC73,
+    0x0000, 0xA327, 0x0000, 0x0000, 0x13DE, 0x369E, 0x0000, 0x79B7, 0x0000, 0x95B6, 0x79B5, 0xB4D4, 0x814C, 0x0000, 0x4671, 0x9079,
+    0x1976, 0x3420, 0x0000, 0x0000, 0x0000, 0x4276, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5395, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x1B3B, 0x0000, 0x96DF, 0x0000, 0x456A, 0x0000, 0x0000, 0x32E3, 0x0000, 0x3004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x21E3, 0xA4A2, 0x4028, 0x0000, 0x0000, 0x41E7, 0x8194, 0xAB6E, 0xA2A2, 0x9871, 0x0000, 0x30C4, 0x9020, 0x0000, 0xA8A9, 0x0000,
+    0x0000, 0x2463, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3FF, 0x0000, 0x23A3, 0x0000, 0xA6A1, 0x0000, 0xA453, 0xA315, 0x0000,
+    0xA8B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F3D, 0xA051, 0x0000, 0x0000, 0x0000, 0xBDFF, 0x8633, 0xBCFB, 0x4619, 0x0000, 0x0000,
+    0x5F3D, 0x0000, 0xA7ED, 0x0000, 0x4524, 0x0000, 0x4C37, 0x0000, 0x229C, 0x1091, 0x0000, 0x3D36, 0x43D6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1DFD, 0xA084, 0x3A71, 0x9E7B, 0x492C, 0x0000, 0x2779, 0x45F3, 0x9E3F, 0x0000, 0xB6E3, 0x0000, 0x4AB8, 0xA375,
+    0x0000, 0x0000, 0x5356, 0x0000, 0xA042, 0x0000, 0x45B2, 0xAB34, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5764, 0x0000, 0x0000,
+    0x2CFA, 0x4434, 0x5925, 0x0000, 0xA597, 0x27A7, 0x9084, 0x0000, 0x3047, 0x4459, 0x3497, 0x38F3, 0x0000, 0x3557, 0x1D7B, 0x831E,
+    0x0000, 0x0000, 0x0000, 0xADBF, 0xAA38, 0x5515, 0x247E, 0xAD7D, 0xB92D, 0xAA6C, 0x0000, 0x818F, 0xAC37, 0x9864, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xAB35, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x149C, 0x0000, 0x0000, 0x0000, 0x46ED, 0x272A,
+    0x9F3F, 0x0000, 0x159C, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A71, 0x3069, 0x3E3C, 0x0000, 0x0000, 0x0000, 0x0000, 0x84AD, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xAD3D, 0xA571, 0x4020, 0x729B, 0x4567, 0x2153, 0x0000, 0x0000, 0x0000, 0x93DF, 0x0000, 0x0000, 0x92AA,
+    0x0000, 0x0000, 0x3AED, 0xAA2E, 0x0000, 0xB14E, 0x0000, 0x0000, 0x1726, 0x0000, 0x0000, 0x3619, 0x0000, 0x0000, 0x84A4, 0x88A9,
+    0x0000, 0x4453, 0x9FBF, 0xB354, 0x9A2B, 0x0000, 0xA0CA, 0x0000, 0x37F7, 0x0000, 0x819B, 0x81D5, 0x4B2D, 0x4DBF, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4420, 0x33E7, 0xADB7, 0x0000, 0x82E0, 0xA55C, 0x0000, 0xA077, 0xA089, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x48FE, 0x0000, 0x0000, 0x3CB3, 0x856A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBBB5, 0x71D6, 0x5209, 0x3F3E, 0x969E,
+    0xA27F, 0x89AD, 0xBB6E, 0x9269, 0x0000, 0x4053, 0x4A6C, 0x38A3, 0x3454, 0x0000, 0x92CF, 0x47FF, 0x0000, 0x913C, 0x16EC, 0x514E,
+    0x0000, 0x0000, 0x579F, 0x0000, 0x81F8, 0x9628, 0x0000, 0x85A4, 0x2868, 0x0000, 0x0000, 0x9AAB, 0x2764, 0x0000, 0x0000, 0x0000,
+    0x9D7D, 0x0000, 0x0000, 0x0000, 0x3BB6, 0x842B, 0xA6FF, 0x5869, 0x2B3A, 0x0000, 0x0000, 0x8264, 0x39B6, 0xA515, 0x0000, 0xA5B2,
+    0x0000, 0x0000, 0x0000, 0xA621, 0x0000, 0x76A9, 0x4CF5, 0x0000, 0x0000, 0x89BB, 0x424E, 0x0000, 0x0000, 0x0000, 0x23AA, 0x316D,
+    0x210D, 0x9A30, 0x0000, 0x424A, 0x0000, 0x0000, 0x0000, 0x0000, 0xA28E, 0xA418, 0x420B, 0x0000, 0x0000, 0xB293, 0xA32C, 0xAC72,
+    0x4A3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x411F, 0x9086, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D37, 0x9B2F, 0x88F5,
+    0x0000, 0x78A8, 0x87F4, 0x0000, 0x0000, 0x0000, 0x9BBE, 0x0000, 0x0000, 0x4867, 0x0000, 0x0000, 0x0000, 0x0000, 0xAB3C, 0x36FB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A6A, 0x0000, 0x83EB, 0x0000, 0x32EB, 0x23E4, 0x0000,
+    0x0000, 0x0000, 0x34FB, 0xBDB7, 0x0000, 0x0000, 0x0000, 0x9AEE, 0x8419, 0x40CC, 0xA7BA, 0x48AB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x430F, 0x0000, 0x0000, 0x0000, 0x0000, 0xA012, 0x0000, 0x0000, 0xA661, 0x876B, 0x0000, 0x40D5, 0x0000, 0x0000, 0x8A7B, 0x0000,
+    0x84B6, 0x4AAC, 0x0000, 0x0000, 0x937D, 0x0000, 0x0000, 0x24AD, 0x0000, 0x0000, 0x4CB7, 0x0000, 0x0000, 0x961E, 0x0000, 0x0000,
+    0x0000, 0x5C72, 0x496C, 0x4061, 0x0000, 0xBBB6, 0x0000, 0x0000, 0xA251, 0x0000, 0x9CF6, 0x0000, 0x0000, 0x0000, 0x4EBF, 0x0000,
+    0xA3F7, 0x0000, 0x2CFC, 0x1566, 0x0000, 0x0000, 0xA66B, 0x9D37, 0x0000, 0x3271, 0x0000, 0x0000, 0x48BD, 0x9934, 0x0000, 0x3355,
+    0x4A70, 0x0000, 0x0000, 0x4B2E, 0x0000, 0x2CB9, 0x0000, 0x3A6F, 0x0000, 0x2AF4, 0x977D, 0x0000, 0x0000, 0x77AD, 0x0000, 0x0000,
+    0x42E3, 0x0000, 0xA4EE, 0xA463, 0x0000, 0x0000, 0x5049, 0xAC77, 0x202D, 0x755B, 0x0000, 0x3C76, 0x4932, 0x0000, 0x9E3B, 0x0000,
+    0x0000, 0x0000, 0x908A, 0x0000, 0x0000, 0x0000, 0x0000, 0x4048, 0x0000, 0x0000, 0x91A6, 0xA822, 0x0000, 0x0000, 0x0000, 0xA328,
+    0x9412, 0x0000, 0x414C, 0x3926, 0x4E39, 0x0000, 0x0000, 0x0000, 0x3865, 0x0000, 0x3B34, 0x4529, 0x5001, 0x91B6, 0x0000, 0xBB34,
+    0x0000, 0x5009, 0x9155, 0x0000, 0x9259, 0x953C, 0x0000, 0x26B5, 0x3456, 0x420A, 0x0000, 0x93F7, 0x0000, 0x0000, 0x0000, 0x94DB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x35B6, 0x88B4, 0x0000, 0x9AEC, 0x0000, 0x0000, 0x8BF6, 0x0000, 0x0000, 0x7462, 0x376D, 0x0000,
+    0x0000, 0x0000, 0x24DC, 0x7CB8, 0x0000, 0x0000, 0xAEBE, 0x0000, 0x36B2, 0x0000, 0x0000, 0x426D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x330E, 0x9049, 0x3018, 0x8369, 0x2936, 0x0000, 0x0000, 0x931C, 0x0000, 0x0000, 0x49BE, 0x9042, 0x0000, 0x0000, 0x3187,
+    0xB493, 0x0000, 0xA15D, 0x0000, 0x74E2, 0xA211, 0x3E7D, 0xA2CC, 0x0000, 0x9430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x9051, 0x0000, 0x0000, 0x0000, 0xBD3D, 0x0000, 0x0000, 0x1B7E, 0x0000, 0x0000, 0x7AFA, 0x0000, 0x8772, 0x4264,
+    0x497D, 0x0000, 0xA0C4, 0x0000, 0x9459, 0x0000, 0x48EC, 0x86A8, 0x0000, 0x5EBB, 0x259F, 0x0000, 0x0000, 0x0000, 0x0000, 0x3479,
+    0x0000, 0x0000, 0xAAEE, 0x87ED, 0x34BA, 0x0000, 0x9967, 0x0000, 0x263C, 0x0000, 0x0000, 0x0000, 0x0000, 0x9418, 0xA8FE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA045, 0x9495, 0xA578, 0x0000, 0x0000, 0x0000, 0x9A6E, 0x0000, 0x0000, 0x0000, 0xA9EE, 0x0000, 0x792E,
+    0x58E4, 0x0000, 0x4775, 0x0000, 0xA105, 0x0000, 0x0000, 0x4218, 0x0000, 0x0000, 0x17AD, 0x3661, 0x0000, 0x9A2F, 0x0000, 0xA6BE,
+    0x9679, 0x0000, 0x5862, 0x4A2F, 0x47AE, 0x4E3E, 0x0000, 0x413C, 0x0000, 0xA6F3, 0x0000, 0x87FB, 0x31D7, 0xA324, 0x0000, 0xA030,
+    0x7D3E, 0x9CF5, 0x32BA, 0x855E, 0x3D3C, 0x0000, 0x43E4, 0x0000, 0xA7E7, 0x0000, 0xABFD, 0x0000, 0x0000, 0x0000, 0x0000, 0x5008,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42CC, 0x7629, 0x0000, 0x0000, 0x81A9, 0x0000, 0xACF6, 0x4071, 0x108C, 0x0000,
+    0x97BE, 0x0000, 0x0000, 0xA094, 0x0000, 0x0000, 0x0000, 0x2BFD, 0x0000, 0x0000, 0x0000, 0xA11C, 0x5250, 0x2C78, 0x0000, 0xA2D9,
+    0x0000, 0x0000, 0x0000, 0xA0AA, 0x251B, 0x0000, 0x7B36, 0x0000, 0x0000, 0x9A6D, 0x0000, 0x44F3, 0x7BF5, 0x0000, 0x0000, 0x4269,
+    0x3CB4, 0x0000, 0x0000, 0x0000, 0x4B3A, 0x0000, 0x2369, 0x36E3, 0x0000, 0x0000, 0x0000, 0xB9EF, 0x17EE, 0x0000, 0x9002, 0x0000,
+    0xA11F, 0x0000, 0x3575, 0x4B7F, 0xAABA, 0x27B3, 0x46DE, 0x71CD, 0x0000, 0x0000, 0x0000, 0x2D7E, 0x9251, 0x0000, 0x965A, 0x3EBC,
+    0x4036, 0x0000, 0x0000, 0x0000, 0x0000, 0x849B, 0x2621, 0x0000, 0x2370, 0x0000, 0xA679, 0x0000, 0x0000, 0x83D6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA1EF, 0x0000, 0x0000, 0x4A2A, 0x8530, 0x0000, 0xAA31, 0x78AC, 0x0000, 0x0000, 0x0000, 0x7564, 0x0000, 0x0000,
+    0x2327, 0x0000, 0x90DB, 0x9C76, 0x0000, 0x0000, 0x365F, 0x965D, 0x76E5, 0x58A3, 0x3230, 0xB0C4, 0x98F3, 0xA313, 0x4006, 0x0000,
+    0x337D, 0x0000, 0x4A29, 0x0000, 0x9EBE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9028, 0x27FB, 0x26F0, 0x0000, 0x3822,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4864, 0x0000, 0x0000, 0x0000, 0x0000, 0x859F, 0x3010, 0xA2B2, 0x971E, 0x0000,
+    0x0000, 0x8119, 0x0000, 0x0000, 0xB1CF, 0x0000, 0x0000, 0xA7FB, 0x84DA, 0x0000, 0x0000, 0x0000, 0x28F5, 0x4A72, 0x38A7, 0x0000,
+    0x9008, 0x0000, 0x0000, 0x31AE, 0x4107, 0x3DFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6, 0x0000, 0x0000, 0x0000, 0x5418,
+    0x0000, 0x2932, 0x0000, 0x0000, 0x0000, 0xBC72, 0x9038, 0x0000, 0x0000, 0x0000, 0x0000, 0xBA72, 0x96E3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA06E, 0xB6A2, 0xA6A3, 0x0000, 0xAEFE, 0x4662, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA454, 0x47BE, 0x0000, 0x0000, 0x9CB3, 0x4087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA235, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x476F, 0x0000, 0x0000, 0xB9EE, 0x0000, 0x0000, 0x0000, 0x48F8, 0xA369, 0xA3A6, 0x0000, 0xAC7A, 0x0000, 0x447E,
+    0x0000, 0x86A3, 0x48F3, 0x0000, 0x0000, 0xB515, 0xB10C, 0x74A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA365, 0x0000, 0x4CBA,
+    0x192A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17E5, 0xA086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26ED, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x751E, 0x0000, 0x0000, 0x4314, 0x0000, 0x0000, 0x21A9, 0x0000, 0x883B, 0xA355, 0x0000, 0x0000, 0x38B2,
+    0x40EB, 0x0000, 0x8293, 0x2475, 0x32CE, 0x7A73, 0x0000, 0x0000, 0x5966, 0xA2A5, 0x3D76, 0x0000, 0x0000, 0x0000, 0x0000, 0x90CB,
+    0x420D, 0x5089, 0x4838, 0x0000, 0x0000, 0xA76B, 0x0000, 0x2DBD, 0x96DD, 0x0000, 0x89F5, 0x0000, 0x25AB, 0x0000, 0xA97D, 0x0000,
+    0x9147, 0x0000, 0x4936, 0x0000, 0x267D, 0x0000, 0x42CE, 0x0000, 0x0000, 0x0000, 0xA737, 0x0000, 0x94D7, 0x43D7, 0x3869, 0x0000,
+    0x4187, 0x84E5, 0x1564, 0x0000, 0x0000, 0x0000, 0x0000, 0x9416, 0x0000, 0x30AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xA20B, 0x0000,
+    0x0000, 0x9D35, 0x0000, 0x0000, 0x827F, 0xA55D, 0x0000, 0x5252, 0x0000, 0x0000, 0x0000, 0x37E7, 0x118C, 0x78ED, 0x0000, 0x3A29,
+    0x4D7D, 0x1113, 0x425B, 0x46FF, 0x0000, 0x42A5, 0x0000, 0x95F7, 0x0000, 0x2321, 0x0000, 0x0000, 0x0000, 0xA8B2, 0x0000, 0x4119,
+    0x718C, 0x9AAD, 0xBC31, 0x0000, 0x0000, 0x4EFD, 0x0000, 0x255E, 0x415A, 0x55DF, 0x0000, 0x0000, 0xBA70, 0x286A, 0x0000, 0x296C,
+    0x0000, 0x0000, 0x0000, 0x4832, 0x0000, 0x0000, 0x7CFD, 0xA161, 0x0000, 0x0000, 0x0000, 0x0000, 0xA821, 0x0000, 0x1B73, 0x334E,
+    0x0000, 0x776E, 0x0000, 0x0000, 0x44DB, 0x0000, 0xA271, 0x0000, 0x0000, 0x0000, 0xB2D2, 0x0000, 0x87BA, 0x7212, 0x0000, 0x92FB,
+    0x0000, 0x2211, 0x0000, 0x2A3A, 0xA053, 0x87B3, 0xA228, 0x86FF, 0x0000, 0x0000, 0x2354, 0x0000, 0x997D, 0x3228, 0x0000, 0x0000,
+    0x8725, 0x0000, 0x0000, 0x85DE, 0x0000, 0x0000, 0x0000, 0x409A, 0x26E9, 0x0000, 0x0000, 0x0000, 0x8AB8, 0x73DE, 0x9A2D, 0x0000,
+    0x0000, 0x30DB, 0x7A32, 0x9314, 0x0000, 0x1BBF, 0x0000, 0xA4A0, 0xB71D, 0x0000, 0x0000, 0x0000, 0x4CB6, 0x0000, 0x13D5, 0x17AF,
+    0x0000, 0x9869, 0xA3E7, 0x2AB8, 0x4C35, 0x596E, 0x26FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49AD,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x33B6, 0x0000, 0x0000, 0x3220, 0x0000, 0x59EE, 0xA2D4, 0x0000, 0x4365, 0x932C, 0x2094, 0x4271,
+    0x7663, 0x0000, 0x0000, 0x0000, 0x77E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C78, 0x56A2, 0x74D9, 0x465B, 0xA55E, 0x30CB, 0x3CFB,
+    0x4517, 0x3DBE, 0x0000, 0x0000, 0x0000, 0x11CD, 0xAAAD, 0x0000, 0x821A, 0x9E7D, 0x9A6F, 0xBB33, 0xA4DB, 0x0000, 0x3828, 0x0000,
+    0x24DA, 0x7195, 0x83A3, 0x9420, 0x0000, 0x1BBD, 0x0000, 0x0000, 0xBCBA, 0x72D1, 0x1D3A, 0x0000, 0x0000, 0x0000, 0xA8F5, 0x8434,
+    0x0000, 0x0000, 0x0000, 0x8CFC, 0x9D3C, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D35, 0x259D, 0x559F, 0x0000, 0x4CBB, 0x43EF, 0x0000,
+    0x2397, 0x0000, 0xA7A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4CB5, 0x0000, 0x0000, 0xA03F, 0x0000, 0x81B0, 0xA059, 0x0000,
+    0xA524, 0x0000, 0x414E, 0xB828, 0x0000, 0x9CB4, 0xBD35, 0x0000, 0x0000, 0x476D, 0x0000, 0x469B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x872E, 0x9AAE, 0x0000, 0x805C, 0x461F, 0x5C31, 0x47ED, 0x0000, 0x0000, 0x2BB5, 0x0000, 0x0000, 0x419E, 0x0000, 0x4024, 0xBB74,
+    0x0000, 0x0000, 0x9EBF, 0x0000, 0x9124, 0x0000, 0x0000, 0x0000, 0x1BB4, 0x47E7, 0x0000, 0x4194, 0xA6EB, 0x0000, 0xB621, 0x0000,
+    0x4CFA, 0x3375, 0xAA2A, 0x32FB, 0x0000, 0x0000, 0x4764, 0x50CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x56E3, 0x0000, 0x80D8, 0x5CBA,
+    0x4BFD, 0x0000, 0x9271, 0x0000, 0x0000, 0x3966, 0x361C, 0x7935, 0x23D6, 0x0000, 0xA5A6, 0x42E0, 0x0000, 0x0000, 0x3864, 0x0000,
+    0x41B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x755F, 0x0000, 0x0000, 0x0000, 0x42B2, 0x847E, 0x0000, 0x32F3, 0x0000, 0x22AE,
+    0x0000, 0x84EE, 0x8053, 0x0000, 0x0000, 0x0000, 0xAC79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x29FC, 0x0000,
+    0xB14D, 0x0000, 0x0000, 0x97A6, 0x0000, 0x0000, 0x172B, 0x77EE, 0xA826, 0x0000, 0x2D7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4CF7, 0x0000, 0x843D, 0x0000, 0x0000, 0x0000, 0x4DBD, 0x0000, 0x0000, 0x0000, 0x45EC, 0x22A5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA567, 0x0000, 0x0000, 0x1011, 0x0000, 0x0000, 0x0000, 0x34D7, 0x3517, 0x0000, 0x0000, 0x0000,
+    0x231A, 0x887C, 0x0000, 0x4416, 0x0000, 0x463C, 0x4926, 0xB966, 0x46A1, 0x4252, 0x5DB7, 0x0000, 0x0000, 0x0000, 0xA3E4, 0x471E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98A3, 0x90E3, 0x0000, 0x0000, 0x2168, 0x0000, 0x0000, 0x492D, 0x0000, 0x0000, 0x471F,
+    0x95DF, 0xB2D4, 0x0000, 0x0000, 0x3F3D, 0x0000, 0x405C, 0x0000, 0x0000, 0x0000, 0xA3EB, 0xA6AC, 0x145B, 0x94D4, 0x0000, 0xAE3F,
+    0x0000, 0x555C, 0x0000, 0x0000, 0xB250, 0x0000, 0x75DD, 0x929A, 0x50CB, 0xA003, 0x0000, 0x0000, 0x803F, 0x1AFA, 0x0000, 0x0000,
+    0x4175, 0x0000, 0x8DBF, 0x79F6, 0x0000, 0x3051, 0x0000, 0x0000, 0x429C, 0x443D, 0x0000, 0x0000, 0x22E0, 0x0000, 0x82B7, 0xA146,
+    0x0000, 0x0000, 0xA4D4, 0x0000, 0x42EF, 0x0000, 0x9479, 0x4556, 0x5621, 0x0000, 0xA825, 0x0000, 0x3071, 0xA7FF, 0x0000, 0x76A0,
+    0x0000, 0x0000, 0xAE3A, 0x3459, 0xA2CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x1462, 0x0000, 0x192E, 0x3879, 0x9B2E, 0x0000, 0x0000,
+    0x0000, 0x2048, 0x0000, 0x0000, 0x0000, 0x0000, 0xA495, 0x0000, 0xBC78, 0x0000, 0xB660, 0x38AA, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x23B1, 0x0000, 0x0000, 0x0000, 0xA3BE, 0x565A, 0x0000, 0x0000, 0x811F, 0x39FF, 0x44B2, 0x4A38, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x438F, 0x0000, 0x0000, 0x0000, 0x0000, 0xB7A5, 0x569B, 0x0000, 0x0000, 0x0000, 0xA10B, 0x0000, 0xAB76, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4731, 0x0000, 0x9461, 0x88B0, 0x0000, 0xA0D8, 0x0000, 0xA2DD, 0xA9AF, 0x439E, 0x1622,
+    0xA76D, 0x0000, 0x95E7, 0x0000, 0x7B32, 0x0000, 0x0000, 0x3218, 0x0000, 0x72DC, 0x54DA, 0xA69D, 0x0000, 0x1195, 0x0000, 0xA30F,
+    0x0000, 0x0000, 0x34AA, 0x0000, 0x0000, 0x0000, 0xA764, 0x0000, 0xA079, 0xA869, 0xB008, 0x9828, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xAA30, 0x0000, 0x8662, 0x16A4, 0x0000, 0x0000, 0x461C, 0x9C72, 0x4E7D, 0x0000, 0x0000, 0x0000, 0xA6A2, 0x4AAF, 0xA497, 0x0000,
+    0x0000, 0xA34F, 0x4B2F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA779, 0xA936, 0x4EBD, 0x735E, 0x0000, 0x0000, 0xA1BE,
+    0x29BB, 0xB620, 0x0000, 0x9A6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x7831, 0x8868, 0x0000, 0x3238, 0x9524, 0x0000, 0x0000, 0x0000,
+    0x4CB9, 0x0000, 0x0000, 0xA24B, 0x4146, 0x0000, 0xB4DB, 0x0000, 0x0000, 0x0000, 0x0000, 0xA396, 0x965F, 0x0000, 0x0000, 0xA6E4,
+    0x27A5, 0x0000, 0x0000, 0x8AB3, 0x28A9, 0x94FB, 0x9A6C, 0x961A, 0x0000, 0x3EFF, 0x0000, 0x0000, 0x459D, 0x4494, 0x0000, 0xA26D,
+    0x0000, 0xA823, 0x0000, 0x518F, 0x0000, 0x41F1, 0x77AF, 0x0000, 0x0000, 0x320E, 0x31EF, 0x0000, 0x0000, 0xA422, 0x0000, 0x0000,
+    0x4455, 0x851B, 0x0000, 0x59AD, 0x312C, 0x243D, 0x1253, 0xAF7E, 0x0000, 0x324F, 0x0000, 0x0000, 0x2235, 0x2120, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xAB3E, 0x40C7, 0x0000, 0xA279, 0xB28B, 0x0000, 0x934F, 0x0000, 0x9001, 0x88EC, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4211, 0x0000, 0x0000, 0x0000, 0x430D, 0xB662,
+    0x0000, 0x42FB, 0x0000, 0x2112, 0x452C, 0xA2DB, 0x0000, 0x0000, 0x0000, 0xA264, 0x9D36, 0x0000, 0x893F, 0xAC39, 0x0000, 0x0000,
+    0x0000, 0x404A, 0x0000, 0x0000, 0x0000, 0x4AB3, 0x0000, 0x9CF7, 0xBD3B, 0xA6ED, 0x28B0, 0x0000, 0x0000, 0x0000, 0x5725, 0x3092,
+    0x46B2, 0x0000, 0x0000, 0x4279, 0x551D, 0x0000, 0x3396, 0x4571, 0x0000, 0x4C32, 0x0000, 0x7316, 0x0000, 0x9B2D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA9B4, 0x0000, 0x90D3, 0x0000, 0x99B6, 0x5CF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4043, 0x41DF,
+    0x3496, 0x0000, 0x0000, 0x4534, 0x0000, 0x0000, 0x4047, 0x3556, 0x0000, 0x4828, 0x0000, 0x0000, 0x94F3, 0x89EE, 0xA43D, 0x4157,
+    0x0000, 0x7B3B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52D4, 0x0000, 0x24E1, 0x0000, 0x0000, 0x0000, 0x9A38, 0x0000, 0x0000,
+    0x0000, 0xA5EF, 0x4B35, 0x91EF, 0x5291, 0x0000, 0x31BE, 0x25B2, 0x49FF, 0x81F1, 0x4866, 0xA4D6, 0x0000, 0x0000, 0x2AF9, 0xABB7,
+    0x0000, 0x0000, 0x956D, 0xAAAB, 0x5042, 0x0000, 0x0000, 0x4012, 0x357D, 0x0000, 0x0000, 0x1C7B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x47B6, 0x0000, 0x318E, 0x0000, 0x0000, 0x203F, 0x8AB1, 0x20CA, 0x0000, 0x43F9, 0x46DF, 0x110E, 0x920F, 0xA87C, 0x0000,
+    0x0000, 0x3455, 0x0000, 0x29B4, 0x461A, 0x3AAE, 0x3452, 0x0000, 0xB92C, 0x0000, 0x313C, 0x0000, 0x0000, 0x0000, 0x5B6E, 0x0000,
+    0x0000, 0x1316, 0x0000, 0x0000, 0x38E4, 0x0000, 0xB7E6, 0x0000, 0xB009, 0x4526, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x70C9,
+    0x0000, 0x0000, 0x0000, 0x222C, 0x0000, 0x9355, 0x0000, 0x9619, 0x0000, 0x1312, 0x0000, 0xA3D7, 0x4CF4, 0xAC78, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x78E9, 0x9AB2, 0xA09A, 0x0000, 0x3B7D, 0x0000, 0x0000, 0x7312, 0x20AF, 0x8D7E, 0x0000, 0xBBAF, 0x0000,
+    0xA456, 0x4313, 0x0000, 0x0000, 0x0000, 0xA35F, 0x0000, 0x14D9, 0x0000, 0x4B75, 0x0000, 0x0000, 0x4734, 0x0000, 0x4077, 0x0000,
+    0x96A2, 0x0000, 0xA6BA, 0x0000, 0x0000, 0x4862, 0x0000, 0x0000, 0x249B, 0x0000, 0x0000, 0x319E, 0xAB2E, 0x0000, 0x0000, 0x0000,
+    0x424C, 0x0000, 0x0000, 0x0000, 0x0000, 0x93BE, 0x20A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA827, 0x0000, 0xB5DF,
+    0x0000, 0x3A6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58EB, 0xA8F1, 0x0000, 0x0000, 0x0000, 0xB313, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x439C, 0x87A7, 0x409D, 0x0000, 0xBEFC, 0x0000, 0xBBF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAE3D,
+    0x0000, 0x242B, 0x9061, 0x4A31, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B73, 0x0000, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB79F, 0x38A6, 0x0000, 0x0000, 0x5A29, 0x2328, 0x40CA, 0x0000, 0xAB74, 0x0000, 0x0000, 0x5314,
+    0x0000, 0x36EB, 0x0000, 0xB105, 0x4E7E, 0x0000, 0x0000, 0x0000, 0xA28B, 0x0000, 0x428F, 0x0000, 0x0000, 0x4C72, 0x8009, 0x0000,
+    0x91E7, 0x0000, 0xAA6D, 0x475E, 0x0000, 0x0000, 0x3E7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA4AD, 0x0000, 0x2AFD,
+    0xADFE, 0x44F7, 0xB725, 0x949A, 0x0000, 0x0000, 0x0000, 0x0000, 0xAB75, 0x969F, 0x0000, 0xA4A4, 0x0000, 0x492B, 0x0000, 0x0000,
+    0xA8EA, 0x3CB6, 0x0000, 0x0000, 0x9C79, 0x9724, 0xA13C, 0xA7A6, 0x5211, 0x0000, 0x0000, 0x0000, 0x0000, 0xA187, 0x2C39, 0x0000,
+    0x0000, 0x0000, 0x31E7, 0x0000, 0x0000, 0x0000, 0x5313, 0x0000, 0x0000, 0x0000, 0xA934, 0xAA79, 0x930F, 0x0000, 0x324D, 0x4D3C,
+    0x4869, 0x0000, 0x0000, 0x85B2, 0x451B, 0x2D3B, 0x4DFF, 0x57E7, 0x0000, 0x0000, 0x3043, 0x0000, 0x22B7, 0xAAFD, 0x0000, 0x0000,
+    0x0000, 0x4C31, 0xA83B, 0x0000, 0x0000, 0xA370, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x50CC, 0x0000, 0xA1DC, 0x0000, 0x0000, 0x0000, 0xAA2F, 0x9146, 0x831A, 0x72DA, 0x0000, 0x39AE, 0x0000, 0x0000, 0x0000, 0x559D,
+    0x0000, 0x0000, 0x0000, 0xA65A, 0x0000, 0x92F3, 0xA411, 0x44E3, 0x0000, 0x9452, 0xB0CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x83DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3AAD, 0xB55D, 0x45AB, 0x2422, 0x0000, 0x0000,
+    0x58AA, 0x3BFF, 0x0000, 0x0000, 0x48A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4395, 0x0000, 0x0000, 0x28F1, 0x4879, 0x0000, 0x81DC, 0x972C, 0x0000, 0x0000, 0x293F, 0x0000, 0x9396, 0x427F, 0x0000, 0x9228,
+    0x0000, 0x917D, 0x0000, 0x0000, 0xA261, 0x0000, 0x0000, 0x3E3E, 0xA828, 0x0000, 0x5765, 0x4090, 0x78F4, 0x0000, 0x371D, 0x0000,
+    0x0000, 0x0000, 0x4630, 0x78B1, 0x0000, 0xB30D, 0x0000, 0x85EC, 0x872A, 0x5829, 0x0000, 0x135C, 0x0000, 0x4A6B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x44EE, 0x4003, 0xA223, 0xBA6A, 0x0000, 0x3105, 0x469C, 0x4621, 0x3B3C, 0xBAB1, 0x0000, 0x44D6, 0xA002, 0x36AA,
+    0x252F, 0xBAEC, 0x0000, 0xA9B6, 0x0000, 0x5D7C, 0xB6E2, 0x0000, 0x0000, 0x0000, 0x4AAB, 0x0000, 0x0000, 0x2499, 0x90AA, 0x0000,
+    0x4495, 0x0000, 0xAB6F, 0x0000, 0x3E39, 0x0000, 0x0000, 0x5597, 0x0000, 0x0000, 0x9453, 0x0000, 0x0000, 0x9105, 0x0000, 0x0000,
+    0x3428, 0x0000, 0x0000, 0x1B36, 0x0000, 0x0000, 0x9497, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5DE, 0x1052, 0x226D, 0xA2EF, 0xA766,
+    0x42BA, 0xAAB3, 0x0000, 0x0000, 0x0000, 0x56DC, 0x0000, 0x0000, 0x36BA, 0x0000, 0x0000, 0x1DBC, 0xA3B8, 0x0000, 0x0000, 0x34DB,
+    0x0000, 0x0000, 0x0000, 0x4821, 0xA090, 0x96DE, 0xB51C, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E7C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xACB3, 0x0000, 0xA39E, 0x0000, 0x0000, 0x952C, 0x801B, 0x3279, 0x94B2, 0x0000, 0x0000, 0x0000, 0x100A, 0x0000, 0xA458,
+    0x0000, 0x0000, 0x41CE, 0x0000, 0x4925, 0x89FC, 0x5146, 0x1353, 0x0000, 0x335D, 0x3C74, 0x0000, 0x7052, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5C78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7DFD, 0x0000, 0xA575, 0x3417, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xACBA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA526, 0xBFBF, 0x0000, 0xA065, 0x0000, 0xA39C, 0x0000,
+    0x5FBF, 0x1BFE, 0x0000, 0x0000, 0x0000, 0x46DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x9823, 0x0000, 0x0000, 0xB925, 0x0000, 0x0000,
+    0x0000, 0x4A6E, 0x839C, 0x9AFB, 0x0000, 0x4223, 0x0000, 0x0000, 0x8621, 0x0000, 0x0000, 0x4B76, 0x0000, 0xA765, 0x77A4, 0x4DFE,
+    0xAEFC, 0x0000, 0xA9F5, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA6B, 0x410D, 0x0000, 0x5CFB, 0x4EBE, 0xBCBB, 0x792A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2315, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA18D, 0x5E39, 0x129B, 0x0000, 0x0000, 0x7AB0,
+    0x0000, 0x0000, 0x0000, 0x44E5, 0x0000, 0x0000, 0x0000, 0x0000, 0xBD7C, 0xAAF4, 0x5DBE, 0x0000, 0x15A7, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4575, 0x9575, 0x545A, 0x0000, 0x125A, 0x8395, 0x971F, 0x0000, 0x0000, 0x0000, 0x0000, 0x9661, 0x0000, 0x139F,
+    0x446C, 0x4765, 0x28FE, 0x0000, 0x0000, 0x34D5, 0x0000, 0x0000, 0xA633, 0x0000, 0x9AF3, 0x4AF4, 0x0000, 0x15DD, 0x2662, 0xA6E3,
+    0x5A30, 0x0000, 0xA30E, 0x0000, 0x3B6F, 0x0000, 0x0000, 0x0000, 0x8036, 0x0000, 0x40A2, 0x4871, 0x7050, 0x47AC, 0x0000, 0x810B,
+    0x0000, 0xA824, 0x196F, 0x95EF, 0x0000, 0x0000, 0x0000, 0x9210, 0x97EF, 0x0000, 0xB08B, 0x1525, 0x8153, 0x0000, 0x0000, 0x0000,
+    0x58EC, 0x0000, 0xA1DF, 0x90EB, 0x5C79, 0x0000, 0x3C34, 0x92DB, 0x0000, 0x0000, 0x0000, 0x8973, 0x0000, 0x0000, 0x0000, 0xB75E,
+    0x32D3, 0xA522, 0x897A, 0x0000, 0x0000, 0x0000, 0x48B0, 0x0000, 0x314D, 0x0000, 0x209D, 0xA2E0, 0xA34E, 0x401B, 0x0000, 0xB6A3,
+    0x0000, 0x9438, 0x0000, 0xBC79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21F8, 0x0000, 0xA30D, 0x0000, 0x201B, 0x40F3,
+    0x8362, 0xA293, 0x0000, 0x9045, 0x0000, 0x9E3D, 0x24F7, 0x5293, 0xA493, 0x5411, 0x461B, 0x0000, 0x0000, 0x48EB, 0x0000, 0x0000,
+    0xACFA, 0x283B, 0x0000, 0x0000, 0x0000, 0x4578, 0x0000, 0x3679, 0x114B, 0x90C5, 0x0000, 0x46AC, 0x1663, 0x4522, 0x0000, 0x9C33,
+    0x0000, 0x0000, 0xA2B7, 0x0000, 0x0000, 0x3516, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBD7E, 0x0000, 0xA6F0,
+    0x4C36, 0x0000, 0x1CF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x10C9, 0x93FF, 0x9B3C, 0x0000, 0x4638, 0x0000, 0x57A6, 0x0000, 0x49F5,
+    0x7726, 0x0000, 0x33D7, 0x4356, 0x0000, 0x7C3A, 0x0000, 0x0000, 0xA9EF, 0xA0CC, 0x8764, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x493F, 0x704B, 0x2ABC, 0x0000, 0x0000, 0x0000, 0x4045, 0x432C, 0x0000, 0x76EA, 0x934E, 0x0000, 0x0000, 0x0000, 0x0000, 0x41D7,
+    0x91DF, 0x0000, 0x0000, 0x1668, 0x5CFC, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD3B, 0x0000, 0x0000, 0x0000, 0x80CA, 0x0000, 0x4155,
+    0xB8EC, 0x1093, 0x0000, 0x0000, 0x0000, 0xA7A5, 0x0000, 0xAAEF, 0x3B6E, 0x0000, 0x0000, 0x0000, 0x0000, 0xA86A, 0x4004, 0x4830,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA7B, 0x20D1, 0x0000, 0x48B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x45BE, 0x0000, 0xA517, 0x0000, 0x0000, 0x338F, 0x0000, 0x0000, 0x0000, 0xA67D, 0x0000, 0x3007, 0x0000,
+    0x0000, 0x4065, 0x206E, 0x4D7C, 0xA083, 0x0000, 0x3438, 0x80E7, 0x3825, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x27BA, 0x0000, 0x0000, 0x46E9, 0xA009, 0x0000, 0x802D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4557, 0x9030, 0x0000,
+    0x76EC, 0x9005, 0x0000, 0x8168, 0x0000, 0x22D2, 0x1294, 0x796B, 0x7B7E, 0x3967, 0x9018, 0x0000, 0x0000, 0x0000, 0x0000, 0xA0C6,
+    0x0000, 0x0000, 0x42E6, 0x37EF, 0x4238, 0x9496, 0x8024, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38BA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xBDBE, 0x0000, 0x0000, 0x1831, 0x9494, 0x0000, 0x0000, 0x4977, 0x0000, 0x0000, 0x5397, 0xB86A, 0x256A,
+    0x42D2, 0xA18E, 0x0000, 0x0000, 0x32B2, 0x0000, 0x0000, 0x0000, 0x0000, 0xA72C, 0x3269, 0x435B, 0x0000, 0x23F9, 0x44AA, 0x0000,
+    0x0000, 0x0000, 0x3083, 0x18A8, 0xA871, 0x914D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x44AD, 0xAB2F, 0x0000, 0x0000, 0x0000,
+    0x41EF, 0x0000, 0x3F7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xACB7, 0x0000, 0x24E8, 0x0000, 0x0000, 0x7976, 0xA662,
+    0x0000, 0x0000, 0xA556, 0x80D1, 0x0000, 0xACFC, 0x49BB, 0xA932, 0x1B32, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x43B1, 0x7525, 0x4414, 0x0000, 0x4724, 0x0000, 0x0000, 0x0000, 0x8463, 0x0000, 0x0000, 0x9EBB, 0x4B7B, 0x915D, 0x5556, 0x0000,
+    0x0000, 0x3AF3, 0x0000, 0x0000, 0xB6E4, 0x0000, 0x0000, 0x4324, 0xACB9, 0x0000, 0x88AB, 0x0000, 0x0000, 0x0000, 0xBE7A, 0xAA29,
+    0x0000, 0x0000, 0xA5AB, 0x365D, 0xABBC, 0xA20D, 0x0000, 0x0000, 0x731B, 0x85AB, 0x0000, 0x0000, 0x3085, 0x0000, 0x8161, 0x3927,
+    0x0000, 0x0000, 0x0000, 0x227F, 0x0000, 0x920C, 0xA107, 0x0000, 0x5AB2, 0x924F, 0x0000, 0x0000, 0xA15A, 0x0000, 0x829C, 0x0000,
+    0x0000, 0xA047, 0x4565, 0xA3B1, 0x2A7B, 0x0000, 0x44FB, 0x0000, 0xA05C, 0x0000, 0x0000, 0x0000, 0x3C35, 0x0000, 0x98E5, 0x0000,
+    0x0000, 0x4EFF, 0x0000, 0x0000, 0x2B3E, 0x46BE, 0x0000, 0x10D2, 0x0000, 0x0000, 0x21CE, 0x0000, 0x973C, 0xB001, 0x5AF3, 0x93EF,
+    0x0000, 0x0000, 0x0000, 0xB315, 0x0000, 0xA4DA, 0x0000, 0x0000, 0x0000, 0xA22C, 0x0000, 0x0000, 0x559E, 0x0000, 0x0000, 0x9C34,
+    0x0000, 0x0000, 0x0000, 0x28EC, 0x0000, 0x0000, 0x0000, 0x35FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x11D6, 0x0000, 0x0000, 0x0000,
+    0x1156, 0x0000, 0xB9AD, 0x4C73, 0x5661, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA175, 0x0000, 0x0000, 0xA356, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA09D, 0x292D, 0x0000, 0x0000, 0x534E, 0x0000, 0x9230, 0x776C, 0x3765, 0x5D3D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x969D, 0x0000, 0x0000, 0x83B1, 0x710E, 0x7091, 0xA1CF, 0x372C, 0x0000, 0x0000, 0x0000, 0x5B35, 0x0000, 0x0000,
+    0x538F, 0xB862, 0x57A5, 0x41EA, 0x3A6E, 0x0000, 0x361B, 0x493C, 0x0000, 0x2036, 0xA96E, 0x0000, 0x0000, 0x40CB, 0x0000, 0x9087,
+    0x0000, 0x3147, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x479F, 0x0000, 0x0000, 0x2090, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA321, 0x0000, 0x9F3E, 0xA061, 0x49A7, 0x320F, 0x4085, 0x0000, 0x0000, 0x0000, 0xA3AA, 0x0000, 0x3A2D, 0x0000, 0x235F, 0x0000,
+    0x9071, 0x9B7D, 0x3DB7, 0x1498, 0x0000, 0x36F3, 0x0000, 0x14A3, 0x2276, 0x0000, 0x0000, 0x0000, 0x0000, 0xBF7E, 0x0000, 0xB59F,
+    0x0000, 0x0000, 0x3049, 0x0000, 0x3416, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xACF4, 0x0000, 0x0000, 0x3E3F,
+    0x0000, 0x0000, 0xA1A6, 0x0000, 0xA415, 0x0000, 0x0000, 0x33F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x41A2, 0xA52C, 0x4362, 0x36DE,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA42B, 0x34B2, 0x0000, 0x352C, 0x0000, 0x0000, 0x0000, 0x0000, 0x4865, 0xAAAC, 0x0000, 0x219B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1115, 0x0000, 0x0000, 0x1A73, 0x5DBD, 0x0000, 0xA966, 0x0000, 0x58AB, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x14E2, 0x0000, 0x472A, 0x28EA, 0xB4DA, 0x0000, 0x74DD, 0x0000, 0x0000, 0xB764, 0x0000, 0x0000, 0x98BA, 0x0000, 0x0000,
+    0x208B, 0xA354, 0x3411, 0x0000, 0x4BFF, 0x47F7, 0x0000, 0x0000, 0xACF5, 0x0000, 0x5AAB, 0x0000, 0x52D3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B2D, 0x0000, 0x91AE, 0x0000, 0x8089, 0x741A, 0x0000, 0x151E, 0x0000, 0x0000, 0x2D3D,
+    0x4BB6, 0x88BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96BA, 0x0000, 0x4A6D, 0x0000, 0x5CB3, 0x0000, 0x5A6A, 0x0000,
+    0x0000, 0x9E3E, 0x5452, 0x0000, 0xA413, 0x9F7F, 0x0000, 0x0000, 0x0000, 0x421A, 0x0000, 0x5BF6, 0x0000, 0x40BA, 0x73D5, 0x8120,
+    0x4ABC, 0x0000, 0x0000, 0x938F, 0x0000, 0x0000, 0x0000, 0x0000, 0xBF3D, 0x0000, 0x75A5, 0x45FF, 0x0000, 0x0000, 0x0000, 0x43BE,
+    0x0000, 0x355D, 0x86BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BFD, 0x51CF, 0x41A9, 0x7253, 0x4114, 0x44D7, 0x80DE, 0x55DE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C7A, 0x0000, 0xA20E, 0x0000,
+    0x0000, 0x38FB, 0x0000, 0x3461, 0x0000, 0x959E, 0x0000, 0x0000, 0x0000, 0x9175, 0x0000, 0x21DC, 0x0000, 0x1722, 0x0000, 0x0000,
+    0x0000, 0x22E6, 0x408B, 0x0000, 0x95FF, 0x0000, 0x0000, 0x14E4, 0x5BB6, 0x0000, 0xA8AA, 0x0000, 0x0000, 0x0000, 0x31F7, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xB821, 0x0000, 0x20DE, 0x0000, 0x0000, 0x0000, 0x9334, 0x0000, 0x0000, 0x4153, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8F8, 0x0000, 0x4B6E, 0x40C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x93E7, 0x4422,
+    0x4315, 0x245A, 0x0000, 0x971D, 0x0000, 0x0000, 0x0000, 0x3430, 0x0000, 0x5354, 0x0000, 0x549B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x410B, 0xA5DF, 0x928F, 0x0000, 0x4766, 0x0000, 0x0000, 0x0000, 0x5499, 0x496D, 0x0000, 0x0000, 0x85F3, 0x0000, 0x5396, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x361A, 0xA723, 0x0000, 0x0000, 0x5493, 0x0000, 0x0000, 0xABF7, 0x3006, 0x4E7F, 0x0000, 0x0000, 0x0000,
+    0x324C, 0x524A, 0x0000, 0x0000, 0x4723, 0x0000, 0x3B75, 0x0000, 0x0000, 0x4499, 0x45FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B33,
+    0x211F, 0x0000, 0x4BBC, 0xA291, 0x94D6, 0xA469, 0x50C4, 0x0000, 0x0000, 0x0000, 0xA452, 0x4418, 0x0000, 0x0000, 0x81E3, 0x0000,
+    0xBA30, 0x0000, 0x41F7, 0x0000, 0x0000, 0xB9A7, 0x0000, 0xB2CC, 0x469E, 0x708C, 0x30C6, 0x235B, 0x0000, 0x0000, 0x8779, 0xA28D,
+    0x88EA, 0x0000, 0x0000, 0x435F, 0x0000, 0x7421, 0x0000, 0x0000, 0x4863, 0x4094, 0x1AF1, 0x0000, 0x3E3D, 0x3E7B, 0x0000, 0x7113,
+    0x0000, 0x0000, 0x23EB, 0x0000, 0x0000, 0x35DF, 0x5620, 0x4049, 0x0000, 0x0000, 0xB18D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x375F, 0x0000, 0x0000, 0xAAF2, 0x0000, 0x0000, 0x4674, 0x0000, 0x5724, 0xB8A9, 0x0000, 0x0000, 0xA12C, 0x0000, 0x4411,
+    0x276B, 0x472E, 0xA4BF, 0x0000, 0xA6A8, 0x0000, 0x45B9, 0x0000, 0x4417, 0x3EBF, 0x0000, 0x44DA, 0x3030, 0x9EFF, 0xA5B9, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x412C, 0x0000, 0x4EFE, 0x4AEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA75F, 0xA5A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x3AB2, 0x0000, 0xA092, 0x0000, 0x0000, 0x0000, 0x4038, 0x4D7E, 0x0000, 0x0000,
+    0x0000, 0xA10D, 0x0000, 0x3413, 0x0000, 0x0000, 0x0000, 0xB7A7, 0x155F, 0x0000, 0x5E7A, 0xB6DC, 0x9DBE, 0x365E, 0x0000, 0xA77D,
+    0x8977, 0x0000, 0x0000, 0xA24E, 0xB59D, 0x0000, 0xA2BA, 0x0000, 0x0000, 0x0000, 0x4479, 0x99BE, 0x0000, 0x0000, 0x0000, 0xA4BA,
+    0x0000, 0x3008, 0x0000, 0xADBD, 0x33EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x965E, 0x0000, 0x0000, 0x0000, 0x3CF6, 0x8B3E,
+    0x0000, 0x551C, 0x0000, 0x0000, 0x0000, 0xAA2C, 0x0000, 0xA35D, 0x0000, 0x0000, 0x0000, 0x5B75, 0x96B2, 0x0000, 0x0000, 0x4827,
+    0x0000, 0x0000, 0x0000, 0x9EBD, 0x8223, 0x0000, 0x24B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7357, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xAE7E, 0x0000, 0x0000, 0xAD37, 0x0000, 0x4563, 0x0000, 0xBCFA, 0x0000, 0x3A6C, 0x4298, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x431C, 0xA043, 0x4105, 0x0000, 0x0000, 0xAE7C, 0x961B, 0x910C, 0x0000, 0x151A, 0x0000, 0x0000, 0x94D5, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x465A, 0x4660, 0x0000, 0x0000, 0x0000, 0x82D9, 0x0000, 0x0000, 0x0000, 0x32AA, 0x0000, 0xA35B, 0xA028,
+    0xAD77, 0x0000, 0x0000, 0x95AE, 0x0000, 0x0000, 0x909A, 0x0000, 0xA9AE, 0x0000, 0x0000, 0x0000, 0x4001, 0x0000, 0x0000, 0x70CD,
+    0xA3B6, 0x4235, 0x0000, 0x0000, 0x461D, 0x0000, 0x0000, 0x0000, 0xA24D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA494, 0xA725,
+    0x0000, 0x14A1, 0x0000, 0x0000, 0x0000, 0xA428, 0x0000, 0x0000, 0x3A2C, 0xA9FF, 0x205C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x8BB7, 0x0000, 0x0000, 0x8077, 0x0000, 0x4EBC, 0x0000, 0x0000, 0x0000, 0x7CF9, 0x0000, 0xA8AB, 0x0000, 0x4089, 0x4321, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x42DB, 0x0000, 0xA6E2, 0x397D, 0x0000, 0x0000, 0x0000, 0x2250, 0xA02D, 0x0000, 0xABFF, 0x30B2, 0x7294,
+    0x0000, 0x4493, 0x38E5, 0x0000, 0x431E, 0x0000, 0x4397, 0x0000, 0x2973, 0x0000, 0x3165, 0x0000, 0x4AFB, 0x475F, 0x0000, 0x9C77,
+    0x992C, 0x176C, 0x0000, 0x0000, 0xACBB, 0x57E6, 0x44BF, 0xA0AF, 0x0000, 0x0000, 0xB18F, 0x0000, 0xA628, 0x0000, 0x0000, 0xB829,
+    0x0000, 0x361F, 0x0000, 0x4679, 0xA38F, 0x25FA, 0x0000, 0x46F0, 0x0000, 0x0000, 0xAF3F, 0x0000, 0x4018, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA471, 0x0000, 0xB18E, 0x0000, 0x0000, 0xA8B0, 0x0000, 0x0000, 0x1AB0, 0x0000, 0x0000, 0x528B, 0x0000,
+    0x38A4, 0x2119, 0x4737, 0xA7AC, 0x2873, 0x0000, 0x0000, 0x4DBE, 0x0000, 0x26F6, 0x9413, 0x3D35, 0x0000, 0x0000, 0x0000, 0x4AF9,
+    0x0000, 0x919E, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1EA, 0x5083, 0x75E6, 0x0000, 0x0000, 0x40FB, 0x0000, 0x955D, 0x8529, 0x9565,
+    0x0000, 0x714B, 0x0000, 0x0000, 0x324A, 0x0000, 0x0000, 0xAEBC, 0x83F2, 0x41BE, 0x0000, 0x0000, 0x0000, 0xA024, 0x40B2, 0x0000,
+    0xA8E7, 0x34F3, 0x0000, 0x0000, 0x0000, 0xA926, 0x0000, 0x0000, 0xBEBB, 0x34D4, 0x5C38, 0x0000, 0x24A0, 0x0000, 0x0000, 0x99EF,
+    0x0000, 0x0000, 0x403F, 0x0000, 0x0000, 0x0000, 0xA61F, 0x0000, 0xA069, 0x0000, 0x9EBC, 0x0000, 0x80A6, 0x0000, 0x41CF, 0x5D7D,
+    0x0000, 0x0000, 0x592D, 0x0000, 0x0000, 0x4620, 0x9BB6, 0x3724, 0x49EE, 0x18F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA630,
+    0xA0B2, 0x99AE, 0x0000, 0x0000, 0xAE3E, 0x43E7, 0x4BBE, 0x0000, 0x20E7, 0xA0D1, 0x0000, 0x9CBA, 0x0000, 0x0000, 0x0000, 0x433C,
+    0x2578, 0x0000, 0xABF6, 0xA2EB, 0x0000, 0x465D, 0x0000, 0x0000, 0x0000, 0x1CFD, 0x0000, 0x0000, 0xB146, 0x0000, 0x35F7, 0xA563,
+    0x0000, 0x0000, 0x4079, 0x2B35, 0x928B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19ED, 0x8A31, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x417D, 0x0000, 0x4AAE, 0x961F, 0xB6A1, 0x9292, 0x0000, 0x0000, 0x0000, 0x0000, 0x204A, 0xA2E6,
+    0x392C, 0x85B9, 0xBD3C, 0xABBE, 0x0000, 0x5660, 0x88F8, 0x0000, 0x40AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xA001, 0xB452, 0xA8EB,
+    0xAC35, 0x0000, 0x0000, 0x356D, 0x0000, 0x0000, 0x0000, 0x32A2, 0xA2CD, 0x9456, 0x0000, 0x0000, 0x0000, 0x9007, 0x3414, 0x3CF7,
+    0x0000, 0x0000, 0x7B3D, 0x0000, 0x0000, 0x0000, 0xB3D7, 0x0000, 0x43A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9838, 0x0000,
+    0x292B, 0x0000, 0x3BBE, 0x0000, 0x0000, 0x835B, 0xA3EF, 0x0000, 0x54DC, 0x0000, 0xAAB1, 0x334F, 0x0000, 0xA438, 0xB089, 0x1357,
+    0x9865, 0x0000, 0x0000, 0x0000, 0x39EF, 0x0000, 0x5868, 0xA6E9, 0xA49B, 0xB49A, 0x0000, 0x0000, 0x429A, 0x5C39, 0x393C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C33, 0x0000, 0x0000, 0x4C79, 0x0000, 0x0000, 0x81EA, 0x851D, 0x0000, 0x0000, 0x46E4,
+    0x8A3A, 0xA269, 0x0000, 0x2522, 0xAC34, 0x0000, 0x49B4, 0xA24A, 0x0000, 0x930D, 0x0000, 0x0000, 0x0000, 0x0000, 0xA252, 0xA4E3,
+    0x0000, 0x0000, 0x0000, 0x9EFE, 0x0000, 0x3124, 0x445A, 0x9209, 0x80AF, 0x0000, 0x92A2, 0x469F, 0x0000, 0x3CBA, 0x0000, 0x0000,
+    0x5D76, 0x37BE, 0x4413, 0x0000, 0x0000, 0x0000, 0x0000, 0xA038, 0x8DBD, 0x0000, 0xAA70, 0x9454, 0x328E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x428D, 0x87A5, 0x8AF4, 0xA775, 0x416D, 0x4868, 0x0000, 0x0000, 0x0000, 0x5662, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x365A, 0xB0CA, 0x0000, 0x0000, 0x9C74, 0xB92B, 0x0000, 0x31FF, 0x434E, 0x56E2, 0x0000, 0x0000, 0x4428, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x9B34, 0x0000, 0x210B, 0x8BBC, 0x0000, 0x0000, 0x0000, 0xAD76, 0x0000, 0x3D77, 0x0000, 0xAF7F, 0x0000, 0xA69F, 0x0000,
+    0x0000, 0x0000, 0x4F3F, 0x0000, 0xA565, 0x221A, 0x5A31, 0x0000, 0x2356, 0x0000, 0x0000, 0xB723, 0x44A2, 0xBC39, 0x9A71, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x135E, 0x0000, 0x0000, 0x428E, 0xA112, 0x0000, 0x0000, 0x361E, 0x415D, 0x0000, 0x0000, 0x0000, 0x98A6,
+    0x0000, 0x3826, 0x8660, 0x0000, 0x0000, 0x951C, 0x8112, 0x0000, 0x9BF7, 0xA04A, 0x4419, 0x0000, 0x4124, 0xA4B6, 0xA879, 0xA8FB,
+    0x7AB9, 0xAEBD, 0x0000, 0x0000, 0x9E7F, 0x4826, 0xA134, 0x5DFF, 0x933C, 0xB8EA, 0x0000, 0x49F7, 0x0000, 0x3106, 0x0000, 0x0000,
+    0x39A7, 0x75A7, 0x0000, 0x76A4, 0x0000, 0x0000, 0x12DC, 0x2194, 0x0000, 0x9E3A, 0x0000, 0xA967, 0xAD36, 0x0000, 0x0000, 0x9A79,
+    0xA46C, 0x90BA, 0x0000, 0x0000, 0x0000, 0xA0A2, 0x0000, 0x976D, 0x0000, 0x396D, 0x8321, 0x0000, 0x0000, 0x0000, 0x457D, 0x0000,
+    0x0000, 0x25EC, 0x0000, 0x4AF3, 0x0000, 0x0000, 0x9926, 0x0000, 0x0000, 0x0000, 0x0000, 0x4327, 0x4196, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x40E3, 0x0000, 0x0000, 0xA4E5, 0x0000, 0x28BD, 0x0000, 0x0000, 0x95BE, 0x0000, 0x4261, 0x0000, 0x2B76, 0x0000, 0x0000,
+    0xA28F, 0x0000, 0x0000, 0xA868, 0x0000, 0x0000, 0x4292, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB251, 0x0000, 0xB209, 0x0000,
+    0x2024, 0x48E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA59F, 0x0000, 0x5D7E, 0x0000, 0x0000, 0x0000, 0x9047,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90C7, 0x0000, 0x0000, 0x0000, 0xA220, 0x0000, 0x0000, 0x1C3A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA8BA, 0x2089, 0x0000, 0x4C74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4452, 0x0000, 0xA147, 0x0000,
+    0x92EB, 0x0000, 0x9863, 0x0000, 0x0000, 0x0000, 0x7D7B, 0x8235, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5AE, 0x9867, 0x0000, 0x0000,
+    0x0000, 0x3210, 0x892B, 0x0000, 0x0000, 0x328F, 0x0000, 0x0000, 0x965C, 0x0000, 0x9279, 0x0000, 0x0000, 0x0000, 0x0000, 0xB10D,
+    0x0000, 0x0000, 0x0000, 0x8048, 0x0000, 0x0000, 0x0000, 0x4008, 0x0000, 0x7870, 0x0000, 0x4291, 0x91D7, 0x0000, 0xA734, 0x0000,
+    0x0000, 0x0000, 0xA724, 0x0000, 0x2526, 0x0000, 0x47FB, 0x476B, 0x0000, 0x700A, 0x0000, 0xAC75, 0x0000, 0x911C, 0x5766, 0x3E7A,
+    0x86E2, 0xA2CE, 0x0000, 0x4A2D, 0xA1F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9187, 0x0000, 0x0000, 0x4475, 0x0000,
+    0x0000, 0x24A4, 0xB51D, 0x24BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAE3B, 0x4396, 0x0000,
+    0x0000, 0xAA71, 0x30D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x936D, 0x94EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x182A,
+    0x0000, 0x3B2F, 0x4E3C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x410C, 0x0000, 0x0000, 0x0000, 0x0000, 0x2977,
+    0x0000, 0x0000, 0x9C75, 0x7B7C, 0x2053, 0x0000, 0x0000, 0x0000, 0x21EA, 0x0000, 0x0000, 0x0000, 0x26E4, 0x0000, 0x80CC, 0xAC74,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C75, 0x9457, 0x0000, 0x0000, 0x0000, 0xA69C, 0xA3AE,
+    0x0000, 0xB08A, 0x0000, 0x0000, 0x8012, 0x0000, 0x9493, 0x0000, 0x0000, 0xA864, 0x49AF, 0x0000, 0xA0C5, 0x0000, 0x36DC, 0xA830,
+    0x97B6, 0x0000, 0x0000, 0x0000, 0xA1D5, 0x0000, 0x0000, 0x486A, 0x411C, 0xB96C, 0x3F3F, 0x0000, 0x0000, 0x4927, 0x5D3B, 0xB55C,
+    0x0000, 0x4738, 0x0000, 0x3251, 0x0000, 0x0000, 0x311C, 0x455E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1A7A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x8D7C, 0x0000, 0x0000, 0x0000, 0x7722, 0x0000, 0x0000, 0x418D, 0x0000, 0x845A, 0x0000, 0x0000, 0x8731,
+    0x49B6, 0x9165, 0xA2D2, 0x0000, 0x0000, 0x5AB1, 0x3863, 0x8D3D, 0xA529, 0x0000, 0x0000, 0x0000, 0xB9AE, 0x9B75, 0x2291, 0x0000,
+    0x0000, 0x975E, 0xA14E, 0x0000, 0x514D, 0x0000, 0x0000, 0xAB33, 0xAA6A, 0x0000, 0xA006, 0x8475, 0x0000, 0x90A2, 0xA2AA, 0x41E3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9C37, 0x0000, 0xA534, 0x2723, 0x4B74, 0xA9A7, 0x0000, 0x0000, 0xA8E4, 0x0000, 0x41A6, 0x0000,
+    0x0000, 0x45B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x333C, 0x1219, 0x0000,
+    0x2BB7, 0x0000, 0x0000, 0x47EF, 0x3775, 0x9107, 0x0000, 0x1933, 0x0000, 0x0000, 0x0000, 0x3E7F, 0x5DFE, 0x0000, 0xA5B6, 0x0000,
+    0x0000, 0x0000, 0x7974, 0x0000, 0x5105, 0x5723, 0x9069, 0x0000, 0x3114, 0x0000, 0x0000, 0x0000, 0x0000, 0xA120, 0x0000, 0x0000,
+    0x0000, 0x41F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7566, 0x442B, 0x1AF5, 0x0000, 0x0000, 0x0000, 0x324E, 0xAC76, 0x0000,
+    0x0000, 0x365B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x772D, 0xA4D7, 0x0000, 0x0000, 0x0000, 0x4046, 0x0000,
+    0x0000, 0xA17D, 0xA4E1, 0x18ED, 0x3493, 0x586A, 0xB765, 0x98B2, 0x82D4, 0x0000, 0x32CC, 0x504A, 0x0000, 0x0000, 0xA0F3, 0x0000,
+    0x0000, 0x26A8, 0x16AB, 0x0000, 0x0000, 0x186B, 0xAE7D, 0xA619, 0x0000, 0xA14D, 0x0000, 0x0000, 0x2832, 0x0000, 0x0000, 0x0000,
+    0x1A39, 0x996D, 0xB187, 0x0000, 0x0000, 0x0000, 0x0000, 0x231E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B3C, 0x0000, 0x76E1,
+    0x0000, 0x18B3, 0x0000, 0xB291, 0x1AB9, 0x0000, 0x0000, 0xA925, 0x0000, 0x3C73, 0x0000, 0x0000, 0x0000, 0xA14C, 0x0000, 0x0000,
+    0x0000, 0x4822, 0x0000, 0xA1FF, 0x852F, 0xA5E7, 0x46A2, 0x3CB5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5D3C, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ABB, 0xA196, 0x0000, 0xBAAB, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B2E, 0xA419, 0x7A39,
+    0x0000, 0x0000, 0x7DBC, 0x0000, 0x9C31, 0x0000, 0xA61C, 0x0000, 0x0000, 0xA087, 0x9428, 0x0000, 0x8CB9, 0x0000, 0x0000, 0x4165,
+    0x0000, 0x0000, 0x0000, 0x332C, 0x9826, 0x4B7D, 0xBAF3, 0xA31A, 0xA52F, 0x4967, 0x0000, 0x0000, 0x45DE, 0x0000, 0x0000, 0xAABC,
+    0x0000, 0x4457, 0x0000, 0x4C34, 0xB8E4, 0x92CE, 0x4116, 0xBE39, 0x3FBF, 0xB14C, 0xA557, 0x0000, 0x45DF, 0x0000, 0x0000, 0x0000,
+    0x1212, 0x7BB4, 0x9E7A, 0x4C76, 0x0000, 0x31DF, 0x0000, 0x0000, 0xA76F, 0x0000, 0x0000, 0x7AFC, 0x4147, 0x0000, 0x472C, 0x823E,
+    0x5355, 0xA96D, 0x7011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAAF, 0x0000, 0x0000, 0x9F7E, 0x0000, 0x0000, 0x2633, 0xA53C,
+    0x81CE, 0x0000, 0x0000, 0x47A5, 0x0000, 0x27F4, 0x45E7, 0x0000, 0x0000, 0x0000, 0x0000, 0xA0D5, 0x0000, 0x0000, 0x9557, 0x0000,
+    0x0000, 0x34EB, 0x0000, 0x0000, 0x0000, 0x0000, 0xA218, 0x420C, 0x349A, 0x9827, 0xA29C, 0x0000, 0x961D, 0x0000, 0x0000, 0xA1A2,
+    0x0000, 0x892D, 0x78F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x3671, 0x846C, 0x5CB9, 0x48A3, 0x2458, 0x0000, 0x0000, 0x83AA, 0x0000,
+    0x0000, 0x0000, 0x508A, 0xB499, 0xAF3D, 0x42AA, 0x0000, 0x0000, 0x3107, 0xAC32, 0xBA29, 0x428B, 0x0000, 0x0000, 0x0000, 0x3534,
+    0x0000, 0x0000, 0x918E, 0x2660, 0xA0E7, 0x451C, 0xA23E, 0x3C37, 0x0000, 0x0000, 0x0000, 0x42D3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3061, 0x0000, 0x2DBF, 0x7933, 0x0000, 0x0000, 0xB9AF, 0x4A2E, 0x449B, 0x0000, 0x0000, 0x0000, 0x0000, 0x2B7B, 0x957D,
+    0x0000, 0x0000, 0x91BE, 0x0000, 0x2157, 0x0000, 0x0000, 0x0000, 0x0000, 0x436D, 0xA475, 0x0000, 0x0000, 0x418F, 0x114F, 0x0000,
+    0x0000, 0x4354, 0xA33C, 0x0000, 0x0000, 0xA395, 0x0000, 0xA9BE, 0x46F3, 0xA977, 0xA6AA, 0x2B33, 0x255C, 0x4A71, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x37AE, 0xA008, 0x0000, 0x0000, 0x97FF, 0x4461, 0x5AF4, 0x0000, 0x37A6, 0x0000, 0x0000, 0xA5F3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA45A, 0x0000, 0x0000, 0xA873, 0x0000, 0x0000, 0x4AB1, 0x89B4, 0x0000, 0x3EFE, 0x4086, 0x518E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAC33, 0xB8AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA516, 0x5BB7, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA65B, 0x1197, 0x0000, 0x1870, 0x571D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA499, 0x8328, 0x46DC, 0x0000, 0x1A78, 0x4120, 0x0000, 0x49EF, 0x4469, 0xB042, 0x0000, 0xA669, 0x5B74, 0x0000,
+    0x91CF, 0x3823, 0xBAF4, 0x0000, 0x2065, 0x3084, 0x3AEE, 0x0000, 0x0000, 0x4230, 0x27ED, 0x3838, 0x0000, 0x30A2, 0x0000, 0xA210,
+    0x0000, 0x0000, 0xB661, 0xA674, 0x0000, 0x0000, 0x0000, 0xA6FB, 0x0000, 0x462A, 0x9220, 0x0000, 0xA4DC, 0x0000, 0x7D7F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x59A7, 0x3045, 0x0000, 0x0000, 0x0000, 0x0000, 0x369C, 0x9417, 0x0000, 0x7115, 0x5BF7, 0x4069, 0x310C,
+    0x3A2B, 0x4E7A, 0x920E, 0x0000, 0x0000, 0x377D, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A7, 0x0000, 0xBDFE, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x859D, 0x0000, 0x0000, 0x0000, 0x0000, 0x8157, 0xA007, 0x0000, 0x4D35, 0x3AEF, 0xA0FB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19B5, 0x0000, 0x0000, 0x0000, 0xB10B, 0xA21A, 0x0000,
+    0x0000, 0x0000, 0xBAB2, 0x0000, 0x0000, 0x0000, 0x8276, 0x96DC, 0x0000, 0x0000, 0x7394, 0xA73C, 0x0000, 0x0000, 0x0000, 0xB69B,
+    0x0000, 0x4F7E, 0xA62A, 0x0000, 0x9824, 0x2CBB, 0x0000, 0x43EB, 0x9671, 0x0000, 0x0000, 0x38E6, 0x3830, 0xA157, 0x0000, 0x0000,
+    0x3028, 0x0000, 0x0000, 0xA28C, 0x9825, 0xA0D3, 0x0000, 0x0000, 0x912C, 0x0000, 0x5B76, 0x4228, 0xBCB3, 0x0000, 0x0000, 0x7498,
+    0x0000, 0x0000, 0x0000, 0x17A4, 0x0000, 0x0000, 0x5315, 0x0000, 0x19AC, 0x0000, 0x3E3B, 0x371F, 0x0000, 0x56A1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x35E7, 0x0000, 0x4134, 0xA3F2, 0x0000, 0x1D7F, 0x0000, 0x0000, 0x0000, 0xA334, 0x8737, 0x0000, 0x0000, 0x402D,
+    0x4ABA, 0x40C6, 0xAAEC, 0x4A2B, 0x34E3, 0x0000, 0x87AC, 0x0000, 0x3BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x9669, 0x0000, 0x8ABC,
+    0x3175, 0xACB6, 0x0000, 0xA97A, 0x0000, 0x4E3F, 0x21F1, 0x8094, 0x0000, 0x4CFC, 0x4966, 0x0000, 0x0000, 0x0000, 0x7353, 0x420F,
+    0x0000, 0x3734, 0x0000, 0x0000, 0x0000, 0x59EF, 0x9D77, 0x0000, 0x3CF5, 0x0000, 0x0000, 0xA838, 0x0000, 0x4597, 0xB1CE, 0xA9FC,
+    0xA49A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C72, 0x0000, 0x48BA, 0x0000, 0x0000, 0xA414, 0x2AB3, 0xA772, 0xBA31, 0x0000,
+    0x0000, 0x0000, 0xA459, 0x759C, 0x592B, 0x0000, 0xA57D, 0x0000, 0x0000, 0x2A72, 0x4112, 0x0000, 0x8313, 0x84F7, 0x0000, 0x0000,
+    0x7668, 0x9324, 0x4BF7, 0xA1A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x3412, 0x0000, 0x0000, 0xB048, 0x0000, 0x2395, 0x46A3, 0x3415,
+    0x8873, 0x0000, 0x37B6, 0x42D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB96D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2434, 0x7258, 0x4209, 0x5187, 0x4375, 0x0000, 0x0000, 0x0000, 0x8567, 0x0000, 0x23F2, 0xA638,
+    0x0000, 0x0000, 0x320B, 0x710A, 0x45AE, 0x0000, 0x0000, 0x0000, 0x4092, 0x0000, 0x48A4, 0x4C77, 0x0000, 0x9556, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3565, 0x428C, 0x467D, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2AE, 0x0000, 0x0000, 0x89AF,
+    0x7CBC, 0x0000, 0x4355, 0x3146, 0x0000, 0xA69B, 0x0000, 0x928D, 0x0000, 0x0000, 0x5458, 0xAAB2, 0x54D4, 0x0000, 0x93A6, 0x9DFF,
+    0x924B, 0x0000, 0x0000, 0x1872, 0x317D, 0x0000, 0xA866, 0x4F3D, 0xA4AA, 0x93B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x804A, 0x82AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x2674, 0x0000, 0x44E8, 0x0000, 0x0000, 0x0000, 0xB766, 0x0000, 0x0000,
+    0x867D, 0x4669, 0x3669, 0x0000, 0x9734, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C77, 0x5419, 0x0000, 0x0000, 0x0000, 0x2567, 0x7523,
+    0x0000, 0xA973, 0x0000, 0xA59E, 0x0000, 0x34A2, 0xB8A3, 0x4471, 0x0000, 0x0000, 0xBCB9, 0xA036, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA004, 0x0000, 0x0000, 0x45A6, 0x330F, 0xA0A6, 0x0000, 0x815A, 0x5BB5, 0x0000, 0x49AE, 0x0000, 0x0000, 0x0000, 0x9515,
+    0x0000, 0x0000, 0x0000, 0x920A, 0xA69E, 0x0000, 0x0000, 0x4C39, 0x5B34, 0x4412, 0x0000, 0x9414, 0x7C7B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4D3B, 0x98A7, 0x0000, 0x0000, 0x52D2, 0x0000, 0xA5F7, 0x0000, 0xABAF, 0x979F, 0xA420, 0x0000, 0x19F6, 0x0000, 0x19B7,
+    0x0000, 0x0000, 0x0000, 0x508B, 0x0000, 0x3C79, 0x0000, 0x0000, 0xADBE, 0x0000, 0x92CC, 0xA194, 0xA7EF, 0x0000, 0xAEFD, 0x0000,
+    0x8CBB, 0xB4DC, 0x31CF, 0x0000, 0x3AAB, 0x8571, 0x0000, 0xBBF6, 0x0000, 0x0000, 0x43FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x329A, 0x0000, 0x0000, 0x4415, 0x0000, 0x0000, 0x0000, 0x0000, 0x8932, 0x7088, 0x8458, 0x28F8, 0x3821, 0x0000, 0x0000, 0x419B,
+    0x0000, 0x0000, 0xA0CB, 0x82E6, 0x4661, 0x47BA, 0xA7E6, 0x0000, 0x0000, 0x0000, 0x749C, 0x0000, 0x0000, 0x0000, 0x48E6, 0x88FE,
+    0x0000, 0x46F6, 0x196B, 0x0000, 0x20CC, 0x21B0, 0x42B7, 0x4633, 0x0000, 0xAE3C, 0x0000, 0x0000, 0x0000, 0x3867, 0x0000, 0x46EB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4CFB, 0xA7B3, 0x3C32, 0x88F1, 0x3EBB, 0x0000, 0x471D, 0x0000,
+    0x0000, 0xA92C, 0x510B, 0x2571, 0x0000, 0x3261, 0x0000, 0x0000, 0x0000, 0x0000, 0xB314, 0xA59D, 0x0000, 0x0000, 0x0000, 0x7154,
+    0x9638, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4369, 0x0000, 0x0000, 0x0000, 0xA8F3, 0x4873, 0x0000, 0xA61B, 0x0000, 0x766A,
+    0x0000, 0x855C, 0x22D4, 0x0000, 0x9C38, 0x0000, 0x0000, 0x4516, 0x0000, 0x0000, 0x328B, 0x0000, 0x0000, 0x4AAD, 0x0000, 0x0000,
+    0xA5FF, 0x0000, 0x79ED, 0x8090, 0x822C, 0x0000, 0xA1E7, 0x4AEC, 0x0000, 0x0000, 0x0000, 0xA36D, 0x82D2, 0xA116, 0x0000, 0x0000,
+    0x0000, 0x9083, 0x48B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16E5, 0x21A2, 0x0000, 0x814E, 0x4259, 0x4AEE, 0x98FB, 0x0000,
+    0x3005, 0x0000, 0x5821, 0x0000, 0x0000, 0x25E5, 0x0000, 0x0000, 0x8250, 0x3002, 0x4463, 0x0000, 0x4106, 0x48AA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7AF5, 0x8A72, 0x0000, 0x4628, 0xBCFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x4454, 0x0000, 0x0000, 0x48A5, 0x0000,
+    0x9E7E, 0x0000, 0x9C35, 0x0000, 0x0000, 0x0000, 0x8AF9, 0xAB2D, 0x99FF, 0x29F5, 0x0000, 0x38A5, 0x0000, 0xA5FA, 0x0000, 0x8829,
+    0x0000, 0x42EB, 0x9218, 0x0000, 0x359E, 0xAE39, 0x969B, 0x0000, 0x4F7F, 0xAA6E, 0x0000, 0x0000, 0x0000, 0x0000, 0xA01B, 0x2116,
+    0x0000, 0x0000, 0xA7F4, 0x0000, 0x9C73, 0x0000, 0x4007, 0x725A, 0x0000, 0x15A5, 0x0000, 0x57A7, 0x0000, 0x2530, 0x46FB, 0x5CFA,
+    0x8327, 0x287C, 0x0000, 0xA165, 0x0000, 0x42AE, 0x0000, 0x0000, 0x735C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA250, 0x0000, 0x0000, 0x0000, 0x0000, 0x92B2, 0x0000, 0x0000, 0x48A9, 0x0000, 0xA61E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA3D6, 0x0000, 0x0000, 0x592C, 0x29AD, 0x0000, 0x225B, 0x0000, 0x406E, 0x0000, 0x3044, 0x2BBC, 0x98A4,
+    0x0000, 0x24EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16EA, 0x455D, 0xA9AD, 0x0000, 0x98A5,
+    0x0000, 0x549A, 0x82A5, 0x9085, 0x0000, 0xA1E3, 0x8356, 0x0000, 0xA457, 0x0000, 0x0000, 0x0000, 0xA7BE, 0x48F1, 0x0000, 0x422C,
+    0x4456, 0x0000, 0x3934, 0xABB5, 0x371E, 0x0000, 0xA8A4, 0x0000, 0x2737, 0x0000, 0x3A6D, 0xB868, 0x0000, 0x459F, 0x0000, 0x0000};
+
+#endif // CUCKOO_TABLES_H
@@ -0,0 +1,228 @@
+#include "engine_cache.h"
+#include "chess_engine.h"
+#include "chess_utils.h"
+
+EngineCache::RamEntry EngineCache::ram[ENGINE_CACHE_RAM_ENTRIES] = {};
+uint32_t EngineCache::tick = 0;
+uint32_t EngineCache::fileRecords = 0;
+uint16_t EngineCache::fileIndex[ENGINE_CACHE_FILE_MAX_RECORDS] = {};
+uint32_t EngineCache::ramHits = 0;
+uint32_t EngineCache::fileHits = 0;
+uint32_t EngineCache::misses = 0;
+SemaphoreHandle_t EngineCache::mutex = nullptr;
+
+static const char PROMOTION_PIECES[] = " nbrq";
+
+void EngineCache::begin() {
+  if (!mutex)
+    mutex = xSemaphoreCreateMutex();
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  size_t bytes = fileSize();
+  fileRecords = bytes / sizeof(EngineCacheRecord);
+  // A torn append (power loss) would misalign every later record
+  if (bytes % sizeof(EngineCacheRecord) != 0 || fileRecords >= ENGINE_CACHE_FILE_MAX_RECORDS)
+    compactFile();
+  else
+    rebuildIndex();
+  Serial.printf("EngineCache: %u records on flash\n", (unsigned)fileRecords);
+  xSemaphoreGive(mutex);
+}
+
+uint64_t EngineCache::positionKey(const String& fen) {
+  // ChessEngine carries a position history, too big for the caller's stack
+  static ChessEngine engine;
+  char board[8][8];
+  char turn;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  ChessUtils::fenToBoard(fen, board, turn, &engine);
+  uint64_t key = engine.computeZobristHash(board, turn);
+  xSemaphoreGive(mutex);
+  return key;
+}
+
+bool EngineCache::lookup(uint64_t key, int depth, StockfishResponse& response) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  EngineCacheRecord record;
+  bool found = false;
+  for (int i = 0; i < ENGINE_CACHE_RAM_ENTRIES; i++) {
+    if (ram[i].lastUsed && ram[i].record.key == key && ram[i].record.depth == depth) {
+      ram[i].lastUsed = ++tick;
+      record = ram[i].record;
+      ramHits++;
+      found = true;
+      break;
+    }
+  }
+  if (!found && findInFile(key, depth, record)) {
+    remember(record);
+    fileHits++;
+    found = true;
+  }
+  if (!found)
+    misses++;
+  xSemaphoreGive(mutex);
+  if (!found)
+    return false;
+
+  response.success = true;
+  response.hasMate = record.flags & 0x01;
+  response.mateInMoves = response.hasMate ? record.score : 0;
+  response.evaluation = response.hasMate ? 0.0f : record.score / 100.0f;
+  response.bestMove = unpackMove(record.bestMove);
+  response.ponderMove = unpackMove(record.ponderMove);
+  response.continuation = "";
+  response.errorMessage = "";
+  return true;
+}
+
+void EngineCache::store(uint64_t key, int depth, const StockfishResponse& response) {
+  EngineCacheRecord record;
+  record.key = key;
+  record.depth = depth;
+  record.flags = response.hasMate ? 0x01 : 0x00;
+  record.bestMove = packMove(response.bestMove);
+  record.ponderMove = packMove(response.ponderMove);
+  long score = response.hasMate ? response.mateInMoves : lroundf(response.evaluation * 100.0f);
+  record.score = constrain(score, -32767L, 32767L);
+  if (record.bestMove == 0)
+    return; // Nothing worth replaying (e.g. game already over)
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  remember(record);
+  appendToFile(record);
+  xSemaphoreGive(mutex);
+}
+
+size_t EngineCache::getFileBytes() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  size_t bytes = fileRecords * sizeof(EngineCacheRecord);
+  xSemaphoreGive(mutex);
+  return bytes;
+}
+
+size_t EngineCache::fileSize() {
+  if (!LittleFS.exists(ENGINE_CACHE_PATH))
+    return 0;
+  File f = LittleFS.open(ENGINE_CACHE_PATH, "r");
+  size_t size = f ? f.size() : 0;
+  f.close();
+  return size;
+}
+
+void EngineCache::remember(const EngineCacheRecord& record) {
+  // Replace the same (key, depth), else the least recently used slot
+  RamEntry* victim = &ram[0];
+  for (int i = 0; i < ENGINE_CACHE_RAM_ENTRIES; i++) {
+    if (ram[i].lastUsed && ram[i].record.key == record.key && ram[i].record.depth == record.depth) {
+      victim = &ram[i];
+      break;
+    }
+    if (ram[i].lastUsed < victim->lastUsed)
+      victim = &ram[i];
+  }
+  victim->record = record;
+  victim->lastUsed = ++tick;
+}
+
+void EngineCache::rebuildIndex() {
+  File f = LittleFS.open(ENGINE_CACHE_PATH, "r");
+  uint32_t indexed = 0;
+  if (f) {
+    EngineCacheRecord buf[32];
+    size_t n;
+    while (indexed < fileRecords && (n = f.read((uint8_t*)buf, sizeof(buf)) / sizeof(EngineCacheRecord)) > 0)
+      for (size_t i = 0; i < n && indexed < fileRecords; i++)
+        fileIndex[indexed++] = fingerprint(buf[i].key);
+    f.close();
+  }
+  fileRecords = indexed;
+}
+
+bool EngineCache::findInFile(uint64_t key, uint8_t depth, EngineCacheRecord& record) {
+  uint16_t print = fingerprint(key);
+  File f;
+  // Later records supersede earlier ones, so search from the newest
+  for (int32_t i = (int32_t)fileRecords - 1; i >= 0; i--) {
+    if (fileIndex[i] != print)
+      continue;
+    if (!f && !(f = LittleFS.open(ENGINE_CACHE_PATH, "r")))
+      return false;
+    EngineCacheRecord candidate;
+    if (!f.seek(i * sizeof(EngineCacheRecord)) || f.read((uint8_t*)&candidate, sizeof(candidate)) != sizeof(candidate))
+      break;
+    if (candidate.key == key && candidate.depth == depth) {
+      record = candidate;
+      f.close();
+      return true;
+    }
+  }
+  if (f)
+    f.close();
+  return false;
+}
+
+void EngineCache::appendToFile(const EngineCacheRecord& record) {
+  if (fileRecords >= ENGINE_CACHE_FILE_MAX_RECORDS)
+    compactFile();
+  File f = LittleFS.open(ENGINE_CACHE_PATH, "a");
+  if (!f) {
+    Serial.println("EngineCache: failed to open cache file");
+    return;
+  }
+  if (f.write((const uint8_t*)&record, sizeof(record)) == sizeof(record))
+    fileIndex[fileRecords++] = fingerprint(record.key);
+  f.close();
+}
+
+void EngineCache::compactFile() {
+  // Keep the newest half of the records
+  uint32_t keep = min(fileRecords, (uint32_t)ENGINE_CACHE_FILE_MAX_RECORDS / 2);
+  File src = LittleFS.open(ENGINE_CACHE_PATH, "r");
+  File dst = LittleFS.open(ENGINE_CACHE_TMP_PATH, "w");
+  uint32_t written = 0;
+  if (src && dst && src.seek((fileRecords - keep) * sizeof(EngineCacheRecord))) {
+    EngineCacheRecord buf[32];
+    while (written < keep) {
+      size_t want = min(keep - written, (uint32_t)(sizeof(buf) / sizeof(buf[0])));
+      size_t n = src.read((uint8_t*)buf, want * sizeof(EngineCacheRecord)) / sizeof(EngineCacheRecord);
+      if (n == 0 || dst.write((const uint8_t*)buf, n * sizeof(EngineCacheRecord)) != n * sizeof(EngineCacheRecord))
+        break;
+      written += n;
+    }
+  }
+  if (src) src.close();
+  if (dst) dst.close();
+  LittleFS.remove(ENGINE_CACHE_PATH);
+  LittleFS.rename(ENGINE_CACHE_TMP_PATH, ENGINE_CACHE_PATH);
+  fileRecords = written;
+  rebuildIndex();
+  Serial.printf("EngineCache: compacted cache file to %u records\n", (unsigned)written);
+}
+
+uint16_t EngineCache::packMove(const String& uci) {
+  if (uci.length() < 4 || uci[0] < 'a' || uci[0] > 'h' || uci[1] < '1' || uci[1] > '8' || uci[2] < 'a' || uci[2] > 'h' || uci[3] < '1' || uci[3] > '8')
+    return 0;
+  uint16_t from = (uci[1] - '1') * 8 + (uci[0] - 'a');
+  uint16_t to = (uci[3] - '1') * 8 + (uci[2] - 'a');
+  uint16_t promotion = 0;
+  if (uci.length() > 4) {
+    const char* p = strchr(PROMOTION_PIECES + 1, tolower(uci[4]));
+    if (p)
+      promotion = p - PROMOTION_PIECES;
+  }
+  return from << 9 | to << 3 | promotion;
+}
+
+String EngineCache::unpackMove(uint16_t packed) {
+  if (packed == 0)
+    return "";
+  uint8_t from = packed >> 9, to = (packed >> 3) & 0x3F, promotion = packed & 0x07;
+  String uci;
+  uci += (char)('a' + from % 8);
+  uci += (char)('1' + from / 8);
+  uci += (char)('a' + to % 8);
+  uci += (char)('1' + to / 8);
+  if (promotion > 0 && promotion < 5)
+    uci += PROMOTION_PIECES[promotion];
+  return uci;
+}
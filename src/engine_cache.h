@@ -0,0 +1,77 @@
+#ifndef ENGINE_CACHE_H
+#define ENGINE_CACHE_H
+
+#include "stockfish_api.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Number of positions kept in RAM (LRU)
+#define ENGINE_CACHE_RAM_ENTRIES 64
+// Max records in the cache file; when reached the newest half is kept
+#define ENGINE_CACHE_FILE_MAX_RECORDS 1024
+#define ENGINE_CACHE_PATH "/engine_cache.bin"
+#define ENGINE_CACHE_TMP_PATH "/engine_cache.tmp"
+
+// One cached engine answer. Moves are packed as from << 9 | to << 3 | promotion,
+// with squares as rank * 8 + file (a1 = 0) and promotion 1-4 = n, b, r, q.
+struct __attribute__((packed)) EngineCacheRecord {
+  uint64_t key;        // Zobrist hash of the position
+  uint8_t depth;       // Search depth the answer was computed at
+  uint8_t flags;       // bit0: score is mate-in-N
+  uint16_t bestMove;   // Packed move, 0 = none
+  uint16_t ponderMove; // Packed move, 0 = none
+  int16_t score;       // Centipawns, or moves to mate if bit0 is set
+};
+static_assert(sizeof(EngineCacheRecord) == 16, "EngineCacheRecord must be 16 bytes");
+
+// Best-move cache keyed by (position hash, depth) with an LRU RAM tier in front
+// of an append-only LittleFS file. A 16-bit fingerprint per file record is kept in
+// RAM, so a miss reads only the records whose fingerprint matches. Thread-safe: the
+// engine worker and the main loop both go through StockfishAPI::fetch.
+class EngineCache {
+ public:
+  // Call after LittleFS is mounted, before any other use
+  static void begin();
+
+  // Zobrist hash of a FEN (placement, side to move, castling rights, en passant)
+  static uint64_t positionKey(const String& fen);
+
+  // Fill response from the cache. Returns false on a miss.
+  static bool lookup(uint64_t key, int depth, StockfishResponse& response);
+
+  // Remember a successful engine answer
+  static void store(uint64_t key, int depth, const StockfishResponse& response);
+
+  static uint32_t getRamHits() { return ramHits; }
+  static uint32_t getFileHits() { return fileHits; }
+  static uint32_t getMisses() { return misses; }
+  static size_t getFileBytes(); // Size of the cache file as tracked, no flash access
+
+ private:
+  struct RamEntry {
+    EngineCacheRecord record;
+    uint32_t lastUsed; // 0 = empty slot
+  };
+  static RamEntry ram[ENGINE_CACHE_RAM_ENTRIES];
+  static uint32_t tick;
+  static uint32_t fileRecords;
+  static uint16_t fileIndex[ENGINE_CACHE_FILE_MAX_RECORDS]; // Fingerprint of each file record, in file order
+  static uint32_t ramHits;
+  static uint32_t fileHits;
+  static uint32_t misses;
+  static SemaphoreHandle_t mutex;
+
+  static uint16_t fingerprint(uint64_t key) { return (uint16_t)(key ^ key >> 16 ^ key >> 32 ^ key >> 48); }
+  static size_t fileSize();
+  static void rebuildIndex();
+  static void remember(const EngineCacheRecord& record);
+  static bool findInFile(uint64_t key, uint8_t depth, EngineCacheRecord& record);
+  static void appendToFile(const EngineCacheRecord& record);
+  static void compactFile();
+  static uint16_t packMove(const String& uci);
+  static String unpackMove(uint16_t packed);
+};
+
+#endif // ENGINE_CACHE_H
@@ -0,0 +1,147 @@
+#include "engine_worker.h"
+
+EngineWorker::Job EngineWorker::jobs[ENGINE_WORKER_MAX_JOBS];
+QueueHandle_t EngineWorker::queue = nullptr;
+SemaphoreHandle_t EngineWorker::mutex = nullptr;
+uint32_t EngineWorker::nextId = 1;
+
+void EngineWorker::begin() {
+  if (queue)
+    return;
+  mutex = xSemaphoreCreateMutex();
+  queue = xQueueCreate(ENGINE_WORKER_MAX_JOBS, sizeof(uint8_t));
+  // TLS handshakes need a deep stack; run next to the WiFi stack on core 0
+  xTaskCreatePinnedToCore(workerTask, "EngineWorker", 8192, nullptr, 1, nullptr, 0);
+}
+
+EngineWorker::Job* EngineWorker::findJob(uint32_t id) {
+  for (int i = 0; i < ENGINE_WORKER_MAX_JOBS; i++)
+    if (jobs[i].state != JobState::FREE && jobs[i].id == id)
+      return &jobs[i];
+  return nullptr;
+}
+
+bool EngineWorker::normalJobQueued() {
+  for (int i = 0; i < ENGINE_WORKER_MAX_JOBS; i++)
+    if (jobs[i].state == JobState::QUEUED && !jobs[i].lowPriority && !jobs[i].cancelled.load())
+      return true;
+  return false;
+}
+
+uint32_t EngineWorker::submit(const String& fen, const StockfishSettings& settings, bool lowPriority) {
+  begin();
+  if (fen.length() >= sizeof(jobs[0].fen))
+    return 0;
+  uint32_t id = 0;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (uint8_t i = 0; i < ENGINE_WORKER_MAX_JOBS; i++) {
+    Job& job = jobs[i];
+    if (job.state != JobState::FREE)
+      continue;
+    id = nextId++;
+    if (nextId == 0) nextId = 1;
+    job.id = id;
+    job.state = JobState::QUEUED;
+    job.cancelled.store(false);
+    job.abort.store(false);
+    job.lowPriority = lowPriority;
+    strcpy(job.fen, fen.c_str());
+    job.settings = settings;
+    xQueueSend(queue, &i, 0); // Never blocks: the queue holds one entry per job slot
+    break;
+  }
+  // A running hint or analysis must not hold up the bot: interrupt it, it is requeued
+  if (id != 0 && !lowPriority)
+    for (int i = 0; i < ENGINE_WORKER_MAX_JOBS; i++)
+      if (jobs[i].state == JobState::RUNNING && jobs[i].lowPriority)
+        jobs[i].abort.store(true);
+  xSemaphoreGive(mutex);
+  if (id == 0)
+    Serial.println("Engine worker: All job slots busy");
+  return id;
+}
+
+EngineJobStatus EngineWorker::poll(uint32_t id, StockfishResponse& response) {
+  if (!mutex)
+    return EngineJobStatus::UNKNOWN;
+  EngineJobStatus status = EngineJobStatus::UNKNOWN;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  Job* job = findJob(id);
+  if (job && !job->cancelled.load()) {
+    if (job->state == JobState::DONE) {
+      response = job->response;
+      status = EngineJobStatus::DONE;
+    } else if (job->state == JobState::FAILED) {
+      status = EngineJobStatus::FAILED;
+    } else {
+      status = EngineJobStatus::PENDING;
+    }
+    if (status != EngineJobStatus::PENDING) {
+      job->response = StockfishResponse();
+      job->state = JobState::FREE;
+    }
+  }
+  xSemaphoreGive(mutex);
+  return status;
+}
+
+void EngineWorker::cancel(uint32_t id) {
+  if (!mutex || id == 0)
+    return;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  Job* job = findJob(id);
+  if (job) {
+    // Queued and running jobs are freed by the worker once it reaches them
+    if (job->state == JobState::DONE || job->state == JobState::FAILED) {
+      job->state = JobState::FREE;
+    } else {
+      job->cancelled.store(true);
+      job->abort.store(true);
+    }
+  }
+  xSemaphoreGive(mutex);
+}
+
+void EngineWorker::workerTask(void* param) {
+  uint8_t index;
+  while (true) {
+    if (xQueueReceive(queue, &index, portMAX_DELAY) != pdTRUE)
+      continue;
+    Job& job = jobs[index];
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool skip = job.cancelled.load();
+    if (!skip && job.lowPriority && normalJobQueued()) {
+      // Let the normal requests behind it go first
+      xQueueSend(queue, &index, 0);
+      xSemaphoreGive(mutex);
+      continue;
+    }
+    if (skip)
+      job.state = JobState::FREE;
+    else
+      job.state = JobState::RUNNING;
+    String fen = job.fen;
+    StockfishSettings settings = job.settings;
+    xSemaphoreGive(mutex);
+    if (skip)
+      continue;
+
+    StockfishResponse response;
+    bool ok = StockfishAPI::fetch(fen, settings, response, &job.abort);
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (job.cancelled.load()) {
+      job.state = JobState::FREE;
+    } else if (!ok && job.abort.load()) {
+      // Preempted by a normal request: run it again once that is done
+      job.abort.store(false);
+      job.state = JobState::QUEUED;
+      xQueueSend(queue, &index, 0);
+    } else {
+      job.response = response;
+      job.state = ok ? JobState::DONE : JobState::FAILED;
+    }
+    xSemaphoreGive(mutex);
+  }
+}
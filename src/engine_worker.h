@@ -0,0 +1,68 @@
+#ifndef ENGINE_WORKER_H
+#define ENGINE_WORKER_H
+
+#include "stockfish_api.h"
+#include "stockfish_settings.h"
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// Max requests queued or running at once
+#define ENGINE_WORKER_MAX_JOBS 4
+
+enum class EngineJobStatus {
+  PENDING, // Queued or running
+  DONE,    // Result delivered (consumed by poll)
+  FAILED,  // All attempts failed, result consumed
+  UNKNOWN  // No such request (never submitted, cancelled or already consumed)
+};
+
+// Runs Stockfish requests on a background task so the main loop keeps scanning
+// sensors, serving the web UI and handling touches while the engine thinks.
+class EngineWorker {
+ public:
+  static void begin();
+
+  // Queue a request. Returns its id, or 0 if all job slots are busy.
+  // Low-priority requests wait while any normal request is queued; a running one is
+  // interrupted by a new normal request and runs again after it.
+  static uint32_t submit(const String& fen, const StockfishSettings& settings, bool lowPriority = false);
+
+  // Check a request. DONE copies the result into response and frees the job.
+  static EngineJobStatus poll(uint32_t id, StockfishResponse& response);
+
+  // Drop a request. A running HTTP request is aborted at its next wait.
+  static void cancel(uint32_t id);
+
+ private:
+  enum class JobState : uint8_t {
+    FREE,
+    QUEUED,
+    RUNNING,
+    DONE,
+    FAILED
+  };
+  struct Job {
+    uint32_t id;
+    JobState state;
+    std::atomic<bool> cancelled;
+    std::atomic<bool> abort; // Stops the running request: set on cancel or preemption
+    bool lowPriority;
+    char fen[96];
+    StockfishSettings settings;
+    StockfishResponse response;
+  };
+  static Job jobs[ENGINE_WORKER_MAX_JOBS];
+  static QueueHandle_t queue; // Job indices in submission order
+  static SemaphoreHandle_t mutex;
+  static uint32_t nextId;
+
+  static void workerTask(void* param);
+  static Job* findJob(uint32_t id);
+  static bool normalJobQueued();
+};
+
+#endif // ENGINE_WORKER_H
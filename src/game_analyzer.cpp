@@ -0,0 +1,353 @@
+#include "game_analyzer.h"
+#include "chess_utils.h"
+#include "engine_worker.h"
+#include "move_history.h"
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <algorithm>
+
+static constexpr uint8_t ANALYSIS_FORMAT_VERSION = 1;
+// Centipawn stand-in for mate scores, and the cap used when comparing evaluations
+static constexpr int MATE_CP = 10000;
+static constexpr int BLUNDER_CAP_CP = 1000;
+
+StockfishSettings GameAnalyzer::settings(10, 30000, 2);
+bool GameAnalyzer::autoAnalyze = true;
+bool GameAnalyzer::paused = false;
+std::atomic<int> GameAnalyzer::requestedGameId(0);
+std::vector<int> GameAnalyzer::queue;
+int GameAnalyzer::currentGame = 0;
+std::vector<uint16_t> GameAnalyzer::moves;
+uint32_t GameAnalyzer::fenReadOffset = 0;
+uint16_t GameAnalyzer::nextPosition = 0;
+uint16_t GameAnalyzer::doneCount = 0;
+ChessEngine GameAnalyzer::engine;
+char GameAnalyzer::board[8][8];
+char GameAnalyzer::turn = 'w';
+GameAnalyzer::InFlight GameAnalyzer::inFlight[ANALYSIS_MAX_IN_FLIGHT];
+int GameAnalyzer::inFlightCount = 0;
+int GameAnalyzer::prevCp = 0;
+bool GameAnalyzer::prevValid = false;
+
+static bool readAnalysisHeader(int gameId, AnalysisHeader& hdr) {
+  String path = MoveHistory::analysisPath(gameId);
+  if (!MoveHistory::quietExists(path.c_str()))
+    return false;
+  File f = LittleFS.open(path, "r");
+  bool ok = f && f.read((uint8_t*)&hdr, sizeof(hdr)) == sizeof(hdr) && hdr.version == ANALYSIS_FORMAT_VERSION;
+  if (f) f.close();
+  return ok;
+}
+
+void GameAnalyzer::begin() {
+  File dir = LittleFS.open("/games");
+  if (!dir || !dir.isDirectory())
+    return;
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    String name = f.name();
+    if (!name.startsWith("game_") || !name.endsWith(".ana"))
+      continue;
+    int id = name.substring(5, name.length() - 4).toInt();
+    AnalysisHeader hdr;
+    if (id > 0 && readAnalysisHeader(id, hdr) && hdr.doneCount < hdr.positionCount)
+      queue.push_back(id);
+  }
+  std::sort(queue.begin(), queue.end());
+  if (!queue.empty())
+    Serial.printf("GameAnalyzer: resuming analysis of %d game(s)\n", (int)queue.size());
+}
+
+void GameAnalyzer::configure(const StockfishSettings& newSettings, bool newAutoAnalyze) {
+  settings = newSettings;
+  autoAnalyze = newAutoAnalyze;
+}
+
+bool GameAnalyzer::enqueue(int gameId) {
+  if (gameId == currentGame || std::find(queue.begin(), queue.end(), gameId) != queue.end())
+    return true;
+
+  AnalysisHeader hdr;
+  if (readAnalysisHeader(gameId, hdr)) {
+    if (hdr.doneCount >= hdr.positionCount)
+      return false;
+  } else {
+    // Create the sidecar with every entry pending
+    File game = LittleFS.open(MoveHistory::gamePath(gameId), "r");
+    GameHeader gameHdr;
+    bool ok = game && game.read((uint8_t*)&gameHdr, sizeof(gameHdr)) == sizeof(gameHdr) && gameHdr.moveCount > 0;
+    if (game) game.close();
+    if (!ok)
+      return false;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.version = ANALYSIS_FORMAT_VERSION;
+    hdr.depth = StockfishAPI::clampDepth(settings.depth);
+    hdr.positionCount = gameHdr.moveCount;
+    File f = LittleFS.open(MoveHistory::analysisPath(gameId), "w");
+    if (!f)
+      return false;
+    f.write((const uint8_t*)&hdr, sizeof(hdr));
+    AnalysisEntry pending = {0, 0, 0};
+    for (uint16_t i = 0; i < hdr.positionCount; i++)
+      f.write((const uint8_t*)&pending, sizeof(pending));
+    f.close();
+  }
+  queue.push_back(gameId);
+  Serial.printf("GameAnalyzer: game %d queued for analysis\n", gameId);
+  return true;
+}
+
+bool GameAnalyzer::startGame(int gameId) {
+  AnalysisHeader hdr;
+  if (!readAnalysisHeader(gameId, hdr))
+    return false;
+  File f = LittleFS.open(MoveHistory::gamePath(gameId), "r");
+  GameHeader gameHdr;
+  if (!f || f.read((uint8_t*)&gameHdr, sizeof(gameHdr)) != sizeof(gameHdr) || gameHdr.moveCount != hdr.positionCount) {
+    if (f) f.close();
+    return false;
+  }
+  moves.resize(gameHdr.moveCount);
+  bool ok = f.read((uint8_t*)moves.data(), moves.size() * 2) == moves.size() * 2;
+  f.close();
+  // Positions are only defined from the first FEN marker on
+  if (!ok || moves.empty() || moves[0] != MoveHistory::FEN_MARKER) {
+    moves.clear();
+    return false;
+  }
+
+  currentGame = gameId;
+  fenReadOffset = sizeof(GameHeader) + moves.size() * 2;
+  nextPosition = 0;
+  doneCount = hdr.doneCount;
+  inFlightCount = 0;
+  prevValid = false;
+
+  // Fast-forward the replay to where a previous run stopped
+  bool isMarker;
+  while (nextPosition < doneCount)
+    if (!advance(isMarker)) {
+      stopGame();
+      return false;
+    }
+  if (doneCount > 0) {
+    File a = LittleFS.open(MoveHistory::analysisPath(gameId), "r");
+    AnalysisEntry last;
+    if (a && a.seek(sizeof(AnalysisHeader) + (doneCount - 1) * sizeof(AnalysisEntry)) && a.read((uint8_t*)&last, sizeof(last)) == sizeof(last) && (last.flags & ANALYSIS_EVALUATED)) {
+      prevCp = entryToCp(last, turn);
+      prevValid = true;
+    }
+    if (a) a.close();
+  }
+  Serial.printf("GameAnalyzer: analyzing game %d from position %d/%d at depth %d\n", gameId, doneCount, (int)moves.size(), hdr.depth);
+  return true;
+}
+
+void GameAnalyzer::stopGame() {
+  for (int i = 0; i < inFlightCount; i++) {
+    EngineWorker::cancel(inFlight[i].requestId);
+    inFlight[i].fen = "";
+  }
+  inFlightCount = 0;
+  currentGame = 0;
+  moves.clear();
+  moves.shrink_to_fit();
+}
+
+bool GameAnalyzer::advance(bool& isMarker) {
+  uint16_t entry = moves[nextPosition];
+  isMarker = entry == MoveHistory::FEN_MARKER;
+  if (isMarker) {
+    File f = LittleFS.open(MoveHistory::gamePath(currentGame), "r");
+    if (!f || !f.seek(fenReadOffset)) {
+      if (f) f.close();
+      return false;
+    }
+    int len = f.read();
+    char buf[256];
+    bool ok = len > 0 && f.read((uint8_t*)buf, len) == (size_t)len;
+    f.close();
+    if (!ok)
+      return false;
+    buf[len] = '\0';
+    fenReadOffset += 1 + len;
+    ChessUtils::fenToBoard(String(buf), board, turn, &engine);
+  } else {
+    int fromRow, fromCol, toRow, toCol;
+    char promotion;
+    MoveHistory::decodeMove(entry, fromRow, fromCol, toRow, toCol, promotion);
+    engine.playMove(board, fromRow, fromCol, toRow, toCol, promotion);
+    turn = turn == 'w' ? 'b' : 'w';
+  }
+  nextPosition++;
+  return true;
+}
+
+int GameAnalyzer::entryToCp(const AnalysisEntry& entry, char sideToMove) {
+  if (!(entry.flags & ANALYSIS_MATE))
+    return entry.score;
+  if (entry.score == 0) // Checkmate on the board: the side to move lost
+    return sideToMove == 'w' ? -MATE_CP : MATE_CP;
+  return entry.score > 0 ? MATE_CP - entry.score : -MATE_CP - entry.score;
+}
+
+void GameAnalyzer::record(const AnalysisEntry& result, char sideToMove, bool isMarker) {
+  AnalysisEntry entry = result;
+  if (entry.flags & ANALYSIS_EVALUATED) {
+    int cp = entryToCp(entry, sideToMove);
+    if (!isMarker && prevValid) {
+      // The side that just moved is the one not to move now
+      int before = constrain(prevCp, -BLUNDER_CAP_CP, BLUNDER_CAP_CP);
+      int after = constrain(cp, -BLUNDER_CAP_CP, BLUNDER_CAP_CP);
+      int drop = sideToMove == 'b' ? before - after : after - before;
+      if (drop >= ANALYSIS_BLUNDER_CP)
+        entry.flags |= ANALYSIS_BLUNDER;
+    }
+    prevCp = cp;
+    prevValid = true;
+  } else {
+    prevValid = false;
+  }
+
+  // Entry first, then the resume point, so a reboot in between only redoes this position
+  File f = LittleFS.open(MoveHistory::analysisPath(currentGame), "r+");
+  if (!f)
+    return;
+  f.seek(sizeof(AnalysisHeader) + doneCount * sizeof(AnalysisEntry));
+  f.write((const uint8_t*)&entry, sizeof(entry));
+  doneCount++;
+  f.seek(offsetof(AnalysisHeader, doneCount));
+  f.write((const uint8_t*)&doneCount, sizeof(doneCount));
+  f.close();
+}
+
+void GameAnalyzer::setPaused(bool pause) {
+  if (pause == paused)
+    return;
+  paused = pause;
+  if (!paused || currentGame == 0)
+    return;
+  // Recorded positions are on flash already; requeue the game in front to continue there
+  Serial.printf("GameAnalyzer: pausing analysis of game %d at position %d\n", currentGame, doneCount);
+  int id = currentGame;
+  stopGame();
+  queue.insert(queue.begin(), id);
+}
+
+void GameAnalyzer::update() {
+  int requested = requestedGameId.exchange(0);
+  if (requested > 0)
+    enqueue(requested);
+  if (paused)
+    return;
+
+  if (currentGame == 0) {
+    if (queue.empty())
+      return;
+    int id = queue.front();
+    queue.erase(queue.begin());
+    if (!startGame(id))
+      Serial.printf("GameAnalyzer: cannot analyze game %d\n", id);
+    return;
+  }
+
+  // The game was deleted from the web UI
+  String path = MoveHistory::analysisPath(currentGame);
+  if (!MoveHistory::quietExists(path.c_str())) {
+    stopGame();
+    return;
+  }
+
+  // Submit positions the worker had no room for earlier
+  for (int i = 0; i < inFlightCount; i++)
+    if (!inFlight[i].local && inFlight[i].requestId == 0 && (inFlight[i].requestId = EngineWorker::submit(inFlight[i].fen, settings, true)) == 0)
+      break;
+
+  // Record finished positions in order
+  while (inFlightCount > 0) {
+    InFlight& head = inFlight[0];
+    AnalysisEntry entry = head.entry;
+    if (!head.local) {
+      if (head.requestId == 0)
+        break;
+      StockfishResponse resp;
+      EngineJobStatus status = EngineWorker::poll(head.requestId, resp);
+      if (status == EngineJobStatus::PENDING)
+        break;
+      if (status == EngineJobStatus::DONE) {
+        entry.flags = ANALYSIS_EVALUATED | (resp.hasMate ? ANALYSIS_MATE : 0);
+        entry.score = resp.hasMate ? resp.mateInMoves : constrain(lroundf(resp.evaluation * 100.0f), -32000L, 32000L);
+      } else {
+        entry.flags = ANALYSIS_FAILED;
+      }
+    }
+    record(entry, head.sideToMove, head.isMarker);
+    for (int i = 1; i < inFlightCount; i++)
+      inFlight[i - 1] = inFlight[i];
+    inFlightCount--;
+  }
+
+  // Keep the pipeline full
+  while (inFlightCount < ANALYSIS_MAX_IN_FLIGHT && nextPosition < moves.size()) {
+    InFlight& slot = inFlight[inFlightCount];
+    if (!advance(slot.isMarker)) {
+      Serial.printf("GameAnalyzer: replay of game %d failed\n", currentGame);
+      stopGame();
+      return;
+    }
+    slot.sideToMove = turn;
+    slot.requestId = 0;
+    slot.entry = {0, ANALYSIS_EVALUATED, 0};
+    slot.fen = "";
+    // Game over on the board: no engine needed
+    slot.local = !engine.hasAnyLegalMove(board, turn);
+    if (slot.local) {
+      if (engine.isKingInCheck(board, turn))
+        slot.entry.flags |= ANALYSIS_MATE;
+    } else {
+      slot.fen = ChessUtils::boardToFEN(board, turn, &engine);
+      slot.requestId = EngineWorker::submit(slot.fen, settings, true); // Retried next loop if the worker is full
+    }
+    inFlightCount++;
+  }
+
+  if (inFlightCount == 0 && nextPosition >= moves.size()) {
+    Serial.printf("GameAnalyzer: game %d analyzed\n", currentGame);
+    stopGame();
+  }
+}
+
+String GameAnalyzer::getAnalysisJSON(int gameId) {
+  String path = MoveHistory::analysisPath(gameId);
+  if (!MoveHistory::quietExists(path.c_str()))
+    return "";
+  File f = LittleFS.open(path, "r");
+  AnalysisHeader hdr;
+  if (!f || f.read((uint8_t*)&hdr, sizeof(hdr)) != sizeof(hdr) || hdr.version != ANALYSIS_FORMAT_VERSION) {
+    if (f) f.close();
+    return "";
+  }
+
+  JsonDocument doc;
+  doc["id"] = gameId;
+  doc["depth"] = hdr.depth;
+  doc["total"] = hdr.positionCount;
+  doc["done"] = hdr.doneCount;
+  JsonArray evals = doc["evals"].to<JsonArray>();
+  JsonArray blunders = doc["blunders"].to<JsonArray>();
+  AnalysisEntry entry;
+  for (uint16_t i = 0; i < hdr.positionCount && f.read((uint8_t*)&entry, sizeof(entry)) == sizeof(entry); i++) {
+    if (!(entry.flags & ANALYSIS_EVALUATED))
+      evals.add(nullptr);
+    else if (entry.flags & ANALYSIS_MATE)
+      evals.add(entry.score == 0 ? String("#") : String("M") + String(entry.score));
+    else
+      evals.add(serialized(String(entry.score / 100.0f, 2)));
+    if (entry.flags & ANALYSIS_BLUNDER)
+      blunders.add(i);
+  }
+  f.close();
+
+  String output;
+  serializeJson(doc, output);
+  return output;
+}
@@ -0,0 +1,106 @@
+#ifndef GAME_ANALYZER_H
+#define GAME_ANALYZER_H
+
+#include "chess_engine.h"
+#include "stockfish_settings.h"
+#include <Arduino.h>
+#include <atomic>
+#include <vector>
+
+// Engine requests kept in flight per analysis (the worker runs one at a time)
+#define ANALYSIS_MAX_IN_FLIGHT 2
+// Evaluation drop (centipawns, from the mover's view) that flags a move as a blunder
+#define ANALYSIS_BLUNDER_CP 200
+
+// Sidecar file game_NN.ana: header followed by one entry per position of game_NN.bin.
+// Position i is the board after move entry i (a FEN marker yields the FEN itself),
+// which matches the move indices of the web game viewer.
+struct __attribute__((packed)) AnalysisHeader {
+  uint8_t version;        // Format version (currently 1)
+  uint8_t depth;          // Search depth used
+  uint16_t positionCount; // Number of entries (= moveCount of the game)
+  uint16_t doneCount;     // Entries [0, doneCount) are final; analysis resumes here
+  uint16_t reserved;
+};
+static_assert(sizeof(AnalysisHeader) == 8, "AnalysisHeader must be 8 bytes");
+
+enum AnalysisFlags : uint8_t {
+  ANALYSIS_EVALUATED = 0x01, // score is valid
+  ANALYSIS_MATE = 0x02,      // score is mate-in-N (0 = checkmate on the board)
+  ANALYSIS_BLUNDER = 0x04,   // the move leading here lost at least ANALYSIS_BLUNDER_CP
+  ANALYSIS_FAILED = 0x08     // engine gave no answer; skipped
+};
+
+struct __attribute__((packed)) AnalysisEntry {
+  int16_t score; // Centipawns from White's view, or mate-in-N if ANALYSIS_MATE
+  uint8_t flags; // AnalysisFlags
+  uint8_t reserved;
+};
+static_assert(sizeof(AnalysisEntry) == 4, "AnalysisEntry must be 4 bytes");
+
+// Background evaluation of finished games. Runs from the main loop and feeds
+// positions to the EngineWorker as low-priority requests.
+class GameAnalyzer {
+ public:
+  // Call after MoveHistory::begin(). Queues games whose analysis was interrupted.
+  static void begin();
+
+  // Engine settings for analysis and whether finished games are analyzed automatically
+  static void configure(const StockfishSettings& settings, bool autoAnalyze);
+  static bool isAutoAnalyze() { return autoAnalyze; }
+
+  // Queue a game (main loop only). Returns false if it is already fully analyzed or unreadable.
+  static bool enqueue(int gameId);
+
+  // Ask for a game to be queued from another task (web server)
+  static void request(int gameId) { requestedGameId.store(gameId); }
+
+  // Hold analysis while a mode needs the pooled connections (Lichess streams and moves).
+  // Pausing stops the running game; it resumes from its doneCount when unpaused.
+  static void setPaused(bool paused);
+
+  // Advance the running analysis; call every loop iteration
+  static void update();
+
+  // {"id","depth","total","done","evals":[pawns | "M3" | "#" | null],"blunders":[index…]}
+  // or an empty string if the game has no analysis
+  static String getAnalysisJSON(int gameId);
+
+ private:
+  struct InFlight {
+    uint32_t requestId;  // EngineWorker request, 0 while not (yet) submitted
+    bool local;          // Decided without the engine (no legal moves)
+    char sideToMove;
+    bool isMarker;       // Position comes from a FEN marker (start or board edit)
+    AnalysisEntry entry; // Result for local entries
+    String fen;          // Kept until the worker accepts the request
+  };
+
+  static StockfishSettings settings;
+  static bool autoAnalyze;
+  static bool paused;
+  static std::atomic<int> requestedGameId;
+  static std::vector<int> queue;
+
+  // Replay cursor of the game being analyzed
+  static int currentGame;
+  static std::vector<uint16_t> moves;
+  static uint32_t fenReadOffset; // Next FEN table entry in the game file
+  static uint16_t nextPosition;  // Next position to submit
+  static uint16_t doneCount;     // Next position to record
+  static ChessEngine engine;
+  static char board[8][8];
+  static char turn;
+  static InFlight inFlight[ANALYSIS_MAX_IN_FLIGHT];
+  static int inFlightCount;
+  static int prevCp; // Previous recorded position, centipawns from White's view
+  static bool prevValid;
+
+  static bool startGame(int gameId);
+  static void stopGame();
+  static bool advance(bool& isMarker); // Apply move entry nextPosition to the board
+  static void record(const AnalysisEntry& entry, char sideToMove, bool isMarker);
+  static int entryToCp(const AnalysisEntry& entry, char sideToMove);
+};
+
+#endif // GAME_ANALYZER_H
@@ -0,0 +1,351 @@
+#include "http_pool.h"
+#include "version.h"
+#include <WiFi.h>
+
+HttpPool::Slot HttpPool::slots[HTTP_POOL_MAX_CONNECTIONS] = {};
+SemaphoreHandle_t HttpPool::mutex = nullptr;
+
+void HttpPool::begin() {
+  if (!mutex)
+    mutex = xSemaphoreCreateMutex();
+}
+
+void HttpPool::lock() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+}
+
+void HttpPool::unlock() {
+  xSemaphoreGive(mutex);
+}
+
+HttpPool::Slot* HttpPool::findSlot(WiFiClientSecure* client) {
+  for (int i = 0; i < HTTP_POOL_MAX_CONNECTIONS; i++)
+    if (slots[i].client == client)
+      return &slots[i];
+  return nullptr;
+}
+
+HttpPool::Slot* HttpPool::lookup(WiFiClientSecure* client) {
+  if (!client)
+    return nullptr;
+  lock();
+  Slot* slot = findSlot(client);
+  unlock();
+  return slot;
+}
+
+uint16_t HttpPool::elapsedMs(unsigned long since) {
+  return min(millis() - since, 65535UL);
+}
+
+bool HttpPool::connectSlot(Slot& slot) {
+  unsigned long start = millis();
+  slot.trace.connected = true;
+  // Resolve first to time DNS on its own; connect() then hits the lwIP DNS cache
+  IPAddress ip;
+  if (!WiFi.hostByName(slot.host, ip)) {
+    slot.trace.dnsMs = elapsedMs(start);
+    Serial.printf("HTTP pool: DNS lookup of %s failed\n", slot.host);
+    return false;
+  }
+  slot.trace.dnsMs = elapsedMs(start);
+  unsigned long connectStart = millis();
+  bool ok = slot.client->connect(slot.host, slot.port);
+  slot.trace.connectMs = elapsedMs(connectStart);
+  if (!ok) {
+    Serial.printf("HTTP pool: Connection to %s failed\n", slot.host);
+    return false;
+  }
+  Serial.printf("HTTP pool: Connected to %s in %lu ms\n", slot.host, millis() - start);
+  return true;
+}
+
+WiFiClientSecure* HttpPool::acquire(const char* host, uint16_t port, unsigned long waitMs) {
+  unsigned long start = millis();
+  while (true) {
+    lock();
+    unsigned long now = millis();
+    Slot* sameHost = nullptr;
+    Slot* unconnected = nullptr;
+    Slot* oldest = nullptr;
+    for (int i = 0; i < HTTP_POOL_MAX_CONNECTIONS; i++) {
+      Slot& slot = slots[i];
+      if (slot.inUse)
+        continue;
+      // Drop sockets the server closed or that sat idle too long
+      if (slot.client && (now - slot.lastUsed > HTTP_POOL_IDLE_TIMEOUT_MS || !slot.client->connected()))
+        slot.client->stop();
+      if (!slot.client || !slot.client->connected()) {
+        if (!unconnected)
+          unconnected = &slot;
+      } else if (slot.port == port && strcmp(slot.host, host) == 0) {
+        sameHost = &slot;
+      } else if (!oldest || slot.lastUsed < oldest->lastUsed) {
+        oldest = &slot;
+      }
+    }
+    // Prefer a live socket to this host, then a free slot, then evict the least recently used idle socket
+    Slot* chosen = sameHost ? sameHost : (unconnected ? unconnected : oldest);
+
+    if (chosen) {
+      if (!chosen->client) {
+        chosen->client = new WiFiClientSecure();
+        chosen->client->setInsecure(); // Same as the previous per-request clients; no cert validation
+      }
+      if (chosen->port != port || strcmp(chosen->host, host) != 0) {
+        chosen->client->stop();
+        strlcpy(chosen->host, host, sizeof(chosen->host));
+        chosen->port = port;
+      }
+      chosen->inUse = true;
+      chosen->trace = NetSample();
+      chosen->trace.endpoint = NetTelemetry::classify(host, "");
+      chosen->traceStart = millis();
+    }
+    unlock();
+
+    if (chosen)
+      return chosen->client;
+    if (millis() - start >= waitMs) {
+      Serial.printf("HTTP pool: No free connection for %s\n", host);
+      return nullptr;
+    }
+    delay(10);
+  }
+}
+
+void HttpPool::release(WiFiClientSecure* client, bool reusable) {
+  if (!client)
+    return;
+  lock();
+  Slot* slot = findSlot(client);
+  NetSample trace = {};
+  if (slot) {
+    if (!reusable)
+      client->stop();
+    slot->inUse = false;
+    slot->lastUsed = millis();
+    trace = slot->trace;
+    trace.totalMs = elapsedMs(slot->traceStart);
+  }
+  unlock();
+  // Acquired but never used for a request: nothing to report
+  if (trace.status != 0)
+    NetTelemetry::record(trace);
+}
+
+NetSample* HttpPool::trace(WiFiClientSecure* client) {
+  Slot* slot = lookup(client);
+  return slot ? &slot->trace : nullptr;
+}
+
+void HttpPool::closeIdle() {
+  lock();
+  for (int i = 0; i < HTTP_POOL_MAX_CONNECTIONS; i++)
+    if (!slots[i].inUse && slots[i].client)
+      slots[i].client->stop();
+  unlock();
+}
+
+bool HttpPool::readLine(WiFiClientSecure* client, String& line, unsigned long deadline, const std::atomic<bool>* abort) {
+  line = "";
+  while ((long)(deadline - millis()) > 0) {
+    if (!client->available()) {
+      if (!client->connected() || (abort && abort->load()))
+        return false;
+      delay(1);
+      continue;
+    }
+    char c = client->read();
+    if (c == '\n') {
+      if (line.endsWith("\r"))
+        line.remove(line.length() - 1);
+      return true;
+    }
+    line += c;
+  }
+  return false;
+}
+
+bool HttpPool::writeRequest(WiFiClientSecure* client, const String& method, const String& path, const String& extraHeaders, const String& body) {
+  Slot* slot = lookup(client);
+  if (!slot)
+    return false;
+
+  String request = method + " " + path + " HTTP/1.1\r\n";
+  request += "Host: " + String(slot->host) + "\r\n";
+  request += "User-Agent: OpenChess/" FIRMWARE_VERSION "\r\n";
+  request += "Connection: keep-alive\r\n";
+  request += extraHeaders;
+  if (body.length() > 0 || method == "POST")
+    request += "Content-Length: " + String(body.length()) + "\r\n";
+  request += "\r\n";
+  request += body;
+
+  slot->trace.endpoint = NetTelemetry::classify(slot->host, path);
+  slot->trace.status = -1;
+  if (!client->connected() && !connectSlot(*slot))
+    return false;
+  unsigned long sendStart = millis();
+  bool sent = client->print(request) == request.length();
+  slot->trace.sendMs = elapsedMs(sendStart);
+  slot->sentAt = millis();
+  if (!sent)
+    client->stop();
+  return sent;
+}
+
+bool HttpPool::readHead(WiFiClientSecure* client, HttpResponseHead& head, unsigned long timeoutMs, const std::atomic<bool>* abort) {
+  head.status = -1;
+  Slot* slot = lookup(client);
+  if (!slot)
+    return false;
+
+  unsigned long deadline = millis() + timeoutMs;
+  String line;
+  if (!readLine(client, line, deadline, abort) || !line.startsWith("HTTP/1."))
+    return false;
+  slot->trace.firstByteMs = elapsedMs(slot->sentAt);
+  head.status = line.substring(9, 12).toInt();
+  slot->trace.status = head.status;
+  head.contentLength = (head.status == 204 || head.status == 304) ? 0 : -1;
+  head.chunked = false;
+  head.keepAlive = line.startsWith("HTTP/1.1");
+  bool gotLine;
+  while ((gotLine = readLine(client, line, deadline, abort)) && line.length() > 0) {
+    line.toLowerCase();
+    if (line.startsWith("content-length:"))
+      head.contentLength = line.substring(15).toInt();
+    else if (line.startsWith("transfer-encoding:") && line.indexOf("chunked") >= 0)
+      head.chunked = true;
+    else if (line.startsWith("connection:"))
+      head.keepAlive = line.indexOf("close") < 0;
+  }
+  return gotLine; // Stopped at the blank line ending the head
+}
+
+bool HttpPool::sendRequest(WiFiClientSecure* client, const String& method, const String& path, const String& extraHeaders, const String& body, HttpResponseHead& head, unsigned long timeoutMs, const std::atomic<bool>* abort) {
+  head.status = -1;
+  Slot* slot = lookup(client);
+  if (!slot)
+    return false;
+  for (int attempt = 0; attempt < 2; attempt++) {
+    bool reused = client->connected();
+    if (writeRequest(client, method, path, extraHeaders, body) && readHead(client, head, timeoutMs, abort))
+      return true;
+    if (head.status >= 0)
+      return false; // A response started but its head was cut off
+
+    // A server-side close of an idle socket shows up as a dead connection; a slow server does not
+    bool stale = reused && !client->connected();
+    client->stop();
+    if (!stale)
+      break;
+    Serial.printf("HTTP pool: Idle connection to %s was closed, reconnecting\n", slot->host);
+    slot->trace.retries++;
+  }
+  return false;
+}
+
+bool HttpPool::readBody(WiFiClientSecure* client, const HttpResponseHead& head, String& body, unsigned long timeoutMs, const std::atomic<bool>* abort) {
+  body = "";
+  if (head.contentLength > 0)
+    body.reserve(head.contentLength);
+  HttpBodyStream stream(client, head, timeoutMs, abort);
+  int c;
+  while ((c = stream.read()) >= 0)
+    body += (char)c;
+  return stream.finish();
+}
+
+int HttpPool::request(const char* host, uint16_t port, const String& method, const String& path, const String& extraHeaders, const String& body, String& responseBody, unsigned long timeoutMs, const std::atomic<bool>* abort) {
+  WiFiClientSecure* client = acquire(host, port);
+  if (!client)
+    return -1;
+  HttpResponseHead head;
+  bool ok = sendRequest(client, method, path, extraHeaders, body, head, timeoutMs, abort) && readBody(client, head, responseBody, timeoutMs, abort);
+  release(client, ok && head.keepAlive);
+  return ok ? head.status : -1;
+}
+
+HttpBodyStream::HttpBodyStream(WiFiClientSecure* client, const HttpResponseHead& head, unsigned long timeoutMs, const std::atomic<bool>* abort)
+    : client(client),
+      remaining(head.chunked ? 0 : head.contentLength),
+      chunked(head.chunked),
+      firstChunk(true),
+      done(!head.chunked && head.contentLength == 0),
+      error(false),
+      deadline(millis() + timeoutMs),
+      abort(abort),
+      bytesRead(0) {
+  setTimeout(0); // read() does its own waiting against the deadline
+}
+
+bool HttpBodyStream::fill() {
+  if (done || error)
+    return false;
+  if (chunked && remaining == 0) {
+    String line;
+    // CRLF closing the previous chunk, then the next chunk size
+    if ((!firstChunk && !HttpPool::readLine(client, line, deadline, abort)) || !HttpPool::readLine(client, line, deadline, abort)) {
+      error = true;
+      return false;
+    }
+    firstChunk = false;
+    remaining = strtol(line.c_str(), nullptr, 16);
+    if (remaining <= 0) {
+      done = true;
+      // Blank line after the last chunk (no trailers expected)
+      if (!HttpPool::readLine(client, line, deadline, abort))
+        error = true;
+      return false;
+    }
+  }
+  while (!client->available()) {
+    if (!client->connected()) {
+      // Without framing the body ends when the server closes the connection
+      if (remaining < 0)
+        done = true;
+      else
+        error = true;
+      return false;
+    }
+    if ((long)(deadline - millis()) <= 0 || (abort && abort->load())) {
+      error = true;
+      return false;
+    }
+    delay(1);
+  }
+  return true;
+}
+
+int HttpBodyStream::available() {
+  if (done || error)
+    return 0;
+  int avail = client->available();
+  return remaining >= 0 ? min((long)avail, remaining) : avail;
+}
+
+int HttpBodyStream::read() {
+  if (!fill())
+    return -1;
+  int c = client->read();
+  if (c >= 0)
+    bytesRead++;
+  if (c >= 0 && remaining > 0 && --remaining == 0 && !chunked)
+    done = true;
+  return c;
+}
+
+int HttpBodyStream::peek() {
+  return fill() ? client->peek() : -1;
+}
+
+bool HttpBodyStream::finish() {
+  while (read() >= 0)
+    ;
+  if (NetSample* trace = HttpPool::trace(client))
+    trace->bytes += bytesRead;
+  bytesRead = 0;
+  return done && !error;
+}
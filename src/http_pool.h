@@ -0,0 +1,129 @@
+#ifndef HTTP_POOL_H
+#define HTTP_POOL_H
+
+#include "net_telemetry.h"
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Max simultaneous TLS sockets (each costs ~40 KB of heap while connected)
+#define HTTP_POOL_MAX_CONNECTIONS 3
+// Idle keep-alive sockets are closed after this long (servers drop them anyway)
+#define HTTP_POOL_IDLE_TIMEOUT_MS 30000
+// How long acquire() waits for a free slot when all sockets are busy
+#define HTTP_POOL_ACQUIRE_WAIT_MS 5000
+
+// Parsed status line and framing headers of an HTTP/1.1 response
+struct HttpResponseHead {
+  int status;         // HTTP status code, or -1 if no valid status line arrived
+  long contentLength; // -1 if not sent
+  bool chunked;       // Transfer-Encoding: chunked
+  bool keepAlive;     // false if the server sent Connection: close
+};
+
+// Shared keep-alive HTTPS connections keyed by host:port.
+// Typical use is request(). Streaming callers use acquire/sendRequest, read the
+// body from the returned client themselves and then release() it.
+// Every acquire/release pair that sent a request is recorded in NetTelemetry.
+class HttpPool {
+ public:
+  // Create the lock; called from setup() before any task makes a request
+  static void begin();
+
+  // Borrow a connection to host:port. An idle socket to the same host is reused,
+  // otherwise a slot is (re)connected. Returns nullptr if no slot frees up within waitMs.
+  static WiFiClientSecure* acquire(const char* host, uint16_t port = 443, unsigned long waitMs = HTTP_POOL_ACQUIRE_WAIT_MS);
+
+  // Return a connection. Pass reusable = false if the response body was not fully
+  // read or the socket must not carry another request; it is closed then.
+  static void release(WiFiClientSecure* client, bool reusable);
+
+  // Send a request on an acquired connection and read the response head.
+  // A reused socket that the server closed while idle is reconnected and the
+  // request resent once. extraHeaders must be CRLF-terminated lines.
+  // Waits give up early once *abort becomes true (the socket is then not reusable).
+  static bool sendRequest(WiFiClientSecure* client, const String& method, const String& path, const String& extraHeaders, const String& body, HttpResponseHead& head, unsigned long timeoutMs, const std::atomic<bool>* abort = nullptr);
+
+  // The two halves of sendRequest without the stale-socket retry, for callers that
+  // wait on several connections at once: connect if needed and write the request,
+  // then (once data is available) read the response head.
+  static bool writeRequest(WiFiClientSecure* client, const String& method, const String& path, const String& extraHeaders, const String& body);
+  static bool readHead(WiFiClientSecure* client, HttpResponseHead& head, unsigned long timeoutMs, const std::atomic<bool>* abort = nullptr);
+
+  // Read the full body (dechunked) into a String. Returns false on timeout, abort
+  // or broken framing. Prefer HttpBodyStream when the body can be parsed on the fly.
+  static bool readBody(WiFiClientSecure* client, const HttpResponseHead& head, String& body, unsigned long timeoutMs, const std::atomic<bool>* abort = nullptr);
+
+  // Read one CRLF/LF-terminated line (terminator stripped) before the deadline
+  static bool readLine(WiFiClientSecure* client, String& line, unsigned long deadline, const std::atomic<bool>* abort = nullptr);
+
+  // acquire + sendRequest + readBody + release. Returns the HTTP status, or -1 on failure.
+  static int request(const char* host, uint16_t port, const String& method, const String& path, const String& extraHeaders, const String& body, String& responseBody, unsigned long timeoutMs, const std::atomic<bool>* abort = nullptr);
+
+  // Close every idle socket (e.g. after WiFi reconnects)
+  static void closeIdle();
+
+  // Telemetry record of the request on an acquired connection, for callers that
+  // retry or drive the connection themselves (HTTPClient). nullptr if not pooled.
+  static NetSample* trace(WiFiClientSecure* client);
+
+ private:
+  struct Slot {
+    WiFiClientSecure* client;
+    char host[48];
+    uint16_t port;
+    bool inUse;
+    unsigned long lastUsed;
+    NetSample trace;          // Request in progress on this slot
+    unsigned long traceStart; // When the slot was acquired
+    unsigned long sentAt;     // When the last request was written
+  };
+  static Slot slots[HTTP_POOL_MAX_CONNECTIONS];
+  static SemaphoreHandle_t mutex;
+
+  static void lock();
+  static void unlock();
+  static Slot* findSlot(WiFiClientSecure* client); // Caller holds the lock
+  static Slot* lookup(WiFiClientSecure* client);   // Takes the lock; the slot itself belongs to the borrower
+  static bool connectSlot(Slot& slot);
+  static uint16_t elapsedMs(unsigned long since);
+};
+
+// Response body of an acquired connection as a Stream: dechunks, stops at the end
+// of the body and gives up at the deadline or when *abort is set, so a parser can
+// read straight from the socket without buffering the reply.
+class HttpBodyStream : public Stream {
+ public:
+  HttpBodyStream(WiFiClientSecure* client, const HttpResponseHead& head, unsigned long timeoutMs, const std::atomic<bool>* abort = nullptr);
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t) override { return 0; }
+  void flush() override {}
+
+  // Skip the unread rest of the body. Returns true if the body ended cleanly,
+  // i.e. the connection may be released as reusable.
+  bool finish();
+
+  // True once reading stopped on a timeout, abort or broken framing
+  bool failed() const { return error; }
+
+ private:
+  WiFiClientSecure* client;
+  long remaining; // Bytes left in the body or current chunk, -1 = until close
+  bool chunked;
+  bool firstChunk;
+  bool done;
+  bool error;
+  unsigned long deadline;
+  const std::atomic<bool>* abort;
+  uint32_t bytesRead; // Reported to the connection's telemetry by finish()
+
+  // Wait until a body byte can be read; false at the end of the body or on failure
+  bool fill();
+};
+
+#endif // HTTP_POOL_H
@@ -17,6 +17,9 @@ static constexpr LedRGB Purple{128, 0, 255};  // en passant, expert mode
 static constexpr LedRGB Green{0, 255, 0};     // confirm/move completion
 static constexpr LedRGB Yellow{255, 200, 0};  // king in check/promotion
 static constexpr LedRGB Blue{0, 0, 255};      // bot thinking
+static constexpr LedRGB Orange{255, 80, 0};   // move repeats an earlier position
+static constexpr LedRGB Magenta{255, 0, 160}; // premove waiting for the opponent's move
+static constexpr LedRGB Lime{160, 255, 0};    // Lichess link back, resyncing the game
 static constexpr LedRGB Off{0, 0, 0};         // turn off LED
 } // namespace LedColors
 
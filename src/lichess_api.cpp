@@ -1,7 +1,6 @@
 #include "lichess_api.h"
+#include "http_pool.h"
 #include <ArduinoJson.h>
-#include <WiFi.h>
-#include <WiFiClientSecure.h>
 
 // Static member initialization
 String LichessAPI::apiToken = "";
@@ -18,62 +17,71 @@ bool LichessAPI::hasToken() {
   return apiToken.length() > 0;
 }
 
-String LichessAPI::makeHttpRequest(const String& method, const String& path, const String& body) {
-  WiFiClientSecure client;
-  client.setInsecure(); // For simplicity; in production, use proper cert validation
-
-  if (!client.connect(LICHESS_API_HOST, LICHESS_API_PORT)) {
-    Serial.println("Lichess API: Connection failed");
+String LichessAPI::makeHttpRequest(const String& method, const String& path, const String& body, LichessRequestKind kind) {
+  // Moves are posted from a background task and may sit out a cool-down, anything else fails fast
+  unsigned long maxWaitMs = kind == LichessRequestKind::MOVE ? LICHESS_RATE_LIMIT_COOLDOWN_MS + LICHESS_MOVE_REFILL_MS : 0;
+  if (!LichessScheduler::acquire(kind, maxWaitMs))
     return "";
-  }
 
-  // Build HTTP request
-  String request = method + " " + path + " HTTP/1.1\r\n";
-  request += "Host: " LICHESS_API_HOST "\r\n";
-  request += "Authorization: Bearer " + apiToken + "\r\n";
-  request += "Accept: application/json\r\n";
+  String headers = "Authorization: Bearer " + apiToken + "\r\n";
+  headers += "Accept: application/json\r\n";
+  if (body.length() > 0)
+    headers += "Content-Type: application/x-www-form-urlencoded\r\n";
 
-  if (body.length() > 0) {
-    request += "Content-Type: application/x-www-form-urlencoded\r\n";
-    request += "Content-Length: " + String(body.length()) + "\r\n";
+  String response;
+  int status = HttpPool::request(LICHESS_API_HOST, LICHESS_API_PORT, method, path, headers, body, response, 10000);
+  LichessScheduler::report(kind, status);
+  if (status < 0) {
+    Serial.println("Lichess API: Request failed or timed out");
+    return "";
   }
+  return response;
+}
 
-  request += "Connection: close\r\n\r\n";
-
-  if (body.length() > 0) {
-    request += body;
+WiFiClientSecure* LichessAPI::openStream(const String& path, HttpResponseHead& head) {
+  head.status = -1;
+  if (!LichessScheduler::acquire(LichessRequestKind::STREAM))
+    return nullptr;
+  WiFiClientSecure* client = HttpPool::acquire(LICHESS_API_HOST, LICHESS_API_PORT);
+  if (!client) {
+    LichessScheduler::report(LichessRequestKind::STREAM, -1);
+    return nullptr;
   }
 
-  client.print(request);
+  // Public streams (TV, spectated games) also work without a token
+  String headers = apiToken.length() > 0 ? "Authorization: Bearer " + apiToken + "\r\n" : "";
+  headers += "Accept: application/x-ndjson\r\n";
 
-  // Wait for response
-  unsigned long timeout = millis() + 10000;
-  while (client.connected() && !client.available()) {
-    if (millis() > timeout) {
-      Serial.println("Lichess API: Request timeout");
-      client.stop();
-      return "";
-    }
-    delay(10);
+  bool sent = HttpPool::sendRequest(client, "GET", path, headers, "", head, 15000);
+  LichessScheduler::report(LichessRequestKind::STREAM, sent ? head.status : -1);
+  if (!sent || head.status != 200) {
+    HttpPool::release(client, false);
+    return nullptr;
   }
+  return client;
+}
+
+bool LichessAPI::readStreamEvent(const String& path, String& jsonLine) {
+  HttpResponseHead head;
+  WiFiClientSecure* client = openStream(path, head);
+  if (!client)
+    return false;
 
-  // Read response
-  String response = "";
-  bool headersDone = false;
-
-  while (client.available()) {
-    String line = client.readStringUntil('\n');
-    if (!headersDone) {
-      if (line == "\r" || line.length() == 0) {
-        headersDone = true;
-      }
-    } else {
-      response += line + "\n";
+  bool foundData = false;
+  unsigned long deadline = millis() + 15000;
+  String line;
+  while (!foundData && HttpPool::readLine(client, line, deadline)) {
+    line.trim();
+    // Skip keep-alive blank lines and chunk size lines: every NDJSON event starts with '{'
+    if (line.length() > 0 && line[0] == '{') {
+      jsonLine = line;
+      foundData = true;
     }
   }
 
-  client.stop();
-  return response;
+  // Game streams never end, so this socket cannot carry another request
+  HttpPool::release(client, false);
+  return foundData;
 }
 
 bool LichessAPI::verifyToken(String& username) {
@@ -98,202 +106,161 @@ bool LichessAPI::verifyToken(String& username) {
   return false;
 }
 
-bool LichessAPI::pollForGameEvent(LichessEvent& event) {
-  // Check for currently playing games first
-  WiFiClientSecure client;
-  client.setInsecure();
-
-  if (!client.connect(LICHESS_API_HOST, LICHESS_API_PORT)) {
-    return false;
-  }
-
-  // Use the /api/account/playing endpoint to get current games
-  String request = "GET /api/account/playing HTTP/1.1\r\n";
-  request += "Host: " LICHESS_API_HOST "\r\n";
-  request += "Authorization: Bearer " + apiToken + "\r\n";
-  request += "Accept: application/json\r\n";
-  request += "Connection: close\r\n\r\n";
-
-  client.print(request);
-
-  unsigned long timeout = millis() + 10000;
-  while (client.connected() && !client.available()) {
-    if (millis() > timeout) {
-      client.stop();
-      return false;
-    }
-    delay(10);
-  }
-
-  String response = "";
-  bool headersDone = false;
-
-  while (client.available()) {
-    String line = client.readStringUntil('\n');
-    if (!headersDone) {
-      if (line == "\r" || line.length() == 0) {
-        headersDone = true;
-      }
-    } else {
-      response += line;
-    }
-  }
-
-  client.stop();
-
-  if (response.length() == 0) {
-    return false;
-  }
+bool LichessAPI::parseEventStreamLine(const String& json, LichessEvent& event) {
+  // Keep only the fields we use; game and challenge objects carry much more
+  JsonDocument filter;
+  filter["type"] = true;
+  filter["game"]["gameId"] = true;
+  filter["game"]["fen"] = true;
+  filter["game"]["color"] = true;
+  filter["game"]["lastMove"] = true;
+  filter["game"]["isMyTurn"] = true;
+  filter["challenge"]["id"] = true;
+  filter["challenge"]["challenger"]["name"] = true;
 
   JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, response);
-  if (error) {
+  if (deserializeJson(doc, json, DeserializationOption::Filter(filter)))
     return false;
-  }
 
-  JsonArray games = doc["nowPlaying"].as<JsonArray>();
-  if (games.size() > 0) {
-    // Get the first active game
-    JsonObject game = games[0];
+  String type = doc["type"].as<String>();
+  if (type == "gameStart")
     event.type = LichessEventType::GAME_START;
+  else if (type == "gameFinish")
+    event.type = LichessEventType::GAME_FINISH;
+  else if (type == "challenge")
+    event.type = LichessEventType::CHALLENGE;
+  else if (type == "challengeCanceled")
+    event.type = LichessEventType::CHALLENGE_CANCELED;
+  else if (type == "challengeDeclined")
+    event.type = LichessEventType::CHALLENGE_DECLINED;
+  else
+    event.type = LichessEventType::UNKNOWN;
+
+  if (event.type == LichessEventType::GAME_START || event.type == LichessEventType::GAME_FINISH) {
+    JsonObject game = doc["game"];
     event.gameId = game["gameId"].as<String>();
-    event.fen = game["fen"].as<String>();
-
-    String color = game["color"].as<String>();
-    event.myColor = (color == "white") ? 'w' : 'b';
-
-    Serial.println("Lichess: Found active game: " + event.gameId);
-    return true;
+    event.fen = game["fen"] | "";
+    event.myColor = game["color"].as<String>() == "black" ? 'b' : 'w';
+    event.lastMove = game["lastMove"] | "";
+    event.isMyTurn = game["isMyTurn"] | false;
+    event.challenger = "";
+  } else if (event.type != LichessEventType::UNKNOWN) {
+    event.gameId = doc["challenge"]["id"].as<String>();
+    event.challenger = doc["challenge"]["challenger"]["name"] | "";
+    event.fen = "";
+    event.lastMove = "";
+    event.isMyTurn = false;
   }
-
-  return false;
+  return event.type != LichessEventType::UNKNOWN;
 }
 
-bool LichessAPI::getGameState(const String& gameId, LichessGameState& state) {
-  String response = makeHttpRequest("GET", "/api/board/game/stream/" + gameId);
-  if (response.length() == 0) {
-    return false;
-  }
-
-  // The stream returns multiple JSON objects, we need the first "gameFull" event
-  int newlinePos = response.indexOf('\n');
-  String firstLine = (newlinePos > 0) ? response.substring(0, newlinePos) : response;
+bool LichessAPI::parseSpectateStreamLine(const String& json, LichessSpectateEvent& event) {
+  JsonDocument filter;
+  filter["d"]["id"] = true;
+  filter["d"]["fen"] = true;
+  filter["d"]["lm"] = true;
+  filter["id"] = true;
+  filter["fen"] = true;
+  filter["lm"] = true;
+  filter["lastMove"] = true;
+  filter["status"]["name"] = true;
 
-  return parseGameFullEvent(firstLine, state);
-}
-
-bool LichessAPI::pollGameStream(const String& gameId, LichessGameState& state) {
-  WiFiClientSecure client;
-  client.setInsecure();
+  JsonDocument doc;
+  if (deserializeJson(doc, json, DeserializationOption::Filter(filter)))
+    return false;
 
-  if (!client.connect(LICHESS_API_HOST, LICHESS_API_PORT)) {
+  // The TV feed wraps every message as {"t":type,"d":data}, game streams send the data itself
+  JsonObject data = doc["d"].is<JsonObject>() ? doc["d"].as<JsonObject>() : doc.as<JsonObject>();
+  event.fen = data["fen"] | "";
+  if (event.fen.length() == 0)
     return false;
-  }
+  event.gameId = data["id"] | "";
+  event.lastMove = data["lm"] | (data["lastMove"] | "");
+  String status = data["status"]["name"] | "";
+  event.finished = status.length() > 0 && status != "created" && status != "started";
+  return true;
+}
 
-  String request = "GET /api/board/game/stream/" + gameId + " HTTP/1.1\r\n";
-  request += "Host: " LICHESS_API_HOST "\r\n";
-  request += "Authorization: Bearer " + apiToken + "\r\n";
-  request += "Accept: application/x-ndjson\r\n";
-  request += "Connection: close\r\n\r\n";
+int LichessAPI::getPlayingGames(LichessEvent* games, int maxGames) {
+  String response = makeHttpRequest("GET", "/api/account/playing?nb=" + String(maxGames));
+  if (response.length() == 0)
+    return -1;
 
-  client.print(request);
+  JsonDocument filter;
+  filter["nowPlaying"][0]["gameId"] = true;
+  filter["nowPlaying"][0]["fen"] = true;
+  filter["nowPlaying"][0]["color"] = true;
+  filter["nowPlaying"][0]["lastMove"] = true;
+  filter["nowPlaying"][0]["isMyTurn"] = true;
 
-  unsigned long timeout = millis() + 15000;
-  bool headersDone = false;
-  String jsonLine = "";
-  bool foundData = false;
-  bool isChunked = false;
+  JsonDocument doc;
+  if (deserializeJson(doc, response, DeserializationOption::Filter(filter))) {
+    Serial.println("Lichess API: JSON parse error in getPlayingGames");
+    return -1;
+  }
 
-  while (client.connected() || client.available()) {
-    if (millis() > timeout) {
+  int count = 0;
+  for (JsonObject game : doc["nowPlaying"].as<JsonArray>()) {
+    if (count >= maxGames)
       break;
-    }
-
-    if (client.available()) {
-      String line = client.readStringUntil('\n');
-
-      // Check for chunked transfer encoding in headers
-      if (!headersDone) {
-        String lowerLine = line;
-        lowerLine.toLowerCase();
-        if (lowerLine.indexOf("transfer-encoding: chunked") >= 0) {
-          isChunked = true;
-        }
-      }
-
-      line.trim();
-
-      if (!headersDone) {
-        if (line.length() == 0) {
-          headersDone = true;
-        }
-        continue;
-      }
-
-      // Skip empty lines (keep-alive)
-      if (line.length() == 0) {
-        continue;
-      }
-
-      // If chunked encoding, skip chunk size lines (hex numbers)
-      if (isChunked) {
-        // Check if this is a chunk size (hex number)
-        bool isChunkSize = true;
-        for (size_t i = 0; i < line.length(); i++) {
-          char c = line[i];
-          if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
-            isChunkSize = false;
-            break;
-          }
-        }
-        if (isChunkSize && line.length() <= 8) {
-          continue; // Skip chunk size line
-        }
-      }
-
-      // Must start with '{' to be valid JSON
-      if (line[0] != '{') {
-        continue;
-      }
-
-      jsonLine = line;
-      foundData = true;
-      break; // Got one event, process it
-    }
-
-    delay(10);
+    LichessEvent& event = games[count++];
+    event.type = LichessEventType::GAME_START;
+    event.gameId = game["gameId"].as<String>();
+    event.fen = game["fen"] | "";
+    event.myColor = game["color"].as<String>() == "black" ? 'b' : 'w';
+    event.lastMove = game["lastMove"] | "";
+    event.isMyTurn = game["isMyTurn"] | false;
+    event.challenger = "";
   }
+  return count;
+}
 
-  client.stop();
-
-  if (!foundData || jsonLine.length() == 0) {
-    Serial.println("Lichess: No JSON data received from game stream");
+bool LichessAPI::getGameState(const String& gameId, LichessGameState& state) {
+  // The stream returns multiple JSON objects, we need the first "gameFull" event
+  String firstLine;
+  if (!readStreamEvent("/api/board/game/stream/" + gameId, firstLine)) {
     return false;
   }
 
-  Serial.println("Lichess: Game stream JSON: " + jsonLine.substring(0, min((size_t)200, jsonLine.length())));
+  state.lastMove = "";
+  state.moveCount = 0;
+  state.movesLength = 0;
+  return parseGameStreamLine(firstLine, state);
+}
 
-  // Try to parse as gameFull first, then as gameState
-  if (parseGameFullEvent(jsonLine, state)) {
-    return true;
+// Parse the part of a space-separated UCI moves list beyond the moves state already
+// knows. Only the new suffix is scanned, after checking that the known moves still
+// end where they did with the same last move; otherwise the whole list is taken.
+static void parseMovesSuffix(const char* moves, LichessGameState& state) {
+  size_t length = strlen(moves);
+  size_t from = state.movesLength;
+  size_t lastLength = state.lastMove.length();
+  bool extends = from == 0 || (length >= from && from >= lastLength && (moves[from] == '\0' || moves[from] == ' ') && strncmp(moves + from - lastLength, state.lastMove.c_str(), lastLength) == 0);
+  state.diverged = !extends;
+  if (!extends) {
+    from = 0;
+    state.moveCount = 0;
+    state.lastMove = "";
   }
 
-  Serial.println("Lichess: parseGameFullEvent failed, trying parseGameStateEvent");
-  return parseGameStateEvent(jsonLine, state);
-}
-
-// Parse a space-separated UCI moves string into a move count and the last move.
-static void parseMovesList(const String& moves, int& moveCount, String& lastMove) {
-  moveCount = 0;
-  if (moves.length() > 0) {
-    moveCount = 1;
-    for (size_t i = 0; i < moves.length(); i++)
-      if (moves[i] == ' ') moveCount++;
-    int lastSpace = moves.lastIndexOf(' ');
-    lastMove = (lastSpace >= 0) ? moves.substring(lastSpace + 1) : moves;
-  } else {
-    lastMove = "";
+  while (moves[from] == ' ')
+    from++;
+  state.newMoves = String(moves + from);
+  size_t lastStart = 0, lastEnd = 0;
+  for (size_t i = from; i < length; i++) {
+    if (moves[i] == ' ')
+      continue;
+    size_t end = i;
+    while (end < length && moves[end] != ' ')
+      end++;
+    state.moveCount++;
+    lastStart = i;
+    lastEnd = end;
+    i = end;
   }
+  if (lastEnd > lastStart)
+    state.lastMove = String(moves + lastStart).substring(0, lastEnd - lastStart);
+  state.movesLength = length;
 }
 
 // Check whether the game has ended and populate state accordingly.
@@ -307,96 +274,70 @@ static void checkGameEndStatus(JsonObject obj, LichessGameState& state) {
   }
 }
 
-// ---------------------------------------------------------------
-
-bool LichessAPI::parseGameFullEvent(const String& json, LichessGameState& state) {
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, json);
-  if (error) {
-    Serial.println("Lichess: JSON parse error in parseGameFullEvent");
-    return false;
-  }
-
-  // Check if this is a "gameFull" event
-  if (!doc.containsKey("type") || doc["type"].as<String>() != "gameFull") {
-    // Try to parse anyway if it has the right structure
-    if (!doc.containsKey("id") && !doc.containsKey("state")) {
-      return false;
-    }
-  }
-
-  state.gameId = doc["id"].as<String>();
-  state.gameStarted = true;
-  state.gameEnded = false;
-
-  // Get player color
-  String whiteId = doc["white"]["id"].as<String>();
-  String myId = "";
-
-  // We need to know our username to determine color
-  // For now, use the "white"/"black" approach from the initial event
-  if (doc.containsKey("white") && doc.containsKey("black")) {
-    // Check which one has aiLevel (if any) - that's the bot
-    if (doc["white"].containsKey("aiLevel")) {
-      state.myColor = 'b'; // We're Black, White is AI
-    } else if (doc["black"].containsKey("aiLevel")) {
-      state.myColor = 'w'; // We're White, Black is AI
-    }
-  }
-
-  // Get game state
-  if (doc.containsKey("state")) {
-    JsonObject stateObj = doc["state"];
-    String moves = stateObj["moves"].as<String>();
-
-    int moveCount = 0;
-    parseMovesList(moves, moveCount, state.lastMove);
-    state.isMyTurn = ((moveCount % 2 == 0) && state.myColor == 'w') || ((moveCount % 2 == 1) && state.myColor == 'b');
+// Apply the fields shared by gameState events and the state object of gameFull
+static void applyGameState(JsonObject gameState, LichessGameState& state) {
+  parseMovesSuffix(gameState["moves"] | "", state);
+  state.whiteTimeMs = gameState["wtime"] | -1L;
+  state.blackTimeMs = gameState["btime"] | -1L;
+  state.isMyTurn = ((state.moveCount % 2 == 0) && state.myColor == 'w') || ((state.moveCount % 2 == 1) && state.myColor == 'b');
+  checkGameEndStatus(gameState, state);
+}
 
-    // Get FEN if available
-    if (stateObj.containsKey("fen")) {
-      state.fen = stateObj["fen"].as<String>();
-    }
+// ---------------------------------------------------------------
 
-    checkGameEndStatus(stateObj, state);
-  }
+bool LichessAPI::parseGameStreamLine(const String& jsonLine, LichessGameState& state) {
+  Serial.println("Lichess: Game stream JSON: " + jsonLine.substring(0, min((size_t)200, jsonLine.length())));
 
-  // Get initial FEN if provided
-  if (doc.containsKey("initialFen") && doc["initialFen"].as<String>() != "startpos") {
-    state.fen = doc["initialFen"].as<String>();
-  }
+  // Keep only the fields we use; gameFull also carries player profiles and clock settings
+  JsonDocument filter;
+  filter["type"] = true;
+  filter["id"] = true;
+  filter["initialFen"] = true;
+  filter["white"]["aiLevel"] = true;
+  filter["black"]["aiLevel"] = true;
+  filter["state"]["moves"] = true;
+  filter["state"]["status"] = true;
+  filter["state"]["winner"] = true;
+  filter["state"]["wtime"] = true;
+  filter["state"]["btime"] = true;
+  filter["moves"] = true;
+  filter["status"] = true;
+  filter["winner"] = true;
+  filter["wtime"] = true;
+  filter["btime"] = true;
 
-  return true;
-}
-
-bool LichessAPI::parseGameStateEvent(const String& json, LichessGameState& state) {
   JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, json);
-  if (error) {
+  if (deserializeJson(doc, jsonLine, DeserializationOption::Filter(filter))) {
+    Serial.println("Lichess: JSON parse error in game stream");
     return false;
   }
 
-  // Check if this is a "gameState" event
   String type = doc["type"].as<String>();
-  if (type != "gameState") {
-    // Could be chatLine or other events
-    return false;
+  if (type == "gameFull") {
+    state.gameId = doc["id"].as<String>();
+    state.gameStarted = true;
+    state.gameEnded = false;
+    // The side with an AI level is the Lichess bot, so we play the other one
+    if (doc["white"].containsKey("aiLevel"))
+      state.myColor = 'b';
+    else if (doc["black"].containsKey("aiLevel"))
+      state.myColor = 'w';
+    String initialFen = doc["initialFen"] | "startpos";
+    state.fen = initialFen == "startpos" ? "" : initialFen;
+    applyGameState(doc["state"], state);
+    return true;
   }
-
-  String moves = doc["moves"].as<String>();
-
-  int moveCount = 0;
-  parseMovesList(moves, moveCount, state.lastMove);
-  state.isMyTurn = ((moveCount % 2 == 0) && state.myColor == 'w') || ((moveCount % 2 == 1) && state.myColor == 'b');
-
-  checkGameEndStatus(doc.as<JsonObject>(), state);
-
-  return true;
+  if (type == "gameState") {
+    applyGameState(doc.as<JsonObject>(), state);
+    return true;
+  }
+  // chatLine, opponentGone, ...
+  return false;
 }
 
 bool LichessAPI::makeMove(const String& gameId, const String& move) {
   String path = "/api/board/game/" + gameId + "/move/" + move;
-  String response = makeHttpRequest("POST", path);
+  String response = makeHttpRequest("POST", path, "", LichessRequestKind::MOVE);
 
   // Check for success
   JsonDocument doc;
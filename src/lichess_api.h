@@ -1,17 +1,29 @@
 #ifndef LICHESS_API_H
 #define LICHESS_API_H
 
+#include "lichess_scheduler.h"
 #include <Arduino.h>
 
 // Lichess API Configuration
 #define LICHESS_API_HOST "lichess.org"
 #define LICHESS_API_PORT 443
 
+class WiFiClientSecure;
+struct HttpResponseHead;
+
 // Lichess game state
 struct LichessGameState {
   String gameId;
-  String fen;
+  String fen;      // Initial position of the game (gameFull only), empty for the standard start
   String lastMove; // UCI format (e.g., "e2e4")
+  int moveCount;   // Plies played so far
+  // The moves list is parsed incrementally: on entry lastMove, moveCount and movesLength
+  // describe the moves already known (all zero/empty for none), and only the rest is parsed
+  size_t movesLength; // Length of the known moves string
+  String newMoves;    // Space-separated UCI moves after the known ones
+  bool diverged;      // The moves no longer extend the known ones (takeback); newMoves holds them all
+  long whiteTimeMs;   // Remaining clock times when the event was sent, -1 for games without a clock
+  long blackTimeMs;
   bool isMyTurn;
   char myColor; // 'w' or 'b'
   bool gameStarted;
@@ -33,9 +45,20 @@ enum class LichessEventType {
 // Lichess event structure
 struct LichessEvent {
   LichessEventType type;
-  String gameId;
+  String gameId; // Game id, or the challenge id for challenge events
   String fen;
-  char myColor; // 'w' or 'b'
+  String lastMove;   // UCI, empty before the first move
+  bool isMyTurn;
+  char myColor;      // 'w' or 'b'
+  String challenger; // Name of the challenger for challenge events
+};
+
+// One position of a spectated game, from /api/tv/feed or /api/stream/game/{id}
+struct LichessSpectateEvent {
+  String gameId;   // Set on lines that describe the game (TV "featured", game stream head and end)
+  String fen;      // Position after lastMove, at least the piece placement
+  String lastMove; // UCI, empty when the line carries no move
+  bool finished;   // The game has a final status
 };
 
 class LichessAPI {
@@ -48,16 +71,30 @@ class LichessAPI {
   // Account verification
   static bool verifyToken(String& username);
 
-  // Stream events to find new games
-  // Returns true if a new game event was found
-  static bool pollForGameEvent(LichessEvent& event);
+  // Parse one line of the /api/stream/event stream (gameStart, gameFinish, challenge…).
+  // Returns false for unknown event types and invalid JSON.
+  static bool parseEventStreamLine(const String& json, LichessEvent& event);
+
+  // Ongoing games of the account (/api/account/playing) as gameStart events.
+  // Returns how many were stored in games, or -1 if the request failed.
+  static int getPlayingGames(LichessEvent* games, int maxGames);
 
   // Get current game state
   static bool getGameState(const String& gameId, LichessGameState& state);
 
-  // Stream game state (for ongoing game updates)
-  // Returns true if there's new state data
-  static bool pollGameStream(const String& gameId, LichessGameState& state);
+  // Open an authenticated NDJSON stream on a pooled connection. Returns the connection
+  // (release it as not reusable when done) or nullptr unless the server answered 200.
+  // Returns nullptr at once while LichessScheduler holds streams back.
+  static WiFiClientSecure* openStream(const String& path, HttpResponseHead& head);
+
+  // Apply one line of /api/board/game/stream/{id} (gameFull or gameState) to state,
+  // parsing only the moves beyond the known ones (see LichessGameState).
+  // Returns false for other event types (chatLine, opponentGone) and invalid JSON.
+  static bool parseGameStreamLine(const String& json, LichessGameState& state);
+
+  // Parse one line of the TV feed or of a public game stream. Returns false for lines
+  // without a position and invalid JSON.
+  static bool parseSpectateStreamLine(const String& json, LichessSpectateEvent& event);
 
   // Make a move in the current game
   // move: UCI format (e.g., "e2e4", "e7e8q" for promotion)
@@ -68,9 +105,11 @@ class LichessAPI {
 
  private:
   static String apiToken;
-  static String makeHttpRequest(const String& method, const String& path, const String& body = "");
-  static bool parseGameFullEvent(const String& json, LichessGameState& state);
-  static bool parseGameStateEvent(const String& json, LichessGameState& state);
+  // Returns the response body, or "" if the request failed or the scheduler held it back
+  // for longer than the kind may wait (moves wait out a rate-limit cool-down, others do not)
+  static String makeHttpRequest(const String& method, const String& path, const String& body = "", LichessRequestKind kind = LichessRequestKind::API);
+  // Open an NDJSON stream and return its first event line (the connection is closed afterwards)
+  static bool readStreamEvent(const String& path, String& jsonLine);
 };
 
 #endif // LICHESS_API_H
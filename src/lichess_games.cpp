@@ -0,0 +1,208 @@
+#include "lichess_games.h"
+#include <ArduinoJson.h>
+
+LichessGameSummary LichessGames::games[LICHESS_GAMES_MAX];
+int LichessGames::gameCount = 0;
+char LichessGames::current[LICHESS_GAME_ID_LEN + 1] = "";
+char LichessGames::switchTo[LICHESS_GAME_ID_LEN + 1] = "";
+SemaphoreHandle_t LichessGames::mutex = nullptr;
+TaskHandle_t LichessGames::refreshTask = nullptr;
+volatile bool LichessGames::refreshing = false;
+
+static void copyField(char* dst, size_t size, const String& src) {
+  strncpy(dst, src.c_str(), size - 1);
+  dst[size - 1] = '\0';
+}
+
+void LichessGames::begin() {
+  if (!mutex)
+    mutex = xSemaphoreCreateMutex();
+}
+
+void LichessGames::clear() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  gameCount = 0;
+  current[0] = '\0';
+  switchTo[0] = '\0';
+  xSemaphoreGive(mutex);
+}
+
+int LichessGames::find(const char* gameId) {
+  for (int i = 0; i < gameCount; i++)
+    if (strcmp(games[i].gameId, gameId) == 0)
+      return i;
+  return -1;
+}
+
+LichessGameSummary* LichessGames::slotFor(const char* gameId) {
+  int i = find(gameId);
+  if (i >= 0)
+    return &games[i];
+  if (gameCount >= LICHESS_GAMES_MAX)
+    return nullptr;
+  LichessGameSummary* slot = &games[gameCount++];
+  memset(slot, 0, sizeof(*slot));
+  copyField(slot->gameId, sizeof(slot->gameId), gameId);
+  return slot;
+}
+
+void LichessGames::update(const LichessEvent& event) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  apply(event);
+  xSemaphoreGive(mutex);
+}
+
+void LichessGames::apply(const LichessEvent& event) {
+  if (event.gameId.length() == 0 || event.gameId.length() > LICHESS_GAME_ID_LEN)
+    return;
+  LichessGameSummary* slot = slotFor(event.gameId.c_str());
+  if (slot) {
+    // A FEN from the event invalidates a cursor from an earlier visit unless nothing moved
+    if (slot->hasCursor && strcmp(slot->lastMove, event.lastMove.c_str()) != 0)
+      slot->hasCursor = false;
+    copyField(slot->fen, sizeof(slot->fen), event.fen);
+    copyField(slot->lastMove, sizeof(slot->lastMove), event.lastMove);
+    slot->myColor = event.myColor;
+    slot->isMyTurn = event.isMyTurn;
+  } else {
+    Serial.println("Lichess games: Cache full, ignoring " + event.gameId);
+  }
+}
+
+void LichessGames::update(const LichessGameSummary& summary) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  LichessGameSummary* slot = slotFor(summary.gameId);
+  if (slot)
+    *slot = summary;
+  xSemaphoreGive(mutex);
+}
+
+void LichessGames::remove(const String& gameId) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  int i = find(gameId.c_str());
+  if (i >= 0) {
+    games[i] = games[--gameCount];
+    if (strcmp(switchTo, gameId.c_str()) == 0)
+      switchTo[0] = '\0';
+  }
+  xSemaphoreGive(mutex);
+}
+
+void LichessGames::sync(const LichessEvent* playing, int playingCount) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  // The game on the board is kept current by its own stream
+  for (int i = 0; i < playingCount; i++)
+    if (playing[i].gameId != current)
+      apply(playing[i]);
+  for (int i = gameCount - 1; i >= 0; i--) {
+    if (strcmp(games[i].gameId, current) == 0)
+      continue;
+    bool listed = false;
+    for (int j = 0; j < playingCount && !listed; j++)
+      listed = playing[j].gameId == games[i].gameId;
+    if (!listed) {
+      if (strcmp(switchTo, games[i].gameId) == 0)
+        switchTo[0] = '\0';
+      games[i] = games[--gameCount];
+    }
+  }
+  xSemaphoreGive(mutex);
+}
+
+bool LichessGames::refreshInBackground() {
+  if (refreshing)
+    return false;
+  // TLS handshakes need a deep stack; run next to the WiFi stack on core 0
+  if (!refreshTask)
+    xTaskCreatePinnedToCore(refreshTaskLoop, "LichessGames", 8192, nullptr, 1, &refreshTask, 0);
+  if (!refreshTask)
+    return false;
+  refreshing = true;
+  xTaskNotifyGive(refreshTask);
+  return true;
+}
+
+void LichessGames::refreshTaskLoop(void* param) {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    LichessEvent playing[LICHESS_GAMES_MAX];
+    int playingCount = LichessAPI::getPlayingGames(playing, LICHESS_GAMES_MAX);
+    if (playingCount >= 0)
+      sync(playing, playingCount);
+    refreshing = false;
+  }
+}
+
+bool LichessGames::get(const String& gameId, LichessGameSummary& summary) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  int i = find(gameId.c_str());
+  if (i >= 0)
+    summary = games[i];
+  xSemaphoreGive(mutex);
+  return i >= 0;
+}
+
+bool LichessGames::pick(LichessGameSummary& summary) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  int chosen = gameCount > 0 ? 0 : -1;
+  for (int i = 0; i < gameCount; i++)
+    if (games[i].isMyTurn) {
+      chosen = i;
+      break;
+    }
+  if (chosen >= 0)
+    summary = games[chosen];
+  xSemaphoreGive(mutex);
+  return chosen >= 0;
+}
+
+int LichessGames::count() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  int n = gameCount;
+  xSemaphoreGive(mutex);
+  return n;
+}
+
+String LichessGames::toJSON() {
+  JsonDocument doc;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  doc["current"] = current;
+  JsonArray list = doc["games"].to<JsonArray>();
+  for (int i = 0; i < gameCount; i++) {
+    JsonObject game = list.add<JsonObject>();
+    game["id"] = games[i].gameId;
+    game["fen"] = games[i].fen;
+    game["lastMove"] = games[i].lastMove;
+    game["color"] = games[i].myColor == 'b' ? "black" : "white";
+    game["myTurn"] = games[i].isMyTurn;
+  }
+  xSemaphoreGive(mutex);
+  String output;
+  serializeJson(doc, output);
+  return output;
+}
+
+bool LichessGames::requestSwitch(const String& gameId) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  bool known = find(gameId.c_str()) >= 0;
+  if (known)
+    copyField(switchTo, sizeof(switchTo), gameId);
+  xSemaphoreGive(mutex);
+  return known;
+}
+
+bool LichessGames::takeSwitchRequest(String& gameId) {
+  if (switchTo[0] == '\0')
+    return false;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  gameId = switchTo;
+  switchTo[0] = '\0';
+  xSemaphoreGive(mutex);
+  return gameId.length() > 0;
+}
+
+void LichessGames::setCurrent(const String& gameId) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  copyField(current, sizeof(current), gameId);
+  xSemaphoreGive(mutex);
+}
@@ -0,0 +1,77 @@
+#ifndef LICHESS_GAMES_H
+#define LICHESS_GAMES_H
+
+#include "lichess_api.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// Ongoing games tracked at once (correspondence players often have several)
+#define LICHESS_GAMES_MAX 8
+#define LICHESS_GAME_ID_LEN 8
+#define LICHESS_FEN_MAX 92
+
+// Compact cached state of one ongoing Lichess game
+struct LichessGameSummary {
+  char gameId[LICHESS_GAME_ID_LEN + 1];
+  char fen[LICHESS_FEN_MAX]; // Current position
+  char lastMove[6];          // UCI, empty before the first move
+  char myColor;              // 'w' or 'b'
+  bool isMyTurn;
+  // Moves cursor (see LichessGameState), valid once the game was followed on its own stream
+  bool hasCursor;
+  int moveCount;
+  uint16_t movesLength;
+};
+
+// Cache of the account's ongoing games, fed by the event stream (gameStart/gameFinish),
+// by the game stream of the game on the board and by a slow poll of /api/account/playing
+// for the others, which have no stream of their own. The web UI lists the games and
+// asks for a switch; the Lichess mode takes the request in its loop. Thread-safe.
+class LichessGames {
+ public:
+  // Create the lock; setup() calls it before the web server can ask for the list
+  static void begin();
+  static void clear();
+
+  // Add or refresh a game announced by gameStart
+  static void update(const LichessEvent& event);
+  // Refresh the game on the board after a move
+  static void update(const LichessGameSummary& summary);
+  static void remove(const String& gameId);
+  // Replace the games not on the board with the list from /api/account/playing:
+  // refresh those listed, drop those that ended
+  static void sync(const LichessEvent* playing, int playingCount);
+  // Fetch /api/account/playing on a background task and sync() the result, so the
+  // main loop does not wait for it. False if the previous fetch is still running.
+  static bool refreshInBackground();
+  static bool get(const String& gameId, LichessGameSummary& summary);
+  // First cached game where it is our turn, else the first one. False if none.
+  static bool pick(LichessGameSummary& summary);
+  static int count();
+
+  // {"current":"id","games":[{"id","fen","lastMove","color","myTurn"}]}
+  static String toJSON();
+
+  // Web UI: ask the Lichess mode to put another game on the board
+  static bool requestSwitch(const String& gameId);
+  static bool takeSwitchRequest(String& gameId);
+  static void setCurrent(const String& gameId);
+
+ private:
+  static LichessGameSummary games[LICHESS_GAMES_MAX];
+  static int gameCount;
+  static char current[LICHESS_GAME_ID_LEN + 1];
+  static char switchTo[LICHESS_GAME_ID_LEN + 1];
+  static SemaphoreHandle_t mutex;
+  static TaskHandle_t refreshTask;
+  static volatile bool refreshing;
+
+  static int find(const char* gameId);
+  static LichessGameSummary* slotFor(const char* gameId);
+  static void apply(const LichessEvent& event); // Caller holds the lock
+  static void refreshTaskLoop(void* param);
+};
+
+#endif // LICHESS_GAMES_H
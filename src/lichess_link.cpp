@@ -0,0 +1,106 @@
+#include "lichess_link.h"
+
+// ---------------------------------------------------------------
+// LichessLinkMonitor
+
+void LichessLinkMonitor::reset(unsigned long now) {
+  link = LichessLink::ONLINE;
+  wifiWasUp = true;
+  streamDown = false;
+  streamDownSince = now;
+  lastWifiRetry = now;
+}
+
+LichessLinkActions LichessLinkMonitor::update(bool wifiUp, bool streamConnected, unsigned long now) {
+  LichessLinkActions actions = {false, false, false};
+  if (wifiUp && !wifiWasUp) {
+    // Pooled sockets died with the old link; reconnect now instead of waiting out the backoff
+    actions.reopenStreams = true;
+  } else if (!wifiUp && now - lastWifiRetry >= LICHESS_WIFI_RETRY_MS) {
+    actions.retryWifi = true;
+    lastWifiRetry = now;
+  }
+  wifiWasUp = wifiUp;
+
+  if (streamConnected) {
+    streamDown = false;
+  } else if (!streamDown) {
+    streamDown = true;
+    streamDownSince = now;
+  }
+  bool offline = !wifiUp || (streamDown && now - streamDownSince >= LICHESS_OFFLINE_AFTER_MS);
+  LichessLink previous = link;
+  if (offline)
+    link = LichessLink::OFFLINE;
+  else if (link == LichessLink::OFFLINE && streamConnected)
+    link = LichessLink::RESYNCING;
+  actions.changed = link != previous;
+  return actions;
+}
+
+bool LichessLinkMonitor::stateReceived() {
+  // The first state after a reconnect has reconciled any queued move
+  if (link == LichessLink::ONLINE)
+    return false;
+  link = LichessLink::ONLINE;
+  return true;
+}
+
+// ---------------------------------------------------------------
+// LichessPendingMove
+
+void LichessPendingMove::clear() {
+  uciMove = "";
+  ply = 0;
+  attempts = 0;
+  awaitingState = false;
+}
+
+LichessMoveAction LichessPendingMove::queue(const String& move, int movePly, bool online) {
+  uciMove = move;
+  ply = movePly;
+  attempts = 0;
+  // Posting now would only fail; the gameFull after reconnecting sends it if Lichess lacks it
+  awaitingState = !online;
+  return online ? LichessMoveAction::POST : LichessMoveAction::NONE;
+}
+
+LichessMoveAction LichessPendingMove::postResult(bool sent, bool online) {
+  // The stream may already have confirmed the move
+  if (!active())
+    return LichessMoveAction::NONE;
+  if (sent) {
+    clear();
+    return LichessMoveAction::NONE;
+  }
+  // The POST failed or its result was lost. Lichess may still have the move (e.g. the
+  // response timed out), so ask for the current state instead of posting it again blindly.
+  awaitingState = true;
+  if (!online) {
+    attempts--;
+    return LichessMoveAction::NONE;
+  }
+  return LichessMoveAction::RECONNECT;
+}
+
+LichessMoveAction LichessPendingMove::stateReceived(int moveCount, bool resendAllowed) {
+  if (!active())
+    return LichessMoveAction::NONE;
+  if (moveCount >= ply) {
+    // Lichess has the move; a late result from the sender is ignored
+    clear();
+    return LichessMoveAction::NONE;
+  }
+  if (!awaitingState || !resendAllowed)
+    return LichessMoveAction::NONE;
+  awaitingState = false;
+  if (attempts < LICHESS_MOVE_MAX_ATTEMPTS)
+    return LichessMoveAction::POST;
+  clear();
+  return LichessMoveAction::GIVE_UP;
+}
+
+void LichessPendingMove::dropIfMissing(int moveCount) {
+  if (active() && moveCount < ply)
+    clear();
+}
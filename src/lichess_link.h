@@ -0,0 +1,89 @@
+#ifndef LICHESS_LINK_H
+#define LICHESS_LINK_H
+
+#include <Arduino.h>
+
+// POSTs made for one move before the game is abandoned
+#define LICHESS_MOVE_MAX_ATTEMPTS 3
+// Game stream down this long (or WiFi lost) counts as offline: own moves wait for the link
+#define LICHESS_OFFLINE_AFTER_MS 5000
+// While WiFi is down, how often to ask the driver to reconnect
+#define LICHESS_WIFI_RETRY_MS 10000
+
+// Connection to the followed game, shown on the corner squares while not ONLINE
+enum class LichessLink : uint8_t {
+  ONLINE,
+  OFFLINE,  // WiFi or game stream lost; own moves are kept on the board
+  RESYNCING // Stream reopened, waiting for the gameFull that reconciles them
+};
+
+// What ChessLichess has to do after LichessLinkMonitor::update()
+struct LichessLinkActions {
+  bool reopenStreams; // WiFi is back: drop idle pooled sockets and reconnect both streams now
+  bool retryWifi;     // Ask the WiFi driver to reconnect
+  bool changed;       // The link state changed
+};
+
+// Link state across WiFi drops. Inputs and time are passed in, so the logic does not
+// depend on WiFi or millis(); ChessLichess feeds it every loop.
+class LichessLinkMonitor {
+ public:
+  LichessLinkMonitor() { reset(0); }
+  void reset(unsigned long now);
+
+  LichessLinkActions update(bool wifiUp, bool streamConnected, unsigned long now);
+  // A game state arrived on the stream; true if that ended an outage
+  bool stateReceived();
+
+  LichessLink state() const { return link; }
+  bool online() const { return link == LichessLink::ONLINE; }
+
+ private:
+  LichessLink link;
+  bool wifiWasUp;
+  bool streamDown;
+  unsigned long streamDownSince;
+  unsigned long lastWifiRetry;
+};
+
+enum class LichessMoveAction : uint8_t {
+  NONE,
+  POST,      // Hand the move to LichessMoveSender (after posting())
+  RECONNECT, // Reopen the game stream; the state it replays decides
+  GIVE_UP    // Attempts used up, the game cannot go on
+};
+
+// Own move played on the board and not yet seen on the game stream. Lichess allows one
+// outstanding move per game, so this is the whole queue. A move is posted again only when
+// a streamed state shows Lichess does not have it, never blindly.
+class LichessPendingMove {
+ public:
+  LichessPendingMove() { clear(); }
+  void clear();
+
+  // Move played on the board; ply is the server ply count that includes it.
+  // POST while online, otherwise it waits for the state after reconnecting.
+  LichessMoveAction queue(const String& uciMove, int ply, bool online);
+  // Before every POST of the move
+  void posting() { attempts++; }
+  // Outcome of a POST (sent false also when the sender could not take it). A failure
+  // while offline is not counted: the outage, not the move, was the problem.
+  LichessMoveAction postResult(bool sent, bool online);
+  // Ply count of a streamed state. resendAllowed is false while the board is rebuilt from
+  // Lichess' moves (resync, takeback, game end), which drops the move instead.
+  LichessMoveAction stateReceived(int moveCount, bool resendAllowed);
+  // The board was rebuilt from a state with moveCount plies; forget the move if it is not among them
+  void dropIfMissing(int moveCount);
+
+  bool active() const { return uciMove.length() > 0; }
+  const String& move() const { return uciMove; }
+  int getAttempts() const { return attempts; }
+
+ private:
+  String uciMove; // Empty when nothing is outstanding
+  int ply;        // Server ply count that includes the move
+  int attempts;   // POSTs made for the move
+  bool awaitingState;
+};
+
+#endif // LICHESS_LINK_H
@@ -0,0 +1,135 @@
+#include "lichess_move_sender.h"
+#include "lichess_api.h"
+
+LichessMoveSender::Move LichessMoveSender::moves[LICHESS_MOVE_SENDER_MAX_MOVES];
+QueueHandle_t LichessMoveSender::queue = nullptr;
+SemaphoreHandle_t LichessMoveSender::mutex = nullptr;
+uint32_t LichessMoveSender::nextId = 1;
+volatile unsigned long LichessMoveSender::lastLatencyMs = 0;
+volatile uint32_t LichessMoveSender::sentCount = 0;
+volatile uint32_t LichessMoveSender::failedCount = 0;
+
+void LichessMoveSender::begin() {
+  if (queue)
+    return;
+  mutex = xSemaphoreCreateMutex();
+  queue = xQueueCreate(LICHESS_MOVE_SENDER_MAX_MOVES, sizeof(uint8_t));
+  // TLS handshakes need a deep stack; run next to the WiFi stack on core 0
+  xTaskCreatePinnedToCore(workerTask, "LichessMoves", 8192, nullptr, 1, nullptr, 0);
+}
+
+uint32_t LichessMoveSender::submit(const String& gameId, const String& uciMove) {
+  begin();
+  if (gameId.length() >= sizeof(moves[0].gameId) || uciMove.length() >= sizeof(moves[0].uci))
+    return 0;
+  uint32_t id = 0;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (uint8_t i = 0; i < LICHESS_MOVE_SENDER_MAX_MOVES; i++) {
+    Move& move = moves[i];
+    if (move.state != MoveState::FREE)
+      continue;
+    id = nextId++;
+    if (nextId == 0) nextId = 1;
+    move.id = id;
+    move.state = MoveState::QUEUED;
+    move.forgotten = false;
+    strcpy(move.gameId, gameId.c_str());
+    strcpy(move.uci, uciMove.c_str());
+    xQueueSend(queue, &i, 0); // Never blocks: the queue holds one entry per move slot
+    break;
+  }
+  xSemaphoreGive(mutex);
+  if (id == 0)
+    Serial.println("Lichess move sender: Queue full");
+  return id;
+}
+
+LichessMoveStatus LichessMoveSender::poll(uint32_t id) {
+  if (!mutex || id == 0)
+    return LichessMoveStatus::UNKNOWN;
+  LichessMoveStatus status = LichessMoveStatus::UNKNOWN;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < LICHESS_MOVE_SENDER_MAX_MOVES; i++) {
+    Move& move = moves[i];
+    if (move.state == MoveState::FREE || move.id != id)
+      continue;
+    if (move.state == MoveState::SENT)
+      status = LichessMoveStatus::SENT;
+    else if (move.state == MoveState::FAILED)
+      status = LichessMoveStatus::FAILED;
+    else
+      status = LichessMoveStatus::PENDING;
+    if (status != LichessMoveStatus::PENDING)
+      move.state = MoveState::FREE;
+    break;
+  }
+  xSemaphoreGive(mutex);
+  return status;
+}
+
+void LichessMoveSender::forget(uint32_t id) {
+  if (!mutex || id == 0)
+    return;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < LICHESS_MOVE_SENDER_MAX_MOVES; i++) {
+    Move& move = moves[i];
+    if (move.state == MoveState::FREE || move.id != id)
+      continue;
+    if (move.state == MoveState::SENT || move.state == MoveState::FAILED)
+      move.state = MoveState::FREE;
+    else
+      move.forgotten = true;
+    break;
+  }
+  xSemaphoreGive(mutex);
+}
+
+int LichessMoveSender::getQueueDepth() {
+  if (!mutex)
+    return 0;
+  int depth = 0;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < LICHESS_MOVE_SENDER_MAX_MOVES; i++)
+    if (moves[i].state == MoveState::QUEUED || moves[i].state == MoveState::POSTING)
+      depth++;
+  xSemaphoreGive(mutex);
+  return depth;
+}
+
+void LichessMoveSender::workerTask(void* param) {
+  uint8_t index;
+  while (true) {
+    if (xQueueReceive(queue, &index, portMAX_DELAY) != pdTRUE)
+      continue;
+    Move& move = moves[index];
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    // Already failed with an earlier move of its game, or freed since
+    if (move.state != MoveState::QUEUED) {
+      xSemaphoreGive(mutex);
+      continue;
+    }
+    move.state = MoveState::POSTING;
+    String gameId = move.gameId;
+    String uci = move.uci;
+    xSemaphoreGive(mutex);
+
+    unsigned long start = millis();
+    bool ok = LichessAPI::makeMove(gameId, uci);
+    lastLatencyMs = millis() - start;
+    Serial.printf("Lichess move sender: %s %s in %lu ms\n", uci.c_str(), ok ? "sent" : "failed", lastLatencyMs);
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    move.state = move.forgotten ? MoveState::FREE : ok ? MoveState::SENT : MoveState::FAILED;
+    if (ok) {
+      sentCount++;
+    } else {
+      failedCount++;
+      // Later moves of the same game depend on this one: fail them without posting
+      for (int i = 0; i < LICHESS_MOVE_SENDER_MAX_MOVES; i++)
+        if (moves[i].state == MoveState::QUEUED && strcmp(moves[i].gameId, gameId.c_str()) == 0)
+          moves[i].state = moves[i].forgotten ? MoveState::FREE : MoveState::FAILED;
+    }
+    xSemaphoreGive(mutex);
+  }
+}
@@ -0,0 +1,67 @@
+#ifndef LICHESS_MOVE_SENDER_H
+#define LICHESS_MOVE_SENDER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// Max moves queued or in flight at once
+#define LICHESS_MOVE_SENDER_MAX_MOVES 4
+
+enum class LichessMoveStatus {
+  PENDING, // Queued or being posted
+  SENT,    // Lichess accepted the move (result consumed by poll)
+  FAILED,  // The POST failed or was rejected (result consumed by poll)
+  UNKNOWN  // No such move (never submitted or already consumed)
+};
+
+// Posts moves to /api/board/game/{id}/move/{uci} from a background task, strictly
+// in submission order, so the main loop keeps scanning while the request runs.
+// Each move is posted once; callers reconcile failures against the game stream.
+class LichessMoveSender {
+ public:
+  static void begin();
+
+  // Queue a move. Returns its id, or 0 if the queue is full.
+  static uint32_t submit(const String& gameId, const String& uciMove);
+
+  // Check a move. SENT and FAILED free the entry.
+  static LichessMoveStatus poll(uint32_t id);
+  // Drop interest in a move: its entry is freed now, or once its POST is done
+  static void forget(uint32_t id);
+
+  // Diagnostics
+  static int getQueueDepth();                                       // Moves queued or in flight
+  static unsigned long getLastLatencyMs() { return lastLatencyMs; } // Duration of the last POST
+  static uint32_t getSentCount() { return sentCount; }
+  static uint32_t getFailedCount() { return failedCount; }
+
+ private:
+  enum class MoveState : uint8_t {
+    FREE,
+    QUEUED,
+    POSTING,
+    SENT,
+    FAILED
+  };
+  struct Move {
+    uint32_t id;
+    MoveState state;
+    bool forgotten; // Nobody polls it any more; free it when the POST is done
+    char gameId[16];
+    char uci[6];
+  };
+  static Move moves[LICHESS_MOVE_SENDER_MAX_MOVES];
+  static QueueHandle_t queue; // Move indices in submission order
+  static SemaphoreHandle_t mutex;
+  static uint32_t nextId;
+  static volatile unsigned long lastLatencyMs;
+  static volatile uint32_t sentCount;
+  static volatile uint32_t failedCount;
+
+  static void workerTask(void* param);
+};
+
+#endif // LICHESS_MOVE_SENDER_H
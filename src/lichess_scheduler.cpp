@@ -0,0 +1,134 @@
+#include "lichess_scheduler.h"
+
+// ---------------------------------------------------------------
+// LichessRateLimiter
+
+LichessRateLimiter::LichessRateLimiter() : coolingDown(false), cooldownUntil(0), movesPending(0), rateLimitedCount(0) {
+  buckets[(int)LichessRequestKind::MOVE] = {LICHESS_MOVE_BURST, LICHESS_MOVE_REFILL_MS, 0, 0};
+  buckets[(int)LichessRequestKind::STREAM] = {LICHESS_STREAM_BURST, LICHESS_STREAM_REFILL_MS, 0, 0};
+  buckets[(int)LichessRequestKind::API] = {LICHESS_API_BURST, LICHESS_API_REFILL_MS, 0, 0};
+  reset(0);
+}
+
+void LichessRateLimiter::reset(unsigned long now) {
+  for (Bucket& bucket : buckets) {
+    bucket.tokens = bucket.burst;
+    bucket.lastRefill = now;
+  }
+  coolingDown = false;
+  movesPending = 0;
+}
+
+void LichessRateLimiter::refill(Bucket& bucket, unsigned long now) {
+  unsigned long earned = (now - bucket.lastRefill) / bucket.refillMs;
+  if (earned == 0)
+    return;
+  bucket.tokens = min((unsigned long)bucket.burst, bucket.tokens + earned);
+  // A full bucket does not bank time towards the next token
+  bucket.lastRefill = bucket.tokens == bucket.burst ? now : bucket.lastRefill + earned * bucket.refillMs;
+}
+
+unsigned long LichessRateLimiter::cooldownRemainingMs(unsigned long now) const {
+  if (!coolingDown || (long)(cooldownUntil - now) <= 0)
+    return 0;
+  return cooldownUntil - now;
+}
+
+unsigned long LichessRateLimiter::waitMs(LichessRequestKind kind, unsigned long now) {
+  Bucket& bucket = buckets[(int)kind];
+  refill(bucket, now);
+  unsigned long wait = cooldownRemainingMs(now);
+  if (wait == 0)
+    coolingDown = false;
+  if (bucket.tokens == 0)
+    wait = max(wait, bucket.refillMs - (now - bucket.lastRefill));
+  if (kind != LichessRequestKind::MOVE && movesPending > 0)
+    wait = max(wait, (unsigned long)LICHESS_MOVE_PRIORITY_MS);
+  return wait;
+}
+
+bool LichessRateLimiter::tryAcquire(LichessRequestKind kind, unsigned long now) {
+  if (waitMs(kind, now) > 0)
+    return false;
+  buckets[(int)kind].tokens--;
+  return true;
+}
+
+void LichessRateLimiter::report(LichessRequestKind kind, int status, unsigned long now) {
+  if (kind == LichessRequestKind::MOVE)
+    moveDone();
+  if (status != 429)
+    return;
+  rateLimitedCount++;
+  coolingDown = true;
+  cooldownUntil = now + LICHESS_RATE_LIMIT_COOLDOWN_MS;
+}
+
+// ---------------------------------------------------------------
+// LichessScheduler
+
+LichessRateLimiter LichessScheduler::limiter;
+SemaphoreHandle_t LichessScheduler::mutex = nullptr;
+
+void LichessScheduler::begin() {
+  if (!mutex)
+    mutex = xSemaphoreCreateMutex();
+}
+
+bool LichessScheduler::acquire(LichessRequestKind kind, unsigned long maxWaitMs) {
+  unsigned long start = millis();
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  if (kind == LichessRequestKind::MOVE)
+    limiter.moveQueued();
+  while (true) {
+    unsigned long now = millis();
+    unsigned long wait = limiter.waitMs(kind, now);
+    if (wait == 0) {
+      limiter.tryAcquire(kind, now);
+      xSemaphoreGive(mutex);
+      return true;
+    }
+    if (now - start + wait > maxWaitMs)
+      break;
+    xSemaphoreGive(mutex);
+    // Re-check at least every second: a report() may have changed the picture
+    delay(min(wait, 1000UL));
+    xSemaphoreTake(mutex, portMAX_DELAY);
+  }
+  if (kind == LichessRequestKind::MOVE)
+    limiter.moveDone();
+  unsigned long cooldown = limiter.cooldownRemainingMs(millis());
+  xSemaphoreGive(mutex);
+  if (cooldown > 0)
+    Serial.printf("Lichess scheduler: Rate limited, next request in %lu s\n", (cooldown + 999) / 1000);
+  return false;
+}
+
+void LichessScheduler::report(LichessRequestKind kind, int status) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  limiter.report(kind, status, millis());
+  xSemaphoreGive(mutex);
+  if (status == 429)
+    Serial.printf("Lichess scheduler: HTTP 429, pausing all requests for %d s\n", LICHESS_RATE_LIMIT_COOLDOWN_MS / 1000);
+}
+
+unsigned long LichessScheduler::waitMs(LichessRequestKind kind) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  unsigned long wait = limiter.waitMs(kind, millis());
+  xSemaphoreGive(mutex);
+  return wait;
+}
+
+unsigned long LichessScheduler::getCooldownRemainingMs() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  unsigned long remaining = limiter.cooldownRemainingMs(millis());
+  xSemaphoreGive(mutex);
+  return remaining;
+}
+
+uint32_t LichessScheduler::getRateLimitedCount() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  uint32_t count = limiter.getRateLimitedCount();
+  xSemaphoreGive(mutex);
+  return count;
+}
@@ -0,0 +1,86 @@
+#ifndef LICHESS_SCHEDULER_H
+#define LICHESS_SCHEDULER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Lichess asks clients that got HTTP 429 to wait a full minute before the next request
+#define LICHESS_RATE_LIMIT_COOLDOWN_MS 60000
+// Token buckets per request kind: burst size and the time to earn back one request
+#define LICHESS_MOVE_BURST 3
+#define LICHESS_MOVE_REFILL_MS 1000
+#define LICHESS_STREAM_BURST 3
+#define LICHESS_STREAM_REFILL_MS 3000
+#define LICHESS_API_BURST 3
+#define LICHESS_API_REFILL_MS 2000
+// How long other requests step back while a move waits or is being posted
+#define LICHESS_MOVE_PRIORITY_MS 250
+
+enum class LichessRequestKind : uint8_t {
+  MOVE,   // Move submission, served before everything else
+  STREAM, // Opening an NDJSON stream (account events, game, TV)
+  API,    // Any other REST call (account, resign)
+  COUNT
+};
+
+// Rate-limit bookkeeping for all Lichess traffic. Time is passed in, so the logic
+// does not depend on millis() or FreeRTOS; LichessScheduler wraps it for the firmware.
+class LichessRateLimiter {
+ public:
+  LichessRateLimiter();
+  // Fill all buckets and end any cool-down
+  void reset(unsigned long now);
+
+  // Milliseconds until a request of this kind may be sent, 0 if it may go now
+  unsigned long waitMs(LichessRequestKind kind, unsigned long now);
+  // Take a token if waitMs() is 0
+  bool tryAcquire(LichessRequestKind kind, unsigned long now);
+  // HTTP status of a sent request (-1 if none arrived). 429 starts the global cool-down.
+  void report(LichessRequestKind kind, int status, unsigned long now);
+
+  // A move waits for a token or is in flight until its report(); other kinds hold back meanwhile
+  void moveQueued() { movesPending++; }
+  void moveDone() { if (movesPending > 0) movesPending--; }
+
+  unsigned long cooldownRemainingMs(unsigned long now) const;
+  uint32_t getRateLimitedCount() const { return rateLimitedCount; }
+
+ private:
+  struct Bucket {
+    uint16_t burst;
+    uint16_t refillMs;
+    uint16_t tokens;
+    unsigned long lastRefill;
+  };
+  Bucket buckets[(int)LichessRequestKind::COUNT];
+  bool coolingDown;
+  unsigned long cooldownUntil;
+  int movesPending;
+  uint32_t rateLimitedCount;
+
+  void refill(Bucket& bucket, unsigned long now);
+};
+
+// Gate in front of every Lichess request (LichessAPI calls it). Thread-safe: moves are
+// posted from LichessMoveSender's task while the main loop opens streams.
+class LichessScheduler {
+ public:
+  // Create the lock; called from setup() before any Lichess request
+  static void begin();
+  // Wait up to maxWaitMs for permission to send. False (without waiting) if that takes longer.
+  static bool acquire(LichessRequestKind kind, unsigned long maxWaitMs = 0);
+  // Must follow every successful acquire() once the request is done
+  static void report(LichessRequestKind kind, int status);
+  static unsigned long waitMs(LichessRequestKind kind);
+
+  // Diagnostics
+  static unsigned long getCooldownRemainingMs();
+  static uint32_t getRateLimitedCount();
+
+ private:
+  static LichessRateLimiter limiter;
+  static SemaphoreHandle_t mutex;
+};
+
+#endif // LICHESS_SCHEDULER_H
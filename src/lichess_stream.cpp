@@ -0,0 +1,93 @@
+#include "lichess_stream.h"
+#include "http_pool.h"
+#include "lichess_api.h"
+#include "lichess_scheduler.h"
+#include <WiFi.h>
+
+void LichessStream::open(const String& newPath) {
+  if (newPath == path)
+    return;
+  close();
+  path = newPath;
+  failures = 0;
+  nextAttemptAt = millis();
+}
+
+void LichessStream::close() {
+  if (client) {
+    HttpPool::release(client, false);
+    client = nullptr;
+  }
+  path = "";
+}
+
+void LichessStream::reconnect() {
+  if (client) {
+    HttpPool::release(client, false);
+    client = nullptr;
+  }
+  nextAttemptAt = millis();
+}
+
+bool LichessStream::connect() {
+  // No WiFi: not a failure either, the attempt would only burn through the backoff
+  if (WiFi.status() != WL_CONNECTED) {
+    nextAttemptAt = millis() + LICHESS_STREAM_BACKOFF_MIN_MS;
+    return false;
+  }
+  // Held back by the rate limit or a move in flight: not a failure, try again once allowed
+  unsigned long wait = LichessScheduler::waitMs(LichessRequestKind::STREAM);
+  if (wait > 0) {
+    nextAttemptAt = millis() + wait;
+    return false;
+  }
+  HttpResponseHead head;
+  client = LichessAPI::openStream(path, head);
+  if (!client) {
+    failures++;
+    unsigned long backoff = min((unsigned long)LICHESS_STREAM_BACKOFF_MIN_MS << min(failures - 1, 5), (unsigned long)LICHESS_STREAM_BACKOFF_MAX_MS);
+    nextAttemptAt = millis() + backoff;
+    Serial.printf("Lichess stream: Cannot open %s (HTTP %d), retrying in %lu ms\n", path.c_str(), head.status, backoff);
+    return false;
+  }
+  decoder.reset(head.chunked);
+  connectedAt = lastDataAt = millis();
+  failures = 0;
+  Serial.println("Lichess stream: Following " + path);
+  return true;
+}
+
+void LichessStream::drop(const char* reason) {
+  Serial.printf("Lichess stream: %s after %lu s, reconnecting\n", reason, (millis() - connectedAt) / 1000);
+  HttpPool::release(client, false);
+  client = nullptr;
+  // A stream that was healthy for a while reconnects right away
+  nextAttemptAt = millis() + (millis() - connectedAt > LICHESS_STREAM_BACKOFF_MAX_MS ? 0 : LICHESS_STREAM_BACKOFF_MIN_MS);
+}
+
+bool LichessStream::poll(String& jsonLine) {
+  if (!isOpen())
+    return false;
+  if (!client && ((long)(millis() - nextAttemptAt) < 0 || !connect()))
+    return false;
+
+  while (client->available() > 0) {
+    int c = client->read();
+    if (c < 0)
+      break;
+    lastDataAt = millis();
+    if (decoder.push((char)c)) {
+      jsonLine = decoder.line();
+      return true;
+    }
+    if (decoder.failed()) {
+      drop("Broken chunk framing");
+      return false;
+    }
+  }
+  if (decoder.ended() || !client->connected())
+    drop("Closed by server");
+  else if (millis() - lastDataAt > LICHESS_STREAM_IDLE_TIMEOUT_MS)
+    drop("No keep-alive");
+  return false;
+}
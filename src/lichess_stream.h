@@ -0,0 +1,48 @@
+#ifndef LICHESS_STREAM_H
+#define LICHESS_STREAM_H
+
+#include "ndjson_decoder.h"
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+
+// Lichess sends an empty keep-alive line every few seconds; silence this long means the socket is dead
+#define LICHESS_STREAM_IDLE_TIMEOUT_MS 20000
+// Reconnect backoff: doubles per failed attempt up to the maximum
+#define LICHESS_STREAM_BACKOFF_MIN_MS 1000
+#define LICHESS_STREAM_BACKOFF_MAX_MS 30000
+
+// Long-lived Lichess NDJSON stream (game or event stream) on a pooled connection.
+// poll() never waits for data; a dropped or silent connection is reopened with
+// exponential backoff, and Lichess then replays the current state (gameFull).
+class LichessStream {
+ public:
+  LichessStream() : client(nullptr), connectedAt(0), lastDataAt(0), nextAttemptAt(0), failures(0) {}
+  ~LichessStream() { close(); }
+
+  // Start following path (e.g. "/api/board/game/stream/{id}"); connects on the next poll()
+  void open(const String& path);
+  void close();
+  // Drop the connection and reconnect on the next poll() without backoff, so Lichess
+  // replays the current state
+  void reconnect();
+
+  // Return the next complete event line, if one has arrived
+  bool poll(String& jsonLine);
+
+  bool isOpen() const { return path.length() > 0; }
+  bool isConnected() const { return client != nullptr; }
+
+ private:
+  String path;
+  WiFiClientSecure* client;
+  NdjsonDecoder decoder;
+  unsigned long connectedAt;
+  unsigned long lastDataAt;
+  unsigned long nextAttemptAt;
+  int failures;
+
+  bool connect();
+  void drop(const char* reason);
+};
+
+#endif // LICHESS_STREAM_H
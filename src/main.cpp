@@ -3,16 +3,25 @@
 #include "chess_engine.h"
 #include "chess_lichess.h"
 #include "chess_moves.h"
+#include "chess_spectate.h"
 #include "chess_utils.h"
+#include "engine_cache.h"
+#include "engine_worker.h"
+#include "game_analyzer.h"
+#include "http_pool.h"
 #include "led_colors.h"
+#include "lichess_games.h"
+#include "lichess_scheduler.h"
 #include "move_history.h"
+#include "net_telemetry.h"
 #include "ota_updater.h"
 #include "sensor_test.h"
+#include "stockfish_api.h"
+#include "uci_engine.h"
 #include "ui_comm.h"
 #include "version.h"
 #include "wifi_manager_esp32.h"
 #include <LittleFS.h>
-#include <WiFiClientSecure.h>
 #include <time.h>
 
 // ---------------------------
@@ -24,7 +33,8 @@ enum GameMode {
   MODE_CHESS_MOVES = 1,
   MODE_BOT = 2,
   MODE_LICHESS = 3,
-  MODE_SENSOR_TEST = 4
+  MODE_SENSOR_TEST = 4,
+  MODE_SPECTATE = 5
 };
 
 BotConfig botConfig = {StockfishSettings::medium(), true};
@@ -38,6 +48,7 @@ ChessMoves* chessMoves = nullptr;
 ChessBot* chessBot = nullptr;
 ChessLichess* chessLichess = nullptr;
 SensorTest* sensorTest = nullptr;
+ChessSpectate* chessSpectate = nullptr;
 
 GameMode currentMode = MODE_SELECTION;
 bool modeInitialized = false;
@@ -64,7 +75,7 @@ static void ui_touch_handler(const char* action, int x, int y) {
     Serial.printf("UI board touch: row=%d col=%d\n", x, y);
   } else if (strcmp(action, "mode") == 0) {
     Serial.printf("Mode selected from UI: %d\n", x);
-    if (x >= 1 && x <= 4) {
+    if (x >= 1 && x <= 5) {
       currentMode = (GameMode)x;
       modeInitialized = false;
       if (currentMode == MODE_BOT) {
@@ -77,45 +88,78 @@ static void ui_touch_handler(const char* action, int x, int y) {
   }
 }
 
-// Perform a Stockfish API request and return bestMove in UCI (or empty on failure)
-static String requestStockfishBestMove(const String& fen, const StockfishSettings& settings) {
-  WiFiSSLClient client;
-  client.setInsecure();
-  String path = StockfishAPI::buildRequestURL(fen, settings.depth);
-  Serial.println("Stockfish request (UI hint): " STOCKFISH_API_URL + path);
-  for (int attempt = 1; attempt <= settings.maxRetries; ++attempt) {
-    if (client.connect(STOCKFISH_API_URL, STOCKFISH_API_PORT)) {
-      client.println("GET " + path + " HTTP/1.1");
-      client.println("Host: " STOCKFISH_API_URL);
-      client.println("Connection: close");
-      client.println();
-      unsigned long startTime = millis();
-      String response = "";
-      bool got = false;
-      while (client.connected() && (millis() - startTime < (unsigned long)settings.timeoutMs)) {
-        if (client.available()) {
-          response = client.readString();
-          got = true;
-          break;
-        }
-        delay(10);
-      }
-      client.stop();
-      if (got && response.length() > 0) {
-        StockfishResponse resp;
-        if (StockfishAPI::parseResponse(response, resp)) {
-          return resp.bestMove;
-        } else {
-          Serial.printf("Stockfish parse error: %s\n", resp.errorMessage.c_str());
-          return String();
-        }
-      }
-    }
-    Serial.println("Stockfish API attempt failed, retrying...");
-    delay(300);
+// Hint for the position on the board, computed in the background after every ply
+static String hintFen;            // Position the hint below belongs to
+static uint32_t hintRequestId = 0; // In-flight EngineWorker request, 0 if none
+static String hintMove;           // Ready best move (UCI) for hintFen, empty until known
+static bool hintWanted = false;   // HINT was pressed while the request was in flight
+static bool hintsUsed = false;    // HINT was pressed in the current game
+
+// Only precompute for a player who uses hints, while the game waits for their move. Never in
+// Lichess mode: its streams hold two of the three pooled connections and the third is for moves.
+static bool backgroundHintUseful() {
+  if (!modeInitialized || !hintsUsed)
+    return false;
+  if (currentMode == MODE_CHESS_MOVES && chessMoves != nullptr)
+    return !chessMoves->isGameOver();
+  if (currentMode == MODE_BOT && chessBot != nullptr)
+    return !chessBot->isGameOver() && (chessBot->getCurrentTurn() == 'w') == botConfig.playerIsWhite;
+  return false;
+}
+
+static void showHint(const String& bestUci) {
+  Serial.printf("Best move (UCI): %s\n", bestUci.c_str());
+  UIComm::sendHintResponse(bestUci);
+  // Also show hint on the LED board: blink origin and destination 3 times in Blue
+  int fromRow = -1, fromCol = -1, toRow = -1, toCol = -1;
+  char promotion = ' ';
+  if (ChessUtils::parseUCIMove(bestUci, fromRow, fromCol, toRow, toCol, promotion)) {
+    // Blink origin then destination (3 times each) in Blue
+    boardDriver.blinkSquare(fromRow, fromCol, LedColors::Blue, 3, true);
+    boardDriver.blinkSquare(toRow, toCol, LedColors::Blue, 3, true);
+  } else {
+    Serial.println("Failed to parse UCI move for LED hint");
+  }
+}
+
+// Restart the hint when the position changes and collect finished results
+static void updateBackgroundHint() {
+  String fen = wifiManager.getCurrentFen();
+  if (fen != hintFen) {
+    EngineWorker::cancel(hintRequestId);
+    hintRequestId = 0;
+    hintMove = "";
+    hintWanted = false;
+    hintFen = fen;
+    if (fen.length() > 0 && backgroundHintUseful())
+      hintRequestId = EngineWorker::submit(fen, botConfig.stockfishSettings, true);
+  }
+  if (hintRequestId == 0)
+    return;
+  StockfishResponse resp;
+  EngineJobStatus status = EngineWorker::poll(hintRequestId, resp);
+  if (status == EngineJobStatus::PENDING)
+    return;
+  hintRequestId = 0;
+  if (status == EngineJobStatus::DONE && resp.bestMove.length() > 0)
+    hintMove = resp.bestMove;
+  if (hintWanted) {
+    hintWanted = false;
+    if (hintMove.length() > 0)
+      showHint(hintMove);
+    else
+      UIComm::sendSimple("ERROR|reason=stockfish_failed");
   }
-  Serial.println("Stockfish API: all attempts failed");
-  return String();
+}
+
+// Stop background work of the active game (engine request, thinking animation) before leaving it
+static void cancelActiveGame() {
+  if (chessBot != nullptr)
+    chessBot->cancelPendingActions();
+  if (chessLichess != nullptr)
+    chessLichess->cancelPendingActions();
+  if (chessSpectate != nullptr)
+    chessSpectate->cancelPendingActions();
 }
 
 void showGameSelection();
@@ -137,9 +181,18 @@ void setup() {
     Serial.println("ERROR: LittleFS mount failed!");
   else
     Serial.println("LittleFS mounted successfully");
+  NetTelemetry::begin();
+  HttpPool::begin();
+  UciEngine::begin();
+  StockfishAPI::begin();
+  LichessGames::begin();
+  LichessScheduler::begin();
   moveHistory.begin();
+  EngineCache::begin();
+  GameAnalyzer::begin();
   boardDriver.begin();
   wifiManager.begin();
+  EngineWorker::begin();
   // Start UI communication (Serial2) — chosen pins avoid board_driver defaults
   // RX must be an input-capable pin; use RX=34, TX=25
   UIComm::begin(115200, 34, 25);
@@ -198,32 +251,33 @@ void loop() {
   // Process UI comm
   UIComm::loop();
 
+  // Analyze finished games in the background
+  int finishedGameId = moveHistory.takeFinishedGameId();
+  if (finishedGameId > 0 && GameAnalyzer::isAutoAnalyze())
+    GameAnalyzer::enqueue(finishedGameId);
+  // Lichess and spectate streams hold two of the three pooled connections; the third is for moves
+  GameAnalyzer::setPaused(currentMode == MODE_LICHESS || currentMode == MODE_SPECTATE);
+  GameAnalyzer::update();
+
+  updateBackgroundHint();
   if (uiHintRequested) {
     uiHintRequested = false;
-    Serial.println("UI requested hint — computing via Stockfish API");
-    // Get current board FEN from WiFi manager (keeps latest game FEN)
-    String fen = wifiManager.getCurrentFen();
-    if (fen.length() == 0) {
+    hintsUsed = true;
+    if (hintFen.length() == 0) {
       Serial.println("Warning: no FEN available to compute hint");
       UIComm::sendSimple("ERROR|reason=no_fen");
+    } else if (hintMove.length() > 0) {
+      Serial.println("UI requested hint — answering from background result");
+      showHint(hintMove);
     } else {
-      // Use botConfig settings as hint depth preset
-      String bestUci = requestStockfishBestMove(fen, botConfig.stockfishSettings);
-      if (bestUci.length() == 0) {
+      // Attach to the running computation, or start one now (use botConfig settings as hint depth preset)
+      if (hintRequestId == 0)
+        hintRequestId = EngineWorker::submit(hintFen, botConfig.stockfishSettings);
+      if (hintRequestId == 0) {
         UIComm::sendSimple("ERROR|reason=stockfish_failed");
       } else {
-        Serial.printf("Best move (UCI): %s\n", bestUci.c_str());
-        UIComm::sendHintResponse(bestUci);
-        // Also show hint on the LED board: blink origin and destination 3 times in Blue
-        int fromRow = -1, fromCol = -1, toRow = -1, toCol = -1;
-        char promotion = ' ';
-        if (ChessUtils::parseUCIMove(bestUci, fromRow, fromCol, toRow, toCol, promotion)) {
-          // Blink origin then destination (3 times each) in Blue
-          boardDriver.blinkSquare(fromRow, fromCol, LedColors::Blue, 3, true);
-          boardDriver.blinkSquare(toRow, toCol, LedColors::Blue, 3, true);
-        } else {
-          Serial.println("Failed to parse UCI move for LED hint");
-        }
+        Serial.println("UI requested hint — waiting for Stockfish");
+        hintWanted = true;
       }
     }
   }
@@ -232,6 +286,7 @@ void loop() {
   if (uiNewGameRequested) {
     uiNewGameRequested = false;
     Serial.println("New game requested from UI slave display");
+    cancelActiveGame();
     showGameSelection();
     return;
   }
@@ -262,6 +317,7 @@ void loop() {
       chessMoves->setBoardStateFromFEN(editFen);
       Serial.println("Board edit applied to Chess Moves mode");
     } else if (currentMode == MODE_BOT && modeInitialized && chessBot != nullptr) {
+      chessBot->cancelPendingActions(); // A pending engine reply belongs to the old position
       chessBot->setBoardStateFromFEN(editFen);
       Serial.println("Board edit applied to Chess Bot mode");
     } else if (currentMode == MODE_LICHESS && modeInitialized && chessLichess != nullptr) {
@@ -324,12 +380,16 @@ void loop() {
       case 4:
         currentMode = MODE_SENSOR_TEST;
         break;
+      case 5:
+        currentMode = MODE_SPECTATE;
+        break;
       default:
         Serial.println("Invalid game mode selected via WiFi");
         selectedMode = 0;
         break;
     }
     if (selectedMode > 0) {
+      cancelActiveGame();
       modeInitialized = false;
       wifiManager.resetGameSelection();
       boardDriver.clearAllLEDs();
@@ -367,10 +427,13 @@ void loop() {
       break;
     case MODE_LICHESS:
       if (chessLichess != nullptr) {
-        if (chessLichess->isGameOver())
+        if (chessLichess->isGameOver()) {
+          // The game may end on our own move while its POST is still in flight
+          chessLichess->cancelPendingActions();
           showGameSelection();
-        else
+        } else {
           chessLichess->update();
+        }
       }
       break;
     case MODE_SENSOR_TEST:
@@ -381,6 +444,14 @@ void loop() {
           sensorTest->update();
       }
       break;
+    case MODE_SPECTATE:
+      if (chessSpectate != nullptr) {
+        if (chessSpectate->isGameOver())
+          showGameSelection();
+        else
+          chessSpectate->update();
+      }
+      break;
     default:
       showGameSelection();
       break;
@@ -502,6 +573,7 @@ void initializeSelectedMode(GameMode mode) {
     resumingGame = false;
   else
     moveHistory.discardLiveGame(); // Discard any incomplete live game that wasn't properly finished or resumed (finishGame already removes live files for completed games)
+  hintsUsed = false;
   switch (mode) {
     case MODE_CHESS_MOVES:
       Serial.println("Starting 'Chess Moves'...");
@@ -531,6 +603,13 @@ void initializeSelectedMode(GameMode mode) {
       sensorTest = new SensorTest(&boardDriver);
       sensorTest->begin();
       break;
+    case MODE_SPECTATE:
+      Serial.println("Starting 'Spectate Mode'...");
+      if (chessSpectate != nullptr)
+        delete chessSpectate;
+      chessSpectate = new ChessSpectate(&boardDriver, &chessEngine, &wifiManager, wifiManager.getSpectateTarget());
+      chessSpectate->begin();
+      break;
     default:
       showGameSelection();
       break;
@@ -599,6 +678,7 @@ void handleBotConfigSelection() {
             botConfig.stockfishSettings = StockfishSettings::expert();
             Serial.printf("Configuration: Play as %s, Expert difficulty\n", colorName);
           }
+          botConfig.stockfishSettings.backend = wifiManager.getEngineBackend();
           firstLoop = true;
           boardDriver.clearAllLEDs();
           return;
@@ -6,7 +6,7 @@
 #include <sys/stat.h>
 #include <time.h>
 
-MoveHistory::MoveHistory() : recording(false) {
+MoveHistory::MoveHistory() : recording(false), finishedGameId(0) {
   memset(&header, 0, sizeof(header));
 }
 
@@ -81,6 +81,18 @@ String MoveHistory::gamePath(int id) {
   return String(buf);
 }
 
+String MoveHistory::analysisPath(int id) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), "/games/game_%02d.ana", id);
+  return String(buf);
+}
+
+int MoveHistory::takeFinishedGameId() {
+  int id = finishedGameId;
+  finishedGameId = 0;
+  return id;
+}
+
 std::vector<int> MoveHistory::listGameIds() {
   std::vector<int> ids;
   File dir = LittleFS.open(GAMES_DIR);
@@ -114,7 +126,7 @@ void MoveHistory::enforceStorageLimits() {
 
   // 1. Enforce MAX_GAMES
   while ((int)ids.size() > MAX_GAMES) {
-    LittleFS.remove(gamePath(ids.front()));
+    deleteGame(ids.front());
     ids.erase(ids.begin());
     Serial.println("MoveHistory: deleted oldest game (max game limit)");
   }
@@ -125,7 +137,7 @@ void MoveHistory::enforceStorageLimits() {
     size_t used = LittleFS.usedBytes();
     if (total == 0 || (float)used / (float)total <= MAX_USAGE_PERCENT)
       break;
-    LittleFS.remove(gamePath(ids.front()));
+    deleteGame(ids.front());
     ids.erase(ids.begin());
     Serial.println("MoveHistory: deleted oldest game (storage limit)");
   }
@@ -244,8 +256,13 @@ void MoveHistory::finishGame(uint8_t result, char winnerColor) {
   // Rename to completed game file
   int id = nextGameId();
   String dest = gamePath(id);
+  // A sidecar left behind by a deleted game with the same id must not be mistaken for this game's analysis
+  String analysis = analysisPath(id);
+  if (quietExists(analysis.c_str()))
+    LittleFS.remove(analysis);
   LittleFS.rename(LIVE_MOVES_PATH, dest.c_str());
   discardLiveGame();
+  finishedGameId = id;
 
   Serial.printf("MoveHistory: game saved as %s (%d moves) (%d FEN entries)\n", dest.c_str(), header.moveCount, header.fenEntryCnt);
 }
@@ -407,5 +424,8 @@ String MoveHistory::getGameListJSON() {
 bool MoveHistory::deleteGame(int id) {
   String path = gamePath(id);
   if (!quietExists(path.c_str())) return false;
+  String analysis = analysisPath(id);
+  if (quietExists(analysis.c_str()))
+    LittleFS.remove(analysis);
   return LittleFS.remove(path);
 }
@@ -85,6 +85,12 @@ class MoveHistory {
   // Build the path string for a given game id
   static String gamePath(int id);
 
+  // Path of the analysis sidecar of a game (see GameAnalyzer)
+  static String analysisPath(int id);
+
+  // Id of the game saved by the last finishGame(), then 0 (main loop only)
+  int takeFinishedGameId();
+
   // Delete oldest games until count ≤ MAX_GAMES and LittleFS usage ≤ MAX_USAGE_PERCENT
   void enforceStorageLimits();
 
@@ -94,9 +100,13 @@ class MoveHistory {
   // Decode 2 bytes back into row/col/promotion
   static void decodeMove(uint16_t encoded, int& fromRow, int& fromCol, int& toRow, int& toCol, char& promotion);
 
+  // Move entry that stands for "next FEN table entry"
+  static constexpr uint16_t FEN_MARKER = 0xFFFF;
+
  private:
   bool recording;
   GameHeader header;
+  int finishedGameId;
 
   static constexpr const char* GAMES_DIR = "/games";
   static constexpr const char* LIVE_MOVES_PATH = "/games/live.bin";
@@ -104,7 +114,6 @@ class MoveHistory {
   static constexpr int MAX_GAMES = 50;
   static constexpr float MAX_USAGE_PERCENT = 0.80f;
   static constexpr uint8_t FORMAT_VERSION = 1;
-  static constexpr uint16_t FEN_MARKER = 0xFFFF;
 
   // Map promotion character to 4-bit code and back
   static uint8_t promoCharToCode(char p);
@@ -0,0 +1,112 @@
+#include "ndjson_decoder.h"
+
+void NdjsonDecoder::reset(bool isChunked) {
+  chunked = isChunked;
+  state = chunked ? State::CHUNK_SIZE : State::DATA;
+  chunkRemaining = -1;
+  lineReady = false;
+  overflow = false;
+  current = "";
+}
+
+bool NdjsonDecoder::pushData(char c) {
+  if (c != '\n') {
+    if (overflow)
+      return false;
+    if (current.length() >= NDJSON_MAX_LINE) {
+      Serial.println("NDJSON: Line too long, skipping it");
+      overflow = true;
+      current = "";
+      return false;
+    }
+    current += c;
+    return false;
+  }
+  if (current.endsWith("\r"))
+    current.remove(current.length() - 1);
+  // Empty lines are keep-alives
+  lineReady = !overflow && current.length() > 0;
+  overflow = false;
+  if (!lineReady)
+    current = "";
+  return lineReady;
+}
+
+bool NdjsonDecoder::push(char c) {
+  if (lineReady) {
+    current = "";
+    lineReady = false;
+  }
+  if (!chunked)
+    return pushData(c);
+
+  switch (state) {
+    case State::CHUNK_SIZE:
+      if (isxdigit(c)) {
+        chunkRemaining = max(chunkRemaining, 0L) * 16 + (isdigit(c) ? c - '0' : tolower(c) - 'a' + 10);
+        if (chunkRemaining > 0xFFFFFF)
+          state = State::ERROR;
+        return false;
+      }
+      if (c == ';' || c == ' ' || c == '\t')
+        state = State::CHUNK_EXTENSION;
+      else if (c == '\r')
+        state = State::CHUNK_SIZE_LF;
+      else if (c == '\n')
+        break;
+      else
+        state = State::ERROR;
+      return false;
+    case State::CHUNK_EXTENSION:
+      if (c == '\r')
+        state = State::CHUNK_SIZE_LF;
+      else if (c == '\n')
+        break;
+      return false;
+    case State::CHUNK_SIZE_LF:
+      if (c == '\n')
+        break;
+      state = State::ERROR;
+      return false;
+    case State::DATA: {
+      bool ready = pushData(c);
+      if (--chunkRemaining == 0)
+        state = State::DATA_CR;
+      return ready;
+    }
+    case State::DATA_CR:
+      if (c == '\r')
+        state = State::DATA_LF;
+      else if (c == '\n')
+        state = State::CHUNK_SIZE;
+      else
+        state = State::ERROR;
+      chunkRemaining = -1;
+      return false;
+    case State::DATA_LF:
+      state = c == '\n' ? State::CHUNK_SIZE : State::ERROR;
+      return false;
+    case State::TRAILER:
+      // Trailer lines (chunkRemaining counts their length) end with an empty line
+      if (c == '\n') {
+        if (chunkRemaining == 0)
+          state = State::END;
+        chunkRemaining = 0;
+      } else if (c != '\r') {
+        chunkRemaining++;
+      }
+      return false;
+    default:
+      return false;
+  }
+
+  // Chunk size line complete
+  if (chunkRemaining < 0) {
+    state = State::ERROR;
+  } else if (chunkRemaining == 0) {
+    state = State::TRAILER;
+  } else {
+    state = State::DATA;
+  }
+  return false;
+}
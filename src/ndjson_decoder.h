@@ -0,0 +1,38 @@
+#ifndef NDJSON_DECODER_H
+#define NDJSON_DECODER_H
+
+#include <Arduino.h>
+
+// Longest NDJSON line kept; longer lines (never sent by the endpoints we use) are dropped
+#define NDJSON_MAX_LINE 2048
+
+// Incremental decoder for an NDJSON response body, optionally with chunked transfer
+// encoding. Bytes may be fed split at any boundary; complete non-empty lines come out.
+class NdjsonDecoder {
+ public:
+  explicit NdjsonDecoder(bool chunked = false) { reset(chunked); }
+  void reset(bool chunked);
+
+  // Feed one body byte. Returns true when it completed a line, available from line()
+  // until the next push().
+  bool push(char c);
+  const String& line() const { return current; }
+
+  // Broken chunk framing; nothing more will be decoded
+  bool failed() const { return state == State::ERROR; }
+  // The terminating zero-size chunk arrived
+  bool ended() const { return state == State::END; }
+
+ private:
+  enum class State : uint8_t { CHUNK_SIZE, CHUNK_EXTENSION, CHUNK_SIZE_LF, DATA, DATA_CR, DATA_LF, TRAILER, END, ERROR };
+  State state;
+  bool chunked;
+  long chunkRemaining;
+  bool lineReady;
+  bool overflow; // Current line exceeded NDJSON_MAX_LINE and is being skipped
+  String current;
+
+  bool pushData(char c);
+};
+
+#endif // NDJSON_DECODER_H
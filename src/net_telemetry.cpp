@@ -0,0 +1,101 @@
+#include "net_telemetry.h"
+#include "lichess_api.h"
+#include "stockfish_api.h"
+#include <algorithm>
+
+NetTelemetry::Ring NetTelemetry::rings[(int)NetEndpoint::COUNT] = {};
+SemaphoreHandle_t NetTelemetry::mutex = nullptr;
+
+void NetTelemetry::begin() {
+  if (!mutex)
+    mutex = xSemaphoreCreateMutex();
+}
+
+void NetTelemetry::record(const NetSample& sample) {
+  if (sample.endpoint >= NetEndpoint::COUNT)
+    return;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  Ring& ring = rings[(int)sample.endpoint];
+  ring.samples[ring.next] = sample;
+  ring.next = (ring.next + 1) % NET_TELEMETRY_SAMPLES;
+  if (ring.count < NET_TELEMETRY_SAMPLES)
+    ring.count++;
+  ring.requests++;
+  ring.retries += sample.retries;
+  if (sample.status < 0 || sample.status >= 400)
+    ring.errors++;
+  xSemaphoreGive(mutex);
+}
+
+NetEndpoint NetTelemetry::classify(const char* host, const String& path) {
+  if (strcmp(host, STOCKFISH_API_URL) == 0)
+    return NetEndpoint::STOCKFISH;
+  if (strcmp(host, LICHESS_API_HOST) == 0)
+    return path.indexOf("/stream") >= 0 || path.endsWith("/feed") ? NetEndpoint::LICHESS_STREAM : NetEndpoint::LICHESS;
+  // Everything else is GitHub (release check and asset downloads)
+  return NetEndpoint::OTA;
+}
+
+const char* NetTelemetry::endpointName(NetEndpoint endpoint) {
+  switch (endpoint) {
+    case NetEndpoint::STOCKFISH:
+      return "stockfish";
+    case NetEndpoint::LICHESS:
+      return "lichess";
+    case NetEndpoint::LICHESS_STREAM:
+      return "lichessStream";
+    case NetEndpoint::OTA:
+      return "ota";
+    default:
+      return "unknown";
+  }
+}
+
+uint16_t NetTelemetry::percentile(uint16_t* values, int count, int pct) {
+  if (count <= 0)
+    return 0;
+  std::sort(values, values + count);
+  // Smallest value with at least pct% of the samples at or below it
+  int rank = (pct * count + 99) / 100;
+  return values[constrain(rank, 1, count) - 1];
+}
+
+NetPercentiles NetTelemetry::phasePercentiles(const NetSample* samples, int count, uint16_t NetSample::*phase, bool connectsOnly) {
+  uint16_t values[NET_TELEMETRY_SAMPLES];
+  int n = 0;
+  for (int i = 0; i < count; i++)
+    if (!connectsOnly || samples[i].connected)
+      values[n++] = samples[i].*phase;
+  NetPercentiles result;
+  result.p50 = percentile(values, n, 50);
+  result.p95 = percentile(values, n, 95);
+  result.p99 = percentile(values, n, 99);
+  return result;
+}
+
+void NetTelemetry::getStats(NetEndpoint endpoint, NetEndpointStats& stats) {
+  stats = NetEndpointStats();
+  if (endpoint >= NetEndpoint::COUNT)
+    return;
+  // Copy under the lock, compute outside it
+  NetSample samples[NET_TELEMETRY_SAMPLES];
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const Ring& ring = rings[(int)endpoint];
+  memcpy(samples, ring.samples, sizeof(samples));
+  stats.samples = ring.count;
+  stats.requests = ring.requests;
+  stats.errors = ring.errors;
+  stats.retries = ring.retries;
+  xSemaphoreGive(mutex);
+
+  for (int i = 0; i < stats.samples; i++) {
+    stats.bytes += samples[i].bytes;
+    if (samples[i].connected)
+      stats.connects++;
+  }
+  stats.dns = phasePercentiles(samples, stats.samples, &NetSample::dnsMs, true);
+  stats.connect = phasePercentiles(samples, stats.samples, &NetSample::connectMs, true);
+  stats.send = phasePercentiles(samples, stats.samples, &NetSample::sendMs, false);
+  stats.firstByte = phasePercentiles(samples, stats.samples, &NetSample::firstByteMs, false);
+  stats.total = phasePercentiles(samples, stats.samples, &NetSample::totalMs, false);
+}
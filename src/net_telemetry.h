@@ -0,0 +1,84 @@
+#ifndef NET_TELEMETRY_H
+#define NET_TELEMETRY_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Most recent requests kept per endpoint for the percentiles
+#define NET_TELEMETRY_SAMPLES 32
+
+enum class NetEndpoint : uint8_t {
+  STOCKFISH,      // stockfish.online
+  LICHESS,        // Lichess REST calls
+  LICHESS_STREAM, // Lichess NDJSON streams
+  OTA,            // GitHub release check and downloads
+  COUNT
+};
+
+// Timing of one outbound request, in milliseconds per phase. Phases that did not
+// happen (DNS and connect on a reused socket) stay 0.
+struct NetSample {
+  NetEndpoint endpoint;
+  bool connected;       // A new connection was opened for this request
+  uint8_t retries;      // Earlier attempts of the same request
+  int16_t status;       // HTTP status, -1 if no response arrived, 0 if nothing was sent
+  uint16_t dnsMs;       // Host name lookup
+  uint16_t connectMs;   // TCP + TLS handshake (WiFiClientSecure does both in connect())
+  uint16_t sendMs;      // Writing the request
+  uint16_t firstByteMs; // Request sent until the status line arrived
+  uint16_t totalMs;     // Connection acquired until released
+  uint32_t bytes;       // Response body bytes read
+};
+
+struct NetPercentiles {
+  uint16_t p50;
+  uint16_t p95;
+  uint16_t p99;
+};
+
+// Summary of the samples kept for one endpoint. DNS and connect percentiles only
+// cover requests that opened a connection.
+struct NetEndpointStats {
+  uint32_t requests; // Since boot
+  uint32_t errors;   // No response or HTTP status >= 400, since boot
+  uint32_t retries;  // Since boot
+  int samples;       // Samples behind the percentiles
+  int connects;      // Samples that opened a connection
+  uint32_t bytes;    // Body bytes over the samples
+  NetPercentiles dns, connect, send, firstByte, total;
+};
+
+// Ring buffers of per-request network timings, filled by HttpPool. Thread-safe.
+class NetTelemetry {
+ public:
+  // Create the lock; setup() calls it before the first request is recorded
+  static void begin();
+  static void record(const NetSample& sample);
+
+  // Endpoint a request belongs to, from the host and request path
+  static NetEndpoint classify(const char* host, const String& path);
+  static const char* endpointName(NetEndpoint endpoint);
+
+  static void getStats(NetEndpoint endpoint, NetEndpointStats& stats);
+
+  // Nearest-rank percentile (pct 1-100) of count values; sorts values in place.
+  // Returns 0 for an empty set.
+  static uint16_t percentile(uint16_t* values, int count, int pct);
+
+ private:
+  struct Ring {
+    NetSample samples[NET_TELEMETRY_SAMPLES];
+    int next;
+    int count;
+    uint32_t requests;
+    uint32_t errors;
+    uint32_t retries;
+  };
+  static Ring rings[(int)NetEndpoint::COUNT];
+  static SemaphoreHandle_t mutex;
+
+  static NetPercentiles phasePercentiles(const NetSample* samples, int count, uint16_t NetSample::*phase, bool connectsOnly);
+};
+
+#endif // NET_TELEMETRY_H
@@ -1,5 +1,6 @@
 #include "ota_updater.h"
 #include "board_driver.h"
+#include "http_pool.h"
 #include "led_colors.h"
 #include "version.h"
 #include <ArduinoJson.h>
@@ -11,6 +12,14 @@
 // TAR header is always 512 bytes
 static const size_t TAR_BLOCK_SIZE = 512;
 
+// Pooled connection for a release download, returned on every exit path. Not reusable:
+// GitHub redirects asset downloads to another host on the same socket.
+struct PooledDownload {
+  WiFiClientSecure* client;
+  explicit PooledDownload(const String& url) : client(HttpPool::acquire(OtaUpdater::hostFromUrl(url).c_str())) {}
+  ~PooledDownload() { HttpPool::release(client, false); }
+};
+
 OtaUpdater::OtaUpdater(BoardDriver* bd) : boardDriver(bd) {}
 
 const char* OtaUpdater::getCurrentVersion() {
@@ -32,17 +41,31 @@ bool OtaUpdater::isNewerVersion(const String& current, const String& remote) {
   return rPatch > cPatch;
 }
 
-bool OtaUpdater::beginHttpGet(HTTPClient& http, const String& url, int timeoutMs) {
+String OtaUpdater::hostFromUrl(const String& url) {
+  int start = url.indexOf("://");
+  start = (start < 0) ? 0 : start + 3;
+  int end = url.indexOf('/', start);
+  return (end < 0) ? url.substring(start) : url.substring(start, end);
+}
+
+bool OtaUpdater::beginHttpGet(HTTPClient& http, WiFiClientSecure& client, const String& url, int timeoutMs) {
   http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
   http.setTimeout(timeoutMs);
   http.setUserAgent("OpenChess/" FIRMWARE_VERSION);
+  http.setReuse(true); // Keep the pooled connection open after end()
 
-  if (!http.begin(url)) {
+  if (!http.begin(client, url)) {
     Serial.println("OTA: Failed to connect: " + url);
     return false;
   }
 
+  // HTTPClient connects, sends and reads the head in one call, so telemetry only gets the sum
+  unsigned long start = millis();
   int httpCode = http.GET();
+  if (NetSample* trace = HttpPool::trace(&client)) {
+    trace->status = httpCode > 0 ? httpCode : -1;
+    trace->firstByteMs = min(millis() - start, 65535UL);
+  }
   if (httpCode != 200) {
     Serial.printf("OTA: HTTP %d from: %s\n", httpCode, url.c_str());
     http.end();
@@ -120,11 +143,19 @@ OtaUpdateInfo OtaUpdater::checkForUpdate() {
 
   Serial.println("OTA: Checking for updates at " OTA_GITHUB_API_URL);
 
+  WiFiClientSecure* client = HttpPool::acquire(hostFromUrl(OTA_GITHUB_API_URL).c_str());
+  if (!client) return info;
   HTTPClient http;
-  if (!beginHttpGet(http, OTA_GITHUB_API_URL)) return info;
+  if (!beginHttpGet(http, *client, OTA_GITHUB_API_URL)) {
+    HttpPool::release(client, false);
+    return info;
+  }
 
   String payload = http.getString();
+  if (NetSample* trace = HttpPool::trace(client))
+    trace->bytes = payload.length();
   http.end();
+  HttpPool::release(client, client->connected());
 
   JsonDocument doc;
   DeserializationError err = deserializeJson(doc, payload);
@@ -176,8 +207,10 @@ bool OtaUpdater::applyFirmwareFromUrl(const String& url) {
 
   Serial.println("OTA: Downloading firmware from: " + url);
 
+  PooledDownload download(url);
+  if (!download.client) return false;
   HTTPClient http;
-  if (!beginHttpGet(http, url)) return false;
+  if (!beginHttpGet(http, *download.client, url)) return false;
 
   int contentLength = http.getSize();
   if (contentLength <= 0) {
@@ -199,6 +232,8 @@ bool OtaUpdater::applyFirmwareFromUrl(const String& url) {
   std::atomic<bool>* stopFlag = boardDriver->startWaitingAnimation();
 
   size_t written = Update.writeStream(*stream);
+  if (NetSample* trace = HttpPool::trace(download.client))
+    trace->bytes = written;
 
   if (stopFlag) stopFlag->store(true);
 
@@ -231,8 +266,10 @@ bool OtaUpdater::applyWebAssetsFromUrl(const String& url) {
 
   Serial.println("OTA: Downloading web assets from: " + url);
 
+  PooledDownload download(url);
+  if (!download.client) return false;
   HTTPClient http;
-  if (!beginHttpGet(http, url)) return false;
+  if (!beginHttpGet(http, *download.client, url)) return false;
 
   int contentLength = http.getSize();
   if (contentLength <= 0) {
@@ -244,6 +281,9 @@ bool OtaUpdater::applyWebAssetsFromUrl(const String& url) {
   std::atomic<bool>* stopFlag = boardDriver->startWaitingAnimation();
   WiFiClient* stream = http.getStreamPtr();
   bool success = applyWebAssetsFromStream(*stream, contentLength);
+  NetSample* trace = HttpPool::trace(download.client);
+  if (trace && success)
+    trace->bytes = contentLength;
   if (stopFlag) stopFlag->store(true);
   http.end();
   return success;
@@ -6,6 +6,7 @@
 // Forward declarations
 class BoardDriver;
 class HTTPClient;
+class WiFiClientSecure;
 
 // OTA update check result
 struct OtaUpdateInfo {
@@ -29,6 +30,9 @@ class OtaUpdater {
 
   static const char* getCurrentVersion();
 
+  // Host part of an http(s) URL, used as the connection pool key
+  static String hostFromUrl(const String& url);
+
   // Apply web assets + firmware from an OtaUpdateInfo (used by autoUpdate and web UI apply).
   // Applies web assets first, then firmware. Firmware triggers reboot on success.
   void applyUpdate(const OtaUpdateInfo& info);
@@ -42,9 +46,9 @@ class OtaUpdater {
   // Compare semantic versions. Returns true if remote is newer than current.
   static bool isNewerVersion(const String& current, const String& remote);
 
-  // Configure an HTTPClient and perform a GET request. Returns true on HTTP 200.
+  // Configure an HTTPClient on a pooled connection and perform a GET request. Returns true on HTTP 200.
   // On success, caller must call http.end(). On failure, http.end() is called internally.
-  static bool beginHttpGet(HTTPClient& http, const String& url, int timeoutMs = 10000);
+  static bool beginHttpGet(HTTPClient& http, WiFiClientSecure& client, const String& url, int timeoutMs = 10000);
 
   // Read exactly 'length' bytes from a stream with timeout. Returns actual bytes read.
   static size_t readStreamBytes(Stream& stream, uint8_t* buffer, size_t length, unsigned long timeoutMs = 10000);
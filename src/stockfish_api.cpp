@@ -1,39 +1,35 @@
 #include "stockfish_api.h"
+#include "engine_cache.h"
+#include "http_pool.h"
+#include "net_telemetry.h"
+#include "uci_engine.h"
 
-bool StockfishAPI::parseResponse(const String& response, StockfishResponse& stockfishResp) {
-  if (response.length() == 0) {
-    stockfishResp.success = false;
-    stockfishResp.errorMessage = "JSON parsing failed: Empty response";
-    return false;
-  }
-
-  // Separate HTTP headers from body using the blank line (CRLF CRLF)
-  int headerEndPos = response.indexOf("\r\n\r\n");
-  String jsonOnly;
-
-  if (headerEndPos != -1) {
-    // Headers found, extract content after the blank line
-    jsonOnly = response.substring(headerEndPos + 4);
-  } else {
-    // Try Unix line endings (LF LF)
-    headerEndPos = response.indexOf("\n\n");
-    if (headerEndPos != -1)
-      jsonOnly = response.substring(headerEndPos + 2);
-    else
-      jsonOnly = response; // No header separator found, assume entire response is JSON
-  }
+uint16_t StockfishAPI::latencies[STOCKFISH_MAX_DEPTH - STOCKFISH_MIN_DEPTH + 1][STOCKFISH_HEDGE_LATENCY_SAMPLES] = {};
+uint8_t StockfishAPI::latencyCount[STOCKFISH_MAX_DEPTH - STOCKFISH_MIN_DEPTH + 1] = {};
+uint8_t StockfishAPI::latencyNext[STOCKFISH_MAX_DEPTH - STOCKFISH_MIN_DEPTH + 1] = {};
+int StockfishAPI::hedgeBudget = 100;
+uint32_t StockfishAPI::requests = 0;
+uint32_t StockfishAPI::hedges = 0;
+uint32_t StockfishAPI::hedgeWins = 0;
+SemaphoreHandle_t StockfishAPI::mutex = nullptr;
 
-  // Trim whitespace
-  jsonOnly.trim();
+void StockfishAPI::begin() {
+  if (!mutex)
+    mutex = xSemaphoreCreateMutex();
+}
 
-  if (jsonOnly.length() == 0) {
-    stockfishResp.success = false;
-    stockfishResp.errorMessage = "JSON parsing failed: No content after headers";
-    return false;
-  }
+bool StockfishAPI::parseResponse(Stream& body, StockfishResponse& stockfishResp) {
+  // Keep only the fields we use; continuation and echoed input are skipped while parsing
+  JsonDocument filter;
+  filter["success"] = true;
+  filter["bestmove"] = true;
+  filter["evaluation"] = true;
+  filter["mate"] = true;
+  filter["error"] = true; // Error text, only sent when success is false
+  filter["data"] = true;
 
-  StaticJsonDocument<256> doc;
-  DeserializationError error = deserializeJson(doc, jsonOnly);
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, body, DeserializationOption::Filter(filter));
 
   if (error) {
     stockfishResp.success = false;
@@ -105,15 +101,18 @@ bool StockfishAPI::parseResponse(const String& response, StockfishResponse& stoc
     }
   }
 
-  // Parse continuation (top engine line)
-  stockfishResp.continuation = doc.containsKey("continuation") ? doc["continuation"].as<String>() : "";
+  // Not kept by the filter
+  stockfishResp.continuation = "";
 
   return true;
 }
 
+int StockfishAPI::clampDepth(int depth) {
+  return depth > STOCKFISH_MAX_DEPTH ? STOCKFISH_MAX_DEPTH : (depth < STOCKFISH_MIN_DEPTH ? STOCKFISH_MIN_DEPTH : depth);
+}
+
 String StockfishAPI::buildRequestURL(const String& fen, int depth) {
-  // Validate depth (min 5 max 15)
-  int validDepth = depth > 15 ? 15 : (depth < 5 ? 5 : depth);
+  int validDepth = clampDepth(depth);
 
   // Build just the path + query (no scheme/host) so callers can reuse host/port constants
   String path = String(STOCKFISH_API_PATH) + "?fen=";
@@ -139,3 +138,201 @@ String StockfishAPI::buildRequestURL(const String& fen, int depth) {
 
   return path;
 }
+
+bool StockfishAPI::fetch(const String& fen, const StockfishSettings& settings, StockfishResponse& response, const std::atomic<bool>* abort) {
+  if (settings.backend == EngineBackend::UCI)
+    return UciEngine::fetch(fen, settings, response, abort);
+
+  int depth = clampDepth(settings.depth);
+  uint64_t key = EngineCache::positionKey(fen);
+  if (EngineCache::lookup(key, depth, response)) {
+    Serial.printf("Stockfish cache hit: %s\n", response.bestMove.c_str());
+    return true;
+  }
+
+  String path = buildRequestURL(fen, depth);
+  Serial.println("Stockfish request: " STOCKFISH_API_URL + path);
+  // Retry logic
+  for (int attempt = 1; attempt <= settings.maxRetries; attempt++) {
+    if (attempt > 1)
+      Serial.println("Attempt: " + String(attempt) + "/" + String(settings.maxRetries));
+    HttpResponseHead head;
+    WiFiClientSecure* client = exchange(path, depth, attempt, settings.timeoutMs, abort, head);
+    if (client) {
+      // Parse straight from the socket instead of buffering the reply
+      HttpBodyStream body(client, head, settings.timeoutMs, abort);
+      bool parsed = parseResponse(body, response);
+      HttpPool::release(client, body.finish() && head.keepAlive);
+      if (parsed) {
+        EngineCache::store(key, depth, response);
+        return true;
+      }
+      if (!body.failed()) {
+        Serial.printf("Failed to parse Stockfish response: %s\n", response.errorMessage.c_str());
+        return false;
+      }
+    }
+    if (abort && abort->load())
+      return false;
+
+    Serial.println("API request timeout or empty response");
+    if (attempt < settings.maxRetries) {
+      Serial.println("Retrying...");
+      delay(500);
+    }
+  }
+
+  Serial.println("All API request attempts failed");
+  return false;
+}
+
+unsigned long StockfishAPI::hedgeDelay(int depth) {
+  int row = clampDepth(depth) - STOCKFISH_MIN_DEPTH;
+  uint16_t values[STOCKFISH_HEDGE_LATENCY_SAMPLES];
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  int count = latencyCount[row];
+  bool budget = hedgeBudget >= 100;
+  memcpy(values, latencies[row], sizeof(values));
+  xSemaphoreGive(mutex);
+  if (count < STOCKFISH_HEDGE_MIN_SAMPLES || !budget)
+    return 0;
+  return max((unsigned long)NetTelemetry::percentile(values, count, 95), (unsigned long)STOCKFISH_HEDGE_MIN_DELAY_MS);
+}
+
+bool StockfishAPI::takeHedge() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  bool ok = hedgeBudget >= 100;
+  if (ok) {
+    hedgeBudget -= 100;
+    hedges++;
+  }
+  xSemaphoreGive(mutex);
+  return ok;
+}
+
+void StockfishAPI::recordLatency(int depth, unsigned long ms) {
+  int row = clampDepth(depth) - STOCKFISH_MIN_DEPTH;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  latencies[row][latencyNext[row]] = min(ms, 65535UL);
+  latencyNext[row] = (latencyNext[row] + 1) % STOCKFISH_HEDGE_LATENCY_SAMPLES;
+  if (latencyCount[row] < STOCKFISH_HEDGE_LATENCY_SAMPLES)
+    latencyCount[row]++;
+  xSemaphoreGive(mutex);
+}
+
+WiFiClientSecure* StockfishAPI::exchange(const String& path, int depth, int attempt, unsigned long timeoutMs, const std::atomic<bool>* abort, HttpResponseHead& head) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  requests++;
+  hedgeBudget = min(hedgeBudget + STOCKFISH_HEDGE_PERCENT, 300);
+  xSemaphoreGive(mutex);
+
+  WiFiClientSecure* primary = HttpPool::acquire(STOCKFISH_API_URL, STOCKFISH_API_PORT);
+  if (!primary)
+    return nullptr;
+  if (NetSample* trace = HttpPool::trace(primary))
+    trace->retries = attempt - 1;
+
+  WiFiClientSecure* winner = nullptr;
+  // Primary's time to first byte for the hedge statistics, or a lower bound when the hedge
+  // answered first or the primary was still waiting at the deadline. Not sampled when the
+  // primary failed outright (no WiFi, connect failure, closed socket): that says nothing
+  // about the server and would keep hedging off until the samples age out.
+  unsigned long primaryMs = timeoutMs;
+  bool sampled = false;
+  unsigned long delayMs = hedgeDelay(depth);
+  if (delayMs == 0) {
+    // Nothing to hedge against yet (or no budget left): plain request
+    if (HttpPool::sendRequest(primary, "GET", path, "", "", head, timeoutMs, abort))
+      winner = primary;
+    else
+      HttpPool::release(primary, false);
+  } else {
+    unsigned long deadline = millis() + timeoutMs;
+    bool reused = primary->connected();
+    unsigned long primarySentAt = millis();
+    if (!HttpPool::writeRequest(primary, "GET", path, "", "")) {
+      HttpPool::release(primary, false);
+      primary = nullptr;
+    }
+    unsigned long hedgeAt = millis() + delayMs;
+    WiFiClientSecure* hedge = nullptr;
+    bool hedged = false;
+    while (primary || hedge) {
+      if (primary && primary->available()) {
+        winner = primary;
+        break;
+      }
+      if (hedge && hedge->available()) {
+        winner = hedge;
+        // The primary would have taken at least this long
+        if (primary) {
+          primaryMs = millis() - primarySentAt;
+          sampled = true;
+        }
+        break;
+      }
+      if (abort && abort->load())
+        break;
+      if ((long)(deadline - millis()) <= 0) {
+        sampled = primary != nullptr;
+        break;
+      }
+      if (primary && !primary->connected()) {
+        // A keep-alive socket the server closed while idle: resend once on a fresh one
+        if (reused && !hedged && HttpPool::writeRequest(primary, "GET", path, "", "")) {
+          Serial.println("Stockfish: Idle connection was closed, resent request");
+          primarySentAt = millis();
+          hedgeAt = millis() + delayMs;
+        } else {
+          HttpPool::release(primary, false);
+          primary = nullptr;
+        }
+        reused = false;
+      }
+      if (hedge && !hedge->connected()) {
+        HttpPool::release(hedge, false);
+        hedge = nullptr;
+      }
+      if (!hedged && primary && (long)(millis() - hedgeAt) >= 0) {
+        hedged = true;
+        // Only a free slot is used; waiting for one would defeat the purpose
+        if (takeHedge() && (hedge = HttpPool::acquire(STOCKFISH_API_URL, STOCKFISH_API_PORT, 0)) != nullptr) {
+          Serial.printf("Stockfish: No reply after %lu ms, sending a hedged request\n", delayMs);
+          if (NetSample* trace = HttpPool::trace(hedge))
+            trace->retries = attempt - 1;
+          if (!HttpPool::writeRequest(hedge, "GET", path, "", "")) {
+            HttpPool::release(hedge, false);
+            hedge = nullptr;
+          }
+        }
+      }
+      delay(1);
+    }
+    // The other request is still outstanding on its socket: close it
+    if (primary && primary != winner)
+      HttpPool::release(primary, false);
+    if (hedge && hedge != winner)
+      HttpPool::release(hedge, false);
+    if (winner && !HttpPool::readHead(winner, head, max((long)(deadline - millis()), 1L), abort)) {
+      HttpPool::release(winner, false);
+      winner = nullptr;
+    }
+    if (winner && winner == hedge) {
+      xSemaphoreTake(mutex, portMAX_DELAY);
+      hedgeWins++;
+      xSemaphoreGive(mutex);
+      Serial.println("Stockfish: Hedged request answered first");
+    }
+  }
+
+  // Sample the primary whichever request answered, so the p95 that triggers hedging cannot drift low
+  if (winner && winner == primary) {
+    if (NetSample* trace = HttpPool::trace(winner)) {
+      primaryMs = trace->firstByteMs;
+      sampled = true;
+    }
+  }
+  if (sampled && !(abort && abort->load()))
+    recordLatency(depth, primaryMs);
+  return winner;
+}
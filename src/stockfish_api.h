@@ -1,13 +1,30 @@
 #ifndef STOCKFISH_API_H
 #define STOCKFISH_API_H
 
+#include "stockfish_settings.h"
 #include <ArduinoJson.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 // Stockfish API Endpoint
 #define STOCKFISH_API_URL "stockfish.online"
 #define STOCKFISH_API_PATH "/api/s/v2.php"
 #define STOCKFISH_API_PORT 443
 
+// Depths the API accepts
+#define STOCKFISH_MIN_DEPTH 5
+#define STOCKFISH_MAX_DEPTH 15
+// Request hedging: when no reply arrived within the p95 latency seen at that depth,
+// the same request is sent on a second connection and the first answer wins
+#define STOCKFISH_HEDGE_LATENCY_SAMPLES 16 // Latencies kept per depth
+#define STOCKFISH_HEDGE_MIN_SAMPLES 8      // Needed at a depth before hedging there
+#define STOCKFISH_HEDGE_MIN_DELAY_MS 500
+#define STOCKFISH_HEDGE_PERCENT 10 // At most this share of requests is hedged (3 can be banked)
+
+class WiFiClientSecure;
+struct HttpResponseHead;
+
 // Struct to hold parsed Stockfish API response
 struct StockfishResponse {
   bool success;
@@ -22,12 +39,47 @@ struct StockfishResponse {
 
 class StockfishAPI {
  public:
-  // Parse JSON response from Stockfish API
+  // Create the lock guarding the hedging statistics; called from setup()
+  static void begin();
+
+  // Parse a JSON response body from the Stockfish API as it arrives
   // Returns true if parsing was successful
-  static bool parseResponse(const String& jsonString, StockfishResponse& response);
+  static bool parseResponse(Stream& body, StockfishResponse& response);
+
+  // Limit a requested depth to what the API accepts
+  static int clampDepth(int depth);
 
   // Build the API request URL
   static String buildRequestURL(const String& fen, int depth);
+
+  // Request and parse an evaluation, retrying up to settings.maxRetries times.
+  // Answers are served from and stored in EngineCache. Settings selecting the LAN
+  // backend are handed to UciEngine instead (not cached: its strength is set there).
+  // Returns false if every attempt failed, the response was invalid or *abort was set.
+  static bool fetch(const String& fen, const StockfishSettings& settings, StockfishResponse& response, const std::atomic<bool>* abort = nullptr);
+
+  // Hedging statistics since boot
+  static uint32_t getRequests() { return requests; }
+  static uint32_t getHedges() { return hedges; }
+  static uint32_t getHedgeWins() { return hedgeWins; }
+
+ private:
+  static uint16_t latencies[STOCKFISH_MAX_DEPTH - STOCKFISH_MIN_DEPTH + 1][STOCKFISH_HEDGE_LATENCY_SAMPLES];
+  static uint8_t latencyCount[STOCKFISH_MAX_DEPTH - STOCKFISH_MIN_DEPTH + 1];
+  static uint8_t latencyNext[STOCKFISH_MAX_DEPTH - STOCKFISH_MIN_DEPTH + 1];
+  static int hedgeBudget; // In hundredths of a hedge
+  static uint32_t requests;
+  static uint32_t hedges;
+  static uint32_t hedgeWins;
+  static SemaphoreHandle_t mutex;
+
+  // Send one request, hedging it if it is slow. Returns the connection whose response
+  // head was read (release it after the body), or nullptr with every connection released.
+  static WiFiClientSecure* exchange(const String& path, int depth, int attempt, unsigned long timeoutMs, const std::atomic<bool>* abort, HttpResponseHead& head);
+  // How long to wait before hedging at this depth, 0 = do not hedge
+  static unsigned long hedgeDelay(int depth);
+  static bool takeHedge();
+  static void recordLatency(int depth, unsigned long ms);
 };
 
 #endif // STOCKFISH_API_H
@@ -1,13 +1,22 @@
 #ifndef STOCKFISH_SETTINGS_H
 #define STOCKFISH_SETTINGS_H
 
+#include <stdint.h>
+
+// Where engine requests go
+enum class EngineBackend : uint8_t {
+  CLOUD, // stockfish.online API
+  UCI    // UCI engine on the LAN (see UciEngine)
+};
+
 // Stockfish Engine Settings
 struct StockfishSettings {
-  int depth;      // Search depth (5-15, higher = stronger but slower)
-  int timeoutMs;  // API timeout in milliseconds
-  int maxRetries; // Max API call retries on failure
+  int depth;             // Search depth (5-15, higher = stronger but slower)
+  int timeoutMs;         // API timeout in milliseconds
+  int maxRetries;        // Max API call retries on failure
+  EngineBackend backend; // Cloud API or LAN engine
 
-  StockfishSettings(int depth = 5, int timeoutMs = 60000, int maxRetries = 3) : depth(depth), timeoutMs(timeoutMs), maxRetries(maxRetries) {}
+  StockfishSettings(int depth = 5, int timeoutMs = 60000, int maxRetries = 3) : depth(depth), timeoutMs(timeoutMs), maxRetries(maxRetries), backend(EngineBackend::CLOUD) {}
 
   // Difficulty presets
   static StockfishSettings easy() { return {5, 15000}; }
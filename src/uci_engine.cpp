@@ -0,0 +1,174 @@
+#include "uci_engine.h"
+
+WiFiClient UciEngine::client;
+char UciEngine::host[64] = "";
+uint16_t UciEngine::port = UCI_ENGINE_DEFAULT_PORT;
+int UciEngine::moveTimeMs = 0;
+SemaphoreHandle_t UciEngine::mutex = nullptr;
+
+void UciEngine::begin() {
+  if (!mutex)
+    mutex = xSemaphoreCreateMutex();
+}
+
+void UciEngine::configure(const String& newHost, uint16_t newPort, int newMoveTimeMs) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  if (newHost != host || newPort != port) {
+    client.stop();
+    strlcpy(host, newHost.c_str(), sizeof(host));
+    port = newPort;
+  }
+  moveTimeMs = max(newMoveTimeMs, 0);
+  xSemaphoreGive(mutex);
+}
+
+bool UciEngine::isConfigured() {
+  return host[0] != '\0';
+}
+
+void UciEngine::send(const String& command) {
+  client.print(command + "\n");
+}
+
+bool UciEngine::readLine(String& line, unsigned long deadline, const std::atomic<bool>* abort) {
+  line = "";
+  while ((long)(deadline - millis()) > 0) {
+    if (abort && abort->load())
+      return false;
+    if (!client.available()) {
+      if (!client.connected())
+        return false;
+      delay(1);
+      continue;
+    }
+    char c = client.read();
+    if (c == '\n') {
+      if (line.endsWith("\r"))
+        line.remove(line.length() - 1);
+      return true;
+    }
+    line += c;
+  }
+  return false;
+}
+
+bool UciEngine::waitFor(const char* prefix, unsigned long deadline) {
+  String line;
+  while (readLine(line, deadline, nullptr))
+    if (line.startsWith(prefix))
+      return true;
+  return false;
+}
+
+bool UciEngine::ensureConnected(unsigned long deadline) {
+  if (client.connected())
+    return true;
+  client.stop();
+  unsigned long start = millis();
+  if (!client.connect(host, port, UCI_ENGINE_CONNECT_TIMEOUT_MS)) {
+    Serial.printf("UCI engine: Connection to %s:%u failed\n", host, port);
+    return false;
+  }
+  client.setNoDelay(true);
+  send("uci");
+  bool ready = waitFor("uciok", deadline);
+  if (ready) {
+    send("isready");
+    ready = waitFor("readyok", deadline);
+  }
+  if (!ready) {
+    Serial.println("UCI engine: No uciok/readyok handshake");
+    client.stop();
+    return false;
+  }
+  Serial.printf("UCI engine: Connected to %s:%u in %lu ms\n", host, port, millis() - start);
+  return true;
+}
+
+void UciEngine::parseInfo(const String& line, StockfishResponse& response) {
+  // Only the main line carries the score we report
+  int multipv = line.indexOf(" multipv ");
+  if (multipv >= 0 && line.substring(multipv + 9).toInt() != 1)
+    return;
+  int cp = line.indexOf(" score cp ");
+  int mate = line.indexOf(" score mate ");
+  if (cp >= 0) {
+    response.evaluation = line.substring(cp + 10).toInt() / 100.0f;
+    response.hasMate = false;
+    response.mateInMoves = 0;
+  } else if (mate >= 0) {
+    response.mateInMoves = line.substring(mate + 12).toInt();
+    response.hasMate = true;
+    response.evaluation = 0.0f;
+  }
+}
+
+void UciEngine::parseBestMove(const String& line, StockfishResponse& response) {
+  // Format: "bestmove e2e4 ponder e7e5", or "bestmove (none)" when there is no legal move
+  int moveStart = 9; // length of "bestmove "
+  int moveEnd = line.indexOf(' ', moveStart);
+  response.bestMove = moveEnd < 0 ? line.substring(moveStart) : line.substring(moveStart, moveEnd);
+  response.bestMove.trim();
+  if (response.bestMove == "(none)")
+    response.bestMove = "";
+  int ponderStart = line.indexOf(" ponder ");
+  if (ponderStart >= 0) {
+    response.ponderMove = line.substring(ponderStart + 8);
+    response.ponderMove.trim();
+  }
+}
+
+bool UciEngine::fetch(const String& fen, const StockfishSettings& settings, StockfishResponse& response, const std::atomic<bool>* abort) {
+  response = StockfishResponse();
+  if (!isConfigured()) {
+    response.errorMessage = "No LAN engine configured";
+    return false;
+  }
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  unsigned long deadline = millis() + settings.timeoutMs;
+  bool gotBestMove = false;
+  String line;
+  for (int attempt = 0; attempt < 2; attempt++) {
+    bool reused = client.connected();
+    if (!ensureConnected(deadline))
+      break;
+    send("position fen " + fen);
+    send(moveTimeMs > 0 ? "go movetime " + String(moveTimeMs) : "go depth " + String(settings.depth));
+    bool anyOutput = false;
+    while (readLine(line, deadline, abort)) {
+      anyOutput = true;
+      if (line.startsWith("info "))
+        parseInfo(line, response);
+      else if (line.startsWith("bestmove")) {
+        parseBestMove(line, response);
+        gotBestMove = true;
+        break;
+      }
+    }
+    // A connection the bridge closed while idle only shows up once used: retry once on a fresh one
+    if (gotBestMove || anyOutput || !reused || client.connected())
+      break;
+    Serial.println("UCI engine: Idle connection was closed, reconnecting");
+  }
+
+  if (!gotBestMove && client.connected()) {
+    // Aborted or timed out: stop the search and consume its bestmove so the next request starts clean
+    send("stop");
+    if (!waitFor("bestmove", millis() + UCI_ENGINE_STOP_GRACE_MS))
+      client.stop();
+  }
+  xSemaphoreGive(mutex);
+
+  if (!gotBestMove || response.bestMove.length() == 0) {
+    response.errorMessage = gotBestMove ? "No legal move" : "No bestmove from LAN engine";
+    return false;
+  }
+  // UCI scores are from the side to move; StockfishResponse is from White's view
+  if (fen.indexOf(" b ") > 0) {
+    response.evaluation = -response.evaluation;
+    response.mateInMoves = -response.mateInMoves;
+  }
+  response.success = true;
+  return true;
+}
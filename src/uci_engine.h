@@ -0,0 +1,48 @@
+#ifndef UCI_ENGINE_H
+#define UCI_ENGINE_H
+
+#include "stockfish_api.h"
+#include "stockfish_settings.h"
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define UCI_ENGINE_DEFAULT_PORT 4000
+#define UCI_ENGINE_CONNECT_TIMEOUT_MS 3000
+// How long to wait for bestmove after sending stop before dropping the connection
+#define UCI_ENGINE_STOP_GRACE_MS 2000
+
+// UCI engine on the LAN, reached over plain TCP (see tools/uci_tcp_bridge.py).
+// One connection is kept open across moves; requests are serialized on it.
+class UciEngine {
+ public:
+  // Create the connection lock; called from setup() before the settings are loaded
+  static void begin();
+
+  // Engine address and search limit. moveTimeMs = 0 searches to settings.depth instead.
+  // An open connection to a different address is dropped.
+  static void configure(const String& host, uint16_t port, int moveTimeMs);
+  static bool isConfigured();
+
+  // Search a position and fill response like StockfishAPI (evaluation from White's view).
+  // On *abort or timeout the engine is sent "stop". Returns false if no bestmove arrived.
+  static bool fetch(const String& fen, const StockfishSettings& settings, StockfishResponse& response, const std::atomic<bool>* abort = nullptr);
+
+ private:
+  static WiFiClient client;
+  static char host[64];
+  static uint16_t port;
+  static int moveTimeMs;
+  static SemaphoreHandle_t mutex;
+
+  static bool ensureConnected(unsigned long deadline);
+  static void send(const String& command);
+  static bool readLine(String& line, unsigned long deadline, const std::atomic<bool>* abort);
+  static bool waitFor(const char* prefix, unsigned long deadline);
+  static void parseInfo(const String& line, StockfishResponse& response);
+  static void parseBestMove(const String& line, StockfishResponse& response);
+};
+
+#endif // UCI_ENGINE_H
@@ -91,11 +91,30 @@ void sendStateUpdate(const String& fen, const String& lastMove) {
   sendSimple(payload);
 }
 
+void sendLegalMoves(const uint64_t masks[64]) {
+  String payload = "MOVES|";
+  bool first = true;
+  for (int sq = 0; sq < 64; sq++) {
+    if (!masks[sq]) continue;
+    char entry[24];
+    snprintf(entry, sizeof(entry), "%s%c%d=%08lx%08lx", first ? "" : ";", 'a' + sq % 8, 8 - sq / 8, (unsigned long)(masks[sq] >> 32), (unsigned long)(masks[sq] & 0xFFFFFFFF));
+    payload += entry;
+    first = false;
+  }
+  sendSimple(payload);
+}
+
 void sendHintResponse(const String& san) {
   String payload = "HINT|move=" + san;
   sendSimple(payload);
 }
 
+void sendClock(long whiteMs, long blackMs, char activeColor, bool running) {
+  char payload[64];
+  snprintf(payload, sizeof(payload), "TIME|w=%ld;b=%ld;active=%c;run=%d", whiteMs, blackMs, activeColor, running ? 1 : 0);
+  sendSimple(payload);
+}
+
 void sendMode(int mode) {
   sendSimple("MODE|value=" + String(mode));
 }
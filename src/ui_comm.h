@@ -14,7 +14,11 @@ void setTouchHandler(ui_touch_handler_t h);
 
 // Outgoing messages
 void sendStateUpdate(const String& fen, const String& lastMove);
+// Legal destination masks per origin square (bit row * 8 + col), only non-empty origins are sent
+void sendLegalMoves(const uint64_t masks[64]);
 void sendHintResponse(const String& san);
+// Remaining clock times (ms) with the side whose clock runs; the UI counts down between updates
+void sendClock(long whiteMs, long blackMs, char activeColor, bool running);
 void sendMode(int mode);
 void sendSimple(const String& msg);
 } // namespace UIComm
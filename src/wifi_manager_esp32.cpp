@@ -1,7 +1,14 @@
 #include "wifi_manager_esp32.h"
 #include "chess_lichess.h"
 #include "chess_utils.h"
+#include "engine_cache.h"
+#include "game_analyzer.h"
+#include "lichess_games.h"
+#include "lichess_move_sender.h"
+#include "lichess_scheduler.h"
 #include "move_history.h"
+#include "net_telemetry.h"
+#include "uci_engine.h"
 #include "version.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
@@ -10,8 +17,9 @@
 
 static const char* INITIAL_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
 
-WiFiManagerESP32::WiFiManagerESP32(BoardDriver* bd, MoveHistory* mh) : boardDriver(bd), moveHistory(mh), server(AP_PORT), wifiSSID(SECRET_SSID), wifiPassword(SECRET_PASS), gameMode("0"), lichessToken(""), botConfig(), scanAllChannels(WIFI_SCAN_ALL_CHANNELS), currentFen(INITIAL_FEN), hasPendingEdit(false), hasPendingResign(false), hasPendingDraw(false), pendingResignColor('?'), promotion{}, lastBoardPollTime(0), hasPendingWiFi(false), boardEvaluation(0.0f), otaUpdater(bd), autoOtaEnabled(false) {
+WiFiManagerESP32::WiFiManagerESP32(BoardDriver* bd, MoveHistory* mh) : boardDriver(bd), moveHistory(mh), server(AP_PORT), wifiSSID(SECRET_SSID), wifiPassword(SECRET_PASS), gameMode("0"), lichessToken(""), spectateTarget("tv"), botConfig(), scanAllChannels(WIFI_SCAN_ALL_CHANNELS), enginePort(UCI_ENGINE_DEFAULT_PORT), engineMoveTimeMs(0), engineBackend(EngineBackend::CLOUD), analysisDepth(10), analysisBackend(EngineBackend::CLOUD), analysisAuto(true), currentFen(INITIAL_FEN), hasPendingEdit(false), hasPendingResign(false), hasPendingDraw(false), pendingResignColor('?'), promotion{}, lastBoardPollTime(0), hasPendingWiFi(false), boardEvaluation(0.0f), repetitionWarning(false), otaUpdater(bd), autoOtaEnabled(false) {
   promotion.reset();
+  memset(legalMoveMasks, 0, sizeof(legalMoveMasks));
 }
 
 void WiFiManagerESP32::begin() {
@@ -38,11 +46,31 @@ void WiFiManagerESP32::begin() {
       Serial.println("Lichess API token loaded from NVS");
     }
 
+    // Load LAN engine settings
+    prefs.begin("engine", false);
+    engineHost = prefs.getString("host", "");
+    enginePort = prefs.getUShort("port", UCI_ENGINE_DEFAULT_PORT);
+    engineMoveTimeMs = prefs.getInt("moveTime", 0);
+    engineBackend = (EngineBackend)prefs.getUChar("backend", (uint8_t)EngineBackend::CLOUD);
+    prefs.end();
+    UciEngine::configure(engineHost, enginePort, engineMoveTimeMs);
+    botConfig.stockfishSettings.backend = engineBackend;
+
+    // Load post-game analysis settings
+    prefs.begin("analysis", false);
+    analysisDepth = prefs.getInt("depth", 10);
+    analysisBackend = (EngineBackend)prefs.getUChar("backend", (uint8_t)EngineBackend::CLOUD);
+    analysisAuto = prefs.getBool("auto", true);
+    prefs.end();
+
     // Load OTA auto-update preference
     prefs.begin("ota", false);
     autoOtaEnabled = prefs.getBool("autoUpdate", false);
     prefs.end();
   }
+  StockfishSettings analysisSettings(analysisDepth, 30000, 2);
+  analysisSettings.backend = analysisBackend;
+  GameAnalyzer::configure(analysisSettings, analysisAuto);
   if (!WiFi.softAP(AP_SSID, AP_PASSWORD)) {
     Serial.println("ERROR: Failed to create Access Point!");
     return;
@@ -78,11 +106,19 @@ void WiFiManagerESP32::begin() {
   server.on("/gameselect", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleGameSelection(request); });
   server.on("/lichess", HTTP_GET, [this](AsyncWebServerRequest* request) { request->send(200, "application/json", this->getLichessInfoJSON()); });
   server.on("/lichess", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleSaveLichessToken(request); });
+  server.on("/lichess-games", HTTP_GET, [](AsyncWebServerRequest* request) { request->send(200, "application/json", LichessGames::toJSON()); });
+  server.on("/lichess-games", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleSwitchLichessGame(request); });
   server.on("/board-settings", HTTP_GET, [this](AsyncWebServerRequest* request) { request->send(200, "application/json", this->getBoardSettingsJSON()); });
   server.on("/board-settings", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleBoardSettings(request); });
+  server.on("/engine-settings", HTTP_GET, [this](AsyncWebServerRequest* request) { request->send(200, "application/json", this->getEngineSettingsJSON()); });
+  server.on("/engine-settings", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleEngineSettings(request); });
   server.on("/board-calibrate", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleBoardCalibration(request); });
   server.on("/games", HTTP_GET, [this](AsyncWebServerRequest* request) { this->handleGamesRequest(request); });
   server.on("/games", HTTP_DELETE, [this](AsyncWebServerRequest* request) { this->handleDeleteGame(request); });
+  server.on("/analysis", HTTP_GET, [this](AsyncWebServerRequest* request) { this->handleAnalysisRequest(request); });
+  server.on("/analysis", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleAnalyzeGame(request); });
+  server.on("/analysis-settings", HTTP_GET, [this](AsyncWebServerRequest* request) { request->send(200, "application/json", this->getAnalysisSettingsJSON()); });
+  server.on("/analysis-settings", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleAnalysisSettings(request); });
   // OTA update endpoints
   server.on("/ota/status", HTTP_GET, [this](AsyncWebServerRequest* request) { this->handleOtaStatus(request); });
   server.on("/ota/settings", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleOtaSettings(request); });
@@ -100,6 +136,7 @@ void WiFiManagerESP32::begin() {
       NULL,
       [this](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) { this->onWebAssetsUploadBody(request, data, len, index, total); });
   // Hardware configuration endpoints
+  server.on("/diagnostics", HTTP_GET, [this](AsyncWebServerRequest* request) { request->send(200, "application/json", this->getDiagnosticsJSON()); });
   server.on("/hardware-config", HTTP_GET, [this](AsyncWebServerRequest* request) { this->getHardwareConfigJSON(request); });
   server.on("/hardware-config", HTTP_POST, [this](AsyncWebServerRequest* request) { this->handleHardwareConfig(request); });
   // Serve sound files directly (no gzip variant exists, avoids .gz probe errors)
@@ -118,6 +155,17 @@ String WiFiManagerESP32::getBoardUpdateJSON() {
   JsonDocument doc;
   doc["fen"] = currentFen;
   doc["evaluation"] = serialized(String(boardEvaluation, 2));
+  if (repetitionWarning)
+    doc["repetition"] = true;
+  // Legal destinations as hex bitmasks keyed by origin square (bit = row * 8 + col, row 0 = rank 8)
+  JsonObject legal = doc["legalMoves"].to<JsonObject>();
+  for (int sq = 0; sq < 64; sq++) {
+    if (!legalMoveMasks[sq]) continue;
+    char square[3] = {(char)('a' + sq % 8), (char)('8' - sq / 8), '\0'};
+    char mask[17];
+    snprintf(mask, sizeof(mask), "%08lx%08lx", (unsigned long)(legalMoveMasks[sq] >> 32), (unsigned long)(legalMoveMasks[sq] & 0xFFFFFFFF));
+    legal[square] = mask;
+  }
   if (promotion.pending) {
     JsonObject promo = doc["promotion"].to<JsonObject>();
     promo["color"] = String(promotion.color);
@@ -127,6 +175,65 @@ String WiFiManagerESP32::getBoardUpdateJSON() {
   return output;
 }
 
+String WiFiManagerESP32::getDiagnosticsJSON() {
+  JsonDocument doc;
+  JsonObject ponder = doc["ponder"].to<JsonObject>();
+  uint32_t hits = ChessBot::getPonderHits();
+  uint32_t total = hits + ChessBot::getPonderMisses();
+  ponder["hits"] = hits;
+  ponder["predictions"] = total;
+  ponder["hitRate"] = serialized(String(total ? (float)hits / total : 0.0f, 2));
+  JsonObject cache = doc["engineCache"].to<JsonObject>();
+  uint32_t ramHits = EngineCache::getRamHits();
+  uint32_t fileHits = EngineCache::getFileHits();
+  uint32_t lookups = ramHits + fileHits + EngineCache::getMisses();
+  cache["ramHits"] = ramHits;
+  cache["fileHits"] = fileHits;
+  cache["lookups"] = lookups;
+  cache["hitRate"] = serialized(String(lookups ? (float)(ramHits + fileHits) / lookups : 0.0f, 2));
+  cache["ramBytes"] = sizeof(EngineCacheRecord) * ENGINE_CACHE_RAM_ENTRIES;
+  cache["fileBytes"] = EngineCache::getFileBytes();
+  JsonObject hedging = doc["stockfishHedging"].to<JsonObject>();
+  uint32_t requests = StockfishAPI::getRequests();
+  uint32_t hedges = StockfishAPI::getHedges();
+  hedging["requests"] = requests;
+  hedging["hedges"] = hedges;
+  hedging["hedgeWins"] = StockfishAPI::getHedgeWins();
+  hedging["hedgeRate"] = serialized(String(requests ? (float)hedges / requests : 0.0f, 2));
+  JsonObject lichessMoves = doc["lichessMoves"].to<JsonObject>();
+  lichessMoves["queued"] = LichessMoveSender::getQueueDepth();
+  lichessMoves["lastLatencyMs"] = LichessMoveSender::getLastLatencyMs();
+  lichessMoves["sent"] = LichessMoveSender::getSentCount();
+  lichessMoves["failed"] = LichessMoveSender::getFailedCount();
+  JsonObject lichessRateLimit = doc["lichessRateLimit"].to<JsonObject>();
+  lichessRateLimit["cooldownMs"] = LichessScheduler::getCooldownRemainingMs();
+  lichessRateLimit["rateLimited"] = LichessScheduler::getRateLimitedCount();
+  // Per-endpoint request timings (ms) over the most recent requests
+  JsonObject network = doc["network"].to<JsonObject>();
+  for (int i = 0; i < (int)NetEndpoint::COUNT; i++) {
+    NetEndpointStats stats;
+    NetTelemetry::getStats((NetEndpoint)i, stats);
+    JsonObject ep = network[NetTelemetry::endpointName((NetEndpoint)i)].to<JsonObject>();
+    ep["requests"] = stats.requests;
+    ep["errors"] = stats.errors;
+    ep["retries"] = stats.retries;
+    ep["samples"] = stats.samples;
+    ep["connects"] = stats.connects;
+    ep["bytes"] = stats.bytes;
+    const NetPercentiles* phases[] = {&stats.dns, &stats.connect, &stats.send, &stats.firstByte, &stats.total};
+    const char* names[] = {"dns", "connect", "send", "firstByte", "total"};
+    for (int p = 0; p < 5; p++) {
+      JsonObject phase = ep[names[p]].to<JsonObject>();
+      phase["p50"] = phases[p]->p50;
+      phase["p95"] = phases[p]->p95;
+      phase["p99"] = phases[p]->p99;
+    }
+  }
+  String output;
+  serializeJson(doc, output);
+  return output;
+}
+
 String WiFiManagerESP32::getWiFiInfoJSON() {
   JsonDocument doc;
   doc["ssid"] = wifiSSID;
@@ -153,6 +260,19 @@ void WiFiManagerESP32::handleBoardEditSuccess(AsyncWebServerRequest* request) {
   }
 }
 
+void WiFiManagerESP32::handleSwitchLichessGame(AsyncWebServerRequest* request) {
+  if (!request->hasArg("id")) {
+    request->send(400, "text/plain", "Missing 'id' parameter");
+    return;
+  }
+  String gameId = request->arg("id");
+  // Taken by the Lichess mode on its next loop
+  if (LichessGames::requestSwitch(gameId))
+    request->send(202, "text/plain", "Switching");
+  else
+    request->send(404, "text/plain", "Unknown game");
+}
+
 void WiFiManagerESP32::handleResign(AsyncWebServerRequest* request) {
   if (request->hasArg("color")) {
     String color = request->arg("color");
@@ -217,7 +337,6 @@ void WiFiManagerESP32::handleGameSelection(AsyncWebServerRequest* request) {
   int mode = 0;
   if (request->hasArg("gamemode"))
     mode = request->arg("gamemode").toInt();
-  gameMode = String(mode);
   // If bot game mode, also handle bot config
   if (mode == 2) {
     if (request->hasArg("difficulty") && request->hasArg("playerColor")) {
@@ -239,7 +358,21 @@ void WiFiManagerESP32::handleGameSelection(AsyncWebServerRequest* request) {
           break;
       }
       botConfig.playerIsWhite = request->arg("playerColor") == "white";
-      Serial.printf("Bot configuration received: Depth=%d, Player is %s\n", botConfig.stockfishSettings.depth, botConfig.playerIsWhite ? "White" : "Black");
+      if (request->hasArg("engine")) {
+        EngineBackend backend = request->arg("engine") == "lan" ? EngineBackend::UCI : EngineBackend::CLOUD;
+        if (backend == EngineBackend::UCI && engineHost.length() == 0) {
+          request->send(400, "text/plain", "No LAN engine configured");
+          return;
+        }
+        if (backend != engineBackend && ChessUtils::ensureNvsInitialized()) {
+          prefs.begin("engine", false);
+          prefs.putUChar("backend", (uint8_t)backend);
+          prefs.end();
+        }
+        engineBackend = backend;
+      }
+      botConfig.stockfishSettings.backend = engineBackend;
+      Serial.printf("Bot configuration received: Depth=%d, Player is %s, Engine: %s\n", botConfig.stockfishSettings.depth, botConfig.playerIsWhite ? "White" : "Black", engineBackend == EngineBackend::UCI ? "LAN" : "Cloud");
     } else {
       request->send(400, "text/plain", "Missing bot parameters");
       return;
@@ -253,6 +386,31 @@ void WiFiManagerESP32::handleGameSelection(AsyncWebServerRequest* request) {
     }
     Serial.println("Lichess mode selected via web");
   }
+  // Spectate mode follows the featured TV game or one game id (8 characters, longer player ids are cut)
+  if (mode == 5) {
+    String target = request->hasArg("target") ? request->arg("target") : "tv";
+    target.trim();
+    int slash = target.lastIndexOf('/');
+    if (slash >= 0)
+      target = target.substring(slash + 1); // Accept a pasted game URL
+    if (target.length() == 0)
+      target = "tv";
+    bool valid = target == "tv" || target.length() >= 8;
+    if (target != "tv") {
+      target = target.substring(0, 8);
+      for (size_t i = 0; i < target.length(); i++)
+        if (!isalnum(target[i]))
+          valid = false;
+    }
+    if (!valid) {
+      request->send(400, "text/plain", "Invalid Lichess game id");
+      return;
+    }
+    spectateTarget = target;
+    Serial.println("Spectate mode selected via web: " + spectateTarget);
+  }
+  // Only publish the mode once its parameters are valid, the main loop picks it up right away
+  gameMode = String(mode);
   Serial.println("Game mode selected via web: " + gameMode);
   request->send(200, "text/plain", "OK");
 }
@@ -340,6 +498,93 @@ void WiFiManagerESP32::handleBoardSettings(AsyncWebServerRequest* request) {
   }
 }
 
+String WiFiManagerESP32::getEngineSettingsJSON() {
+  JsonDocument doc;
+  doc["host"] = engineHost;
+  doc["port"] = enginePort;
+  doc["moveTimeMs"] = engineMoveTimeMs;
+  doc["backend"] = engineBackend == EngineBackend::UCI ? "lan" : "cloud";
+  String output;
+  serializeJson(doc, output);
+  return output;
+}
+
+void WiFiManagerESP32::handleEngineSettings(AsyncWebServerRequest* request) {
+  if (!request->hasArg("host")) {
+    request->send(400, "text/plain", "Missing host parameter");
+    return;
+  }
+  String host = request->arg("host");
+  host.trim();
+  int port = request->hasArg("port") ? request->arg("port").toInt() : UCI_ENGINE_DEFAULT_PORT;
+  int moveTimeMs = request->hasArg("moveTimeMs") ? request->arg("moveTimeMs").toInt() : 0;
+  if (host.length() >= 64 || port <= 0 || port > 65535 || moveTimeMs < 0) {
+    request->send(400, "text/plain", "Invalid engine settings");
+    return;
+  }
+
+  if (!ChessUtils::ensureNvsInitialized()) {
+    request->send(500, "text/plain", "NVS init failed");
+    return;
+  }
+  prefs.begin("engine", false);
+  prefs.putString("host", host);
+  prefs.putUShort("port", port);
+  prefs.putInt("moveTime", moveTimeMs);
+  if (host.length() == 0) {
+    // Without an engine address bot games fall back to the cloud API
+    engineBackend = EngineBackend::CLOUD;
+    prefs.putUChar("backend", (uint8_t)engineBackend);
+  }
+  prefs.end();
+
+  engineHost = host;
+  enginePort = port;
+  engineMoveTimeMs = moveTimeMs;
+  UciEngine::configure(engineHost, enginePort, engineMoveTimeMs);
+  Serial.printf("LAN engine set to %s:%d (move time %d ms)\n", engineHost.c_str(), enginePort, engineMoveTimeMs);
+  request->send(200, "text/plain", "OK");
+}
+
+String WiFiManagerESP32::getAnalysisSettingsJSON() {
+  JsonDocument doc;
+  doc["depth"] = analysisDepth;
+  doc["engine"] = analysisBackend == EngineBackend::UCI ? "lan" : "cloud";
+  doc["auto"] = analysisAuto;
+  String output;
+  serializeJson(doc, output);
+  return output;
+}
+
+void WiFiManagerESP32::handleAnalysisSettings(AsyncWebServerRequest* request) {
+  int depth = request->hasArg("depth") ? request->arg("depth").toInt() : analysisDepth;
+  if (depth < 1 || depth > 20) {
+    request->send(400, "text/plain", "Invalid depth");
+    return;
+  }
+  if (request->hasArg("engine"))
+    analysisBackend = request->arg("engine") == "lan" ? EngineBackend::UCI : EngineBackend::CLOUD;
+  if (request->hasArg("auto"))
+    analysisAuto = request->arg("auto") == "1" || request->arg("auto") == "true";
+  analysisDepth = depth;
+
+  if (!ChessUtils::ensureNvsInitialized()) {
+    request->send(500, "text/plain", "NVS init failed");
+    return;
+  }
+  prefs.begin("analysis", false);
+  prefs.putInt("depth", analysisDepth);
+  prefs.putUChar("backend", (uint8_t)analysisBackend);
+  prefs.putBool("auto", analysisAuto);
+  prefs.end();
+
+  StockfishSettings analysisSettings(analysisDepth, 30000, 2);
+  analysisSettings.backend = analysisBackend;
+  GameAnalyzer::configure(analysisSettings, analysisAuto);
+  Serial.printf("Game analysis set to depth %d on %s engine (auto %s)\n", analysisDepth, analysisBackend == EngineBackend::UCI ? "LAN" : "cloud", analysisAuto ? "on" : "off");
+  request->send(200, "text/plain", "OK");
+}
+
 void WiFiManagerESP32::handleBoardCalibration(AsyncWebServerRequest* request) {
   boardDriver->triggerCalibration();
   request->send(200, "text/plain", "Calibration will start on next reboot");
@@ -600,6 +845,35 @@ void WiFiManagerESP32::handleDeleteGame(AsyncWebServerRequest* request) {
     request->send(404, "text/plain", "Game not found");
 }
 
+void WiFiManagerESP32::handleAnalysisRequest(AsyncWebServerRequest* request) {
+  // GET /analysis?id=N — evaluations recorded so far
+  int id = request->hasArg("id") ? request->arg("id").toInt() : 0;
+  if (id <= 0) {
+    request->send(400, "text/plain", "Invalid game id");
+    return;
+  }
+  String json = GameAnalyzer::getAnalysisJSON(id);
+  if (json.length() == 0)
+    request->send(404, "text/plain", "No analysis");
+  else
+    request->send(200, "application/json", json);
+}
+
+void WiFiManagerESP32::handleAnalyzeGame(AsyncWebServerRequest* request) {
+  // POST /analysis?id=N — queue game N for analysis (picked up by the main loop)
+  int id = request->hasArg("id") ? request->arg("id").toInt() : 0;
+  if (id <= 0) {
+    request->send(400, "text/plain", "Invalid game id");
+    return;
+  }
+  if (!MoveHistory::quietExists(MoveHistory::gamePath(id).c_str())) {
+    request->send(404, "text/plain", "Game not found");
+    return;
+  }
+  GameAnalyzer::request(id);
+  request->send(202, "text/plain", "Queued");
+}
+
 // ========== OTA Update Handlers ==========
 
 void WiFiManagerESP32::handleOtaStatus(AsyncWebServerRequest* request) {
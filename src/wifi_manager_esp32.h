@@ -41,14 +41,27 @@ class WiFiManagerESP32 {
   String wifiPassword;
   String gameMode;
   String lichessToken;
+  String spectateTarget; // Lichess game id or "tv"
 
   BotConfig botConfig = {StockfishSettings::medium(), true};
   bool scanAllChannels;
 
+  // LAN UCI engine (see UciEngine), persisted in NVS
+  String engineHost;
+  uint16_t enginePort;
+  int engineMoveTimeMs;        // 0 = search to the difficulty's depth
+  EngineBackend engineBackend; // Backend chosen for bot games
+  // Post-game analysis
+  int analysisDepth;
+  EngineBackend analysisBackend;
+  bool analysisAuto; // Analyze every finished game
+
   MoveHistory* moveHistory;
   BoardDriver* boardDriver;
   String currentFen;
   float boardEvaluation;
+  bool repetitionWarning; // A legal move of the side to move repeats an earlier position
+  uint64_t legalMoveMasks[64]; // Legal destinations per origin square for the side to move
 
   // Board edit storage (pending edits from web interface)
   String pendingFenEdit;
@@ -83,16 +96,24 @@ class WiFiManagerESP32 {
   // Web interface methods
   String getWiFiInfoJSON();
   String getBoardUpdateJSON();
+  String getDiagnosticsJSON(); // Engine and network statistics
   String getLichessInfoJSON();
   String getBoardSettingsJSON();
+  String getEngineSettingsJSON();
+  String getAnalysisSettingsJSON();
   void handleBoardEditSuccess(AsyncWebServerRequest* request);
   void handlePromotion(AsyncWebServerRequest* request);
   void handleConnectWiFi(AsyncWebServerRequest* request);
   void handleGameSelection(AsyncWebServerRequest* request);
   void handleSaveLichessToken(AsyncWebServerRequest* request);
   void handleBoardSettings(AsyncWebServerRequest* request);
+  void handleEngineSettings(AsyncWebServerRequest* request);
+  void handleAnalysisSettings(AsyncWebServerRequest* request);
+  void handleAnalysisRequest(AsyncWebServerRequest* request);
+  void handleAnalyzeGame(AsyncWebServerRequest* request);
   void handleBoardCalibration(AsyncWebServerRequest* request);
   void handleResign(AsyncWebServerRequest* request);
+  void handleSwitchLichessGame(AsyncWebServerRequest* request);
   void handleDraw(AsyncWebServerRequest* request);
   void getHardwareConfigJSON(AsyncWebServerRequest* request);
   void handleHardwareConfig(AsyncWebServerRequest* request);
@@ -133,13 +154,17 @@ class WiFiManagerESP32 {
   void resetGameSelection() { gameMode = "0"; };
   // Bot configuration
   BotConfig getBotConfig() { return botConfig; }
+  EngineBackend getEngineBackend() const { return engineBackend; }
   // Lichess configuration
   LichessConfig getLichessConfig();
   String getLichessToken() { return lichessToken; }
+  String getSpectateTarget() const { return spectateTarget; }
   // Board state management (FEN-based)
   void updateBoardState(const String& fen, float evaluation = 0.0f);
   String getCurrentFen() const { return currentFen; }
   float getEvaluation() const { return boardEvaluation; }
+  void setRepetitionWarning(bool warning) { repetitionWarning = warning; }
+  void updateLegalMoves(const uint64_t masks[64]) { memcpy(legalMoveMasks, masks, sizeof(legalMoveMasks)); }
   // Board edit management (FEN-based)
   bool getPendingBoardEdit(String& fenOut);
   void clearPendingEdit();
@@ -0,0 +1,94 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Just enough of the Arduino core to build the hardware-free firmware classes on a PC.
+// Time comes from a fake clock that tests move with hostSetMillis()/delay().
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#define PROGMEM
+
+class String : public std::string {
+ public:
+  String() {}
+  String(const std::string& s) : std::string(s) {}
+  String(const char* s) : std::string(s ? s : "") {}
+  explicit String(char c) : std::string(1, c) {}
+  explicit String(int v) : std::string(std::to_string(v)) {}
+  explicit String(unsigned v) : std::string(std::to_string(v)) {}
+  explicit String(long v) : std::string(std::to_string(v)) {}
+  explicit String(unsigned long v) : std::string(std::to_string(v)) {}
+
+  unsigned length() const { return size(); }
+  int indexOf(char c, int from = 0) const { size_t p = find(c, from); return p == npos ? -1 : (int)p; }
+  int indexOf(const char* s, int from = 0) const { size_t p = find(s, from); return p == npos ? -1 : (int)p; }
+  String substring(int from, int to = -1) const { return to < 0 ? String(substr(from)) : String(substr(from, to - from)); }
+  bool startsWith(const String& s) const { return compare(0, s.size(), s) == 0; }
+  bool endsWith(const String& s) const { return size() >= s.size() && compare(size() - s.size(), s.size(), s) == 0; }
+  void remove(unsigned index, unsigned count = (unsigned)-1) { erase(index, count); }
+  long toInt() const { return atol(c_str()); }
+  void toLowerCase() { for (char& c : *this) c = tolower((unsigned char)c); }
+
+  String& operator+=(const String& s) { append(s); return *this; }
+  String& operator+=(const char* s) { append(s); return *this; }
+  String& operator+=(char c) { push_back(c); return *this; }
+};
+inline String operator+(const String& a, const String& b) { return String(std::string(a) + std::string(b)); }
+inline String operator+(const String& a, const char* b) { return String(std::string(a) + b); }
+inline String operator+(const char* a, const String& b) { return String(a + std::string(b)); }
+
+// Byte stream interface of the Arduino core
+class Stream {
+ public:
+  virtual ~Stream() {}
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  virtual size_t write(uint8_t) = 0;
+  virtual void flush() {}
+  void setTimeout(unsigned long ms) { timeoutMs = ms; }
+
+ protected:
+  unsigned long timeoutMs = 1000;
+};
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t length = strlen(src);
+  if (size > 0) {
+    size_t n = length < size - 1 ? length : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return length;
+}
+#endif
+
+// Serial output is dropped; tests report through host_test.h
+class HostSerial {
+ public:
+  void print(const String&) {}
+  void println(const String& = String()) {}
+  void printf(const char*, ...) {}
+};
+extern HostSerial Serial;
+
+unsigned long millis();
+void delay(unsigned long ms);
+void hostSetMillis(unsigned long now);
+
+template <class T, class U>
+typename std::common_type<T, U>::type min(T a, U b) { return a < b ? a : b; }
+template <class T, class U>
+typename std::common_type<T, U>::type max(T a, U b) { return a < b ? b : a; }
+template <class T>
+T constrain(T x, T low, T high) { return x < low ? low : x > high ? high : x; }
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,6 @@
+#ifndef HOST_ARDUINO_JSON_H
+#define HOST_ARDUINO_JSON_H
+
+// Some firmware headers include ArduinoJson for their .cpp files; no host test parses JSON
+
+#endif // HOST_ARDUINO_JSON_H
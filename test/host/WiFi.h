@@ -0,0 +1,18 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+#define WL_CONNECTED 3
+
+class IPAddress {};
+
+// Always connected; every name resolves
+class HostWiFi {
+ public:
+  bool hostByName(const char*, IPAddress&) { return true; }
+  int status() { return WL_CONNECTED; }
+};
+extern HostWiFi WiFi;
+
+#endif // HOST_WIFI_H
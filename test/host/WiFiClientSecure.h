@@ -0,0 +1,60 @@
+#ifndef HOST_WIFI_CLIENT_SECURE_H
+#define HOST_WIFI_CLIENT_SECURE_H
+
+#include <Arduino.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+class WiFiClientSecure;
+
+// In-process stand-in for the servers behind WiFiClientSecure. Handshakes and
+// responses cost time on the fake clock, so tests can measure what reuse saves.
+class HostServer {
+ public:
+  // Full HTTP response for one request (head and body as sent by the client)
+  static std::function<std::string(const std::string& request)> handler;
+  static unsigned long handshakeMs; // Cost of connect()
+  static unsigned long responseMs;  // Time until a response can be read
+  static int connects;              // Handshakes so far
+  static int requests;              // Requests received, dropped ones included
+  // Close the connection on the next request instead of answering it, like a
+  // keep-alive socket the server dropped while the client still saw it open
+  static bool dropNextRequest;
+
+  // The server closes every open connection (idle keep-alive timeout)
+  static void closeAll();
+  static void reset();
+
+ private:
+  friend class WiFiClientSecure;
+  static std::vector<WiFiClientSecure*> clients;
+};
+
+// Fake TLS client: plain bytes to and from HostServer
+class WiFiClientSecure {
+ public:
+  WiFiClientSecure();
+  ~WiFiClientSecure();
+  void setInsecure() {}
+
+  int connect(const char* host, uint16_t port);
+  // Like the Arduino client: true while open or while received data is unread
+  bool connected() { return open || available() > 0; }
+  void stop();
+  int available();
+  int read();
+  int peek();
+  size_t print(const String& data);
+
+ private:
+  friend class HostServer;
+  bool open;
+  bool closeAfterResponse;
+  std::string request;
+  std::string response;
+  size_t responsePos;
+  unsigned long readyAt;
+};
+
+#endif // HOST_WIFI_CLIENT_SECURE_H
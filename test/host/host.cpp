@@ -0,0 +1,114 @@
+#include "host_test.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <algorithm>
+
+HostSerial Serial;
+int hostTestFailures = 0;
+
+static unsigned long hostMillis = 0;
+
+unsigned long millis() { return hostMillis; }
+void delay(unsigned long ms) { hostMillis += ms; }
+void hostSetMillis(unsigned long now) { hostMillis = now; }
+
+int hostTestResult(const char* name) {
+  if (hostTestFailures == 0)
+    printf("%s: all checks passed\n", name);
+  else
+    printf("%s: %d check(s) failed\n", name, hostTestFailures);
+  return hostTestFailures == 0 ? 0 : 1;
+}
+
+// --- WiFi and the fake TLS client
+
+HostWiFi WiFi;
+
+std::function<std::string(const std::string&)> HostServer::handler;
+unsigned long HostServer::handshakeMs = 0;
+unsigned long HostServer::responseMs = 0;
+int HostServer::connects = 0;
+int HostServer::requests = 0;
+bool HostServer::dropNextRequest = false;
+std::vector<WiFiClientSecure*> HostServer::clients;
+
+void HostServer::closeAll() {
+  for (WiFiClientSecure* client : clients)
+    client->open = false;
+}
+
+void HostServer::reset() {
+  closeAll();
+  connects = 0;
+  requests = 0;
+  dropNextRequest = false;
+}
+
+WiFiClientSecure::WiFiClientSecure() : open(false), closeAfterResponse(false), responsePos(0), readyAt(0) {
+  HostServer::clients.push_back(this);
+}
+
+WiFiClientSecure::~WiFiClientSecure() {
+  HostServer::clients.erase(std::find(HostServer::clients.begin(), HostServer::clients.end(), this));
+}
+
+int WiFiClientSecure::connect(const char*, uint16_t) {
+  stop();
+  delay(HostServer::handshakeMs);
+  HostServer::connects++;
+  open = true;
+  return 1;
+}
+
+void WiFiClientSecure::stop() {
+  open = false;
+  closeAfterResponse = false;
+  request.clear();
+  response.clear();
+  responsePos = 0;
+}
+
+int WiFiClientSecure::available() {
+  if (millis() < readyAt)
+    return 0;
+  return (int)(response.size() - responsePos);
+}
+
+int WiFiClientSecure::read() {
+  if (available() <= 0)
+    return -1;
+  char c = response[responsePos++];
+  if (responsePos == response.size() && closeAfterResponse)
+    open = false;
+  return (unsigned char)c;
+}
+
+int WiFiClientSecure::peek() {
+  return available() > 0 ? (unsigned char)response[responsePos] : -1;
+}
+
+size_t WiFiClientSecure::print(const String& data) {
+  if (!open)
+    return 0;
+  request += data;
+  size_t headEnd = request.find("\r\n\r\n");
+  if (headEnd == std::string::npos)
+    return data.length();
+  // Bodies are not used by the tests' servers; the request ends with its head
+  std::string complete = request.substr(0, headEnd + 4);
+  request.erase(0, headEnd + 4);
+  HostServer::requests++;
+  if (HostServer::dropNextRequest) {
+    HostServer::dropNextRequest = false;
+    open = false;
+    return data.length();
+  }
+  response.erase(0, responsePos);
+  responsePos = 0;
+  std::string reply = HostServer::handler(complete);
+  response += reply;
+  closeAfterResponse = reply.find("Connection: close") != std::string::npos;
+  readyAt = millis() + HostServer::responseMs;
+  return data.length();
+}
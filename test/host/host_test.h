@@ -0,0 +1,29 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <cstdio>
+
+// Minimal checks for the host tests: a failed check is reported and counted, the test goes on
+extern int hostTestFailures;
+
+#define CHECK(cond)                                                        \
+  do {                                                                     \
+    if (!(cond)) {                                                         \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);      \
+      hostTestFailures++;                                                  \
+    }                                                                      \
+  } while (0)
+
+#define CHECK_EQ(actual, expected)                                                                   \
+  do {                                                                                               \
+    long long a_ = (long long)(actual), e_ = (long long)(expected);                                  \
+    if (a_ != e_) {                                                                                  \
+      printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_);             \
+      hostTestFailures++;                                                                            \
+    }                                                                                                \
+  } while (0)
+
+// Summary line and process exit code for main()
+int hostTestResult(const char* name);
+
+#endif // HOST_TEST_H
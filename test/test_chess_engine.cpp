@@ -0,0 +1,144 @@
+// ChessEngine gives-check detection against making the move and testing for check
+
+#include "chess_engine.h"
+#include "chess_utils.h"
+#include "host_test.h"
+#include <cstring>
+#include <random>
+
+// Board, side, castling and en passant fields of a FEN
+static char setUp(ChessEngine& engine, char board[8][8], const char* fen) {
+  memset(board, ' ', 64);
+  const char* p = fen;
+  for (int row = 0, col = 0; *p && *p != ' '; p++) {
+    if (*p == '/') {
+      row++;
+      col = 0;
+    } else if (*p >= '1' && *p <= '8') {
+      col += *p - '0';
+    } else {
+      board[row][col++] = *p;
+    }
+  }
+  char side = p[1];
+  p += 3;
+  uint8_t rights = 0;
+  for (; *p && *p != ' '; p++)
+    rights |= *p == 'K' ? 0x01 : *p == 'Q' ? 0x02 : *p == 'k' ? 0x04 : *p == 'q' ? 0x08 : 0;
+  engine.reset();
+  engine.setCastlingRights(rights);
+  if (p[1] != '-')
+    engine.setEnPassantTarget('8' - p[2], p[1] - 'a');
+  return side;
+}
+
+// Every legal move of side (all promotions) through givesCheck and getCheckingMoves,
+// compared with playing it. Returns the number of checking moves.
+static int checkPosition(ChessEngine& engine, const char board[8][8], char side) {
+  char enemy = side == 'w' ? 'b' : 'w';
+  CheckInfo info;
+  engine.computeCheckInfo(board, side, info);
+  int checks = 0;
+  for (int row = 0; row < 8; row++)
+    for (int col = 0; col < 8; col++) {
+      char piece = board[row][col];
+      if (piece == ' ' || ChessUtils::getPieceColor(piece) != side)
+        continue;
+      int moveCount = 0;
+      int moves[28][2];
+      engine.getPossibleMoves(board, row, col, moveCount, moves);
+      uint64_t expectedMask = 0;
+      for (int i = 0; i < moveCount; i++) {
+        bool promotes = engine.isPawnPromotion(piece, moves[i][0]);
+        for (char promotion : {' ', 'q', 'r', 'b', 'n'}) {
+          if (promotion != ' ' && !promotes)
+            break;
+          char after[8][8];
+          memcpy(after, board, sizeof(after));
+          ChessEngine scratch = engine;
+          scratch.playMove(after, row, col, moves[i][0], moves[i][1], promotion);
+          bool expected = scratch.isKingInCheck(after, enemy);
+          bool actual = engine.givesCheck(board, info, row, col, moves[i][0], moves[i][1], promotion);
+          if (actual != expected)
+            printf("%c%d%c%d%c: givesCheck %d, expected %d\n", 'a' + col, 8 - row, 'a' + moves[i][1], 8 - moves[i][0], promotion, actual, expected);
+          CHECK(actual == expected);
+          if (promotion == ' ' && expected) {
+            expectedMask |= 1ULL << (moves[i][0] * 8 + moves[i][1]);
+            checks++;
+          }
+        }
+      }
+      CHECK(engine.getCheckingMoves(board, info, row, col, moves, moveCount) == expectedMask);
+    }
+  return checks;
+}
+
+static int checkFen(const char* fen) {
+  ChessEngine engine;
+  char board[8][8];
+  char side = setUp(engine, board, fen);
+  return checkPosition(engine, board, side);
+}
+
+static void testSpecialMoves() {
+  CHECK_EQ(checkFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"), 0);
+  // Castling: the rook lands on f1 and checks the king on f8
+  CHECK_EQ(checkFen("5k2/8/8/8/8/8/8/4K2R w K - 0 1"), 3);
+  // Promotions: e8=Q and e8=R check along the rank, e8=N and e8=B do not
+  CHECK(checkFen("k7/4P3/8/8/8/8/8/4K3 w - - 0 1") > 0);
+  // En passant removes both pawns from the rank: discovered check by the rook
+  CHECK(checkFen("8/8/8/R2pP2k/8/8/8/4K3 w - d6 0 1") > 0);
+  // Discovered checks by a knight and a bishop moving off the lines of a queen and a rook
+  CHECK(checkFen("4k3/8/8/4N3/8/8/8/2B1Q1K1 w - - 0 1") > 0);
+  CHECK(checkFen("3k4/8/8/8/3B4/8/8/3RK3 w - - 0 1") > 0);
+  // Black to move: a pawn check, and every knight move discovers the rook
+  CHECK_EQ(checkFen("4k3/8/8/8/8/3p4/8/2K5 b - - 0 1"), 1);
+  CHECK_EQ(checkFen("2r1k3/8/8/8/2n5/8/8/2K5 b - - 0 1"), 8);
+}
+
+static void testRandomGames() {
+  // Random legal games: every move of every position agrees with playing it
+  std::mt19937 rng(26);
+  int positions = 0, checks = 0;
+  for (int game = 0; game < 60; game++) {
+    ChessEngine engine;
+    char board[8][8];
+    char side = setUp(engine, board, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    for (int ply = 0; ply < 200; ply++) {
+      checks += checkPosition(engine, board, side);
+      positions++;
+
+      int moves[256][4];
+      int count = 0;
+      for (int row = 0; row < 8; row++)
+        for (int col = 0; col < 8; col++) {
+          if (board[row][col] == ' ' || ChessUtils::getPieceColor(board[row][col]) != side)
+            continue;
+          int moveCount = 0;
+          int pieceMoves[28][2];
+          engine.getPossibleMoves(board, row, col, moveCount, pieceMoves);
+          for (int i = 0; i < moveCount && count < 256; i++) {
+            moves[count][0] = row;
+            moves[count][1] = col;
+            moves[count][2] = pieceMoves[i][0];
+            moves[count][3] = pieceMoves[i][1];
+            count++;
+          }
+        }
+      if (count == 0)
+        break;
+      int* move = moves[rng() % count];
+      const char promotions[] = "qrbn";
+      engine.playMove(board, move[0], move[1], move[2], move[3], promotions[rng() % 4]);
+      side = side == 'w' ? 'b' : 'w';
+    }
+  }
+  CHECK(positions > 1000);
+  CHECK(checks > 100);
+}
+
+int main() {
+  testSpecialMoves();
+  testRandomGames();
+  return hostTestResult("test_chess_engine");
+}
@@ -0,0 +1,131 @@
+// HttpPool keep-alive reuse and stale-socket resend against the fake TLS client
+
+#include "host_test.h"
+#include "http_pool.h"
+#include "stockfish_api.h"
+#include <string>
+
+static const unsigned long HANDSHAKE_MS = 400;
+static const unsigned long RESPONSE_MS = 50;
+
+// Echoes the request path; "/close" answers with Connection: close
+static std::string respond(const std::string& request) {
+  size_t start = request.find(' ') + 1;
+  std::string path = request.substr(start, request.find(' ', start) - start);
+  std::string reply = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(path.size()) + "\r\n";
+  if (path == "/close")
+    reply += "Connection: close\r\n";
+  return reply + "\r\n" + path;
+}
+
+// One GET; returns the status and the fake-clock time it took
+static int get(const char* host, const char* path, unsigned long& elapsed, String* bodyOut = nullptr) {
+  String body;
+  unsigned long start = millis();
+  int status = HttpPool::request(host, 443, "GET", path, "", "", body, 5000);
+  elapsed = millis() - start;
+  if (status == 200)
+    CHECK(body == path);
+  if (bodyOut)
+    *bodyOut = body;
+  return status;
+}
+
+static void testReuse() {
+  HostServer::reset();
+  unsigned long first, second;
+  CHECK_EQ(get(STOCKFISH_API_URL, "/a", first), 200);
+  CHECK_EQ(HostServer::connects, 1);
+  CHECK(first >= HANDSHAKE_MS + RESPONSE_MS);
+
+  // Same host again: the keep-alive socket skips the handshake
+  CHECK_EQ(get(STOCKFISH_API_URL, "/b", second), 200);
+  CHECK_EQ(HostServer::connects, 1);
+  CHECK(second >= RESPONSE_MS);
+  CHECK(second < first);
+  CHECK(first - second >= HANDSHAKE_MS);
+
+  // Another host gets its own slot, then both are reused
+  unsigned long elapsed;
+  CHECK_EQ(get("lichess.org", "/c", elapsed), 200);
+  CHECK_EQ(HostServer::connects, 2);
+  CHECK_EQ(get(STOCKFISH_API_URL, "/d", elapsed), 200);
+  CHECK_EQ(get("lichess.org", "/e", elapsed), 200);
+  CHECK_EQ(HostServer::connects, 2);
+  CHECK_EQ(HostServer::requests, 5);
+}
+
+static void testStaleSocketResent() {
+  HostServer::reset();
+  unsigned long elapsed;
+  CHECK_EQ(get(STOCKFISH_API_URL, "/a", elapsed), 200);
+  NetEndpointStats before;
+  NetTelemetry::getStats(NetEndpoint::STOCKFISH, before);
+
+  // The server drops the idle socket only when the next request arrives: the
+  // client saw it open, so the request is lost and must be resent on a new one
+  HostServer::dropNextRequest = true;
+  CHECK_EQ(get(STOCKFISH_API_URL, "/b", elapsed), 200);
+  CHECK_EQ(HostServer::connects, 2);
+  CHECK_EQ(HostServer::requests, 3);
+  NetEndpointStats after;
+  NetTelemetry::getStats(NetEndpoint::STOCKFISH, after);
+  CHECK_EQ(after.retries, before.retries + 1);
+  CHECK_EQ(after.errors, before.errors);
+
+  // The new socket is kept for the next request
+  CHECK_EQ(get(STOCKFISH_API_URL, "/c", elapsed), 200);
+  CHECK_EQ(HostServer::connects, 2);
+}
+
+static void testNotReused() {
+  HostServer::reset();
+  unsigned long elapsed;
+  CHECK_EQ(get(STOCKFISH_API_URL, "/a", elapsed), 200);
+
+  // Closed by the server while idle: seen at acquire, reconnected without a resend
+  HostServer::closeAll();
+  CHECK_EQ(get(STOCKFISH_API_URL, "/b", elapsed), 200);
+  CHECK_EQ(HostServer::connects, 2);
+  CHECK_EQ(HostServer::requests, 2);
+
+  // Connection: close is honoured
+  CHECK_EQ(get(STOCKFISH_API_URL, "/close", elapsed), 200);
+  CHECK_EQ(get(STOCKFISH_API_URL, "/c", elapsed), 200);
+  CHECK_EQ(HostServer::connects, 3);
+
+  // Idle past the pool's timeout
+  delay(HTTP_POOL_IDLE_TIMEOUT_MS + 1);
+  CHECK_EQ(get(STOCKFISH_API_URL, "/d", elapsed), 200);
+  CHECK_EQ(HostServer::connects, 4);
+}
+
+static void testPoolExhausted() {
+  HostServer::reset();
+  WiFiClientSecure* borrowed[HTTP_POOL_MAX_CONNECTIONS];
+  for (int i = 0; i < HTTP_POOL_MAX_CONNECTIONS; i++) {
+    borrowed[i] = HttpPool::acquire(STOCKFISH_API_URL);
+    CHECK(borrowed[i] != nullptr);
+  }
+  unsigned long start = millis();
+  CHECK(HttpPool::acquire(STOCKFISH_API_URL, 443, 100) == nullptr);
+  CHECK(millis() - start >= 100);
+  HttpPool::release(borrowed[0], true);
+  borrowed[0] = HttpPool::acquire(STOCKFISH_API_URL, 443, 100);
+  CHECK(borrowed[0] != nullptr);
+  for (WiFiClientSecure* client : borrowed)
+    HttpPool::release(client, false);
+}
+
+int main() {
+  HostServer::handler = respond;
+  HostServer::handshakeMs = HANDSHAKE_MS;
+  HostServer::responseMs = RESPONSE_MS;
+  NetTelemetry::begin();
+  HttpPool::begin();
+  testReuse();
+  testStaleSocketResent();
+  testNotReused();
+  testPoolExhausted();
+  return hostTestResult("test_http_pool");
+}
@@ -0,0 +1,356 @@
+// LichessLinkMonitor and LichessPendingMove, alone and in a simulated game with network drops
+
+#include "host_test.h"
+#include "lichess_link.h"
+#include "lichess_stream.h"
+#include <random>
+#include <vector>
+
+static void testLinkStates() {
+  LichessLinkMonitor link;
+  link.reset(1000);
+  LichessLinkActions actions = link.update(true, true, 1000);
+  CHECK(link.online() && !actions.changed && !actions.reopenStreams && !actions.retryWifi);
+
+  // A lost game stream alone counts as offline only after a grace period
+  link.update(true, false, 2000);
+  CHECK(link.online());
+  link.update(true, false, 2000 + LICHESS_OFFLINE_AFTER_MS - 1);
+  CHECK(link.online());
+  actions = link.update(true, false, 2000 + LICHESS_OFFLINE_AFTER_MS);
+  CHECK(actions.changed && link.state() == LichessLink::OFFLINE);
+  // Stream back: resyncing until a state arrives
+  actions = link.update(true, true, 8000);
+  CHECK(actions.changed && link.state() == LichessLink::RESYNCING);
+  CHECK(link.stateReceived());
+  CHECK(link.online());
+  CHECK(!link.stateReceived());
+
+  // A short stream hiccup is not an outage
+  link.update(true, false, 9000);
+  link.update(true, true, 9000 + LICHESS_OFFLINE_AFTER_MS - 1);
+  link.update(true, false, 9000 + LICHESS_OFFLINE_AFTER_MS);
+  CHECK(link.online());
+
+  // WiFi loss is offline at once; the driver is asked to reconnect periodically
+  unsigned long t = 20000;
+  actions = link.update(false, true, t);
+  CHECK(actions.changed && actions.retryWifi && link.state() == LichessLink::OFFLINE);
+  actions = link.update(false, false, t + LICHESS_WIFI_RETRY_MS - 1);
+  CHECK(!actions.retryWifi && !actions.changed);
+  actions = link.update(false, false, t + LICHESS_WIFI_RETRY_MS);
+  CHECK(actions.retryWifi);
+  // WiFi back: streams reopen now; still offline until the game stream is connected
+  actions = link.update(true, false, t + 15000);
+  CHECK(actions.reopenStreams && link.state() == LichessLink::OFFLINE);
+  actions = link.update(true, false, t + 15010);
+  CHECK(!actions.reopenStreams);
+  actions = link.update(true, true, t + 16000);
+  CHECK(actions.changed && link.state() == LichessLink::RESYNCING);
+}
+
+static void testPendingMove() {
+  LichessPendingMove move;
+  CHECK(!move.active());
+  CHECK(move.queue("e2e4", 1, true) == LichessMoveAction::POST);
+  move.posting();
+  CHECK(move.active() && move.move() == "e2e4" && move.getAttempts() == 1);
+  // No blind resend while the POST is out
+  CHECK(move.stateReceived(0, true) == LichessMoveAction::NONE);
+  CHECK(move.postResult(true, true) == LichessMoveAction::NONE);
+  CHECK(!move.active());
+
+  // A failed POST waits for the game state; only a state without the move resends it
+  move.queue("g1f3", 3, true);
+  move.posting();
+  CHECK(move.postResult(false, true) == LichessMoveAction::RECONNECT);
+  CHECK(move.stateReceived(2, false) == LichessMoveAction::NONE); // Resync: not now
+  CHECK(move.stateReceived(2, true) == LichessMoveAction::POST);
+  move.posting();
+  CHECK(move.stateReceived(2, true) == LichessMoveAction::NONE);
+  CHECK(move.postResult(false, true) == LichessMoveAction::RECONNECT);
+  CHECK(move.stateReceived(3, true) == LichessMoveAction::NONE); // Lichess had it after all
+  CHECK(!move.active());
+
+  // Failures while offline are not counted
+  move.queue("d2d4", 5, true);
+  for (int i = 0; i < 10; i++) {
+    move.posting();
+    CHECK(move.postResult(false, false) == LichessMoveAction::NONE);
+    CHECK(move.stateReceived(4, true) == LichessMoveAction::POST);
+  }
+  CHECK_EQ(move.getAttempts(), 0);
+
+  // Online failures are, and the last one gives up
+  for (int i = 0; i < LICHESS_MOVE_MAX_ATTEMPTS; i++) {
+    move.posting();
+    CHECK(move.postResult(false, true) == LichessMoveAction::RECONNECT);
+    CHECK(move.stateReceived(4, true) == (i + 1 < LICHESS_MOVE_MAX_ATTEMPTS ? LichessMoveAction::POST : LichessMoveAction::GIVE_UP));
+  }
+  CHECK(!move.active());
+
+  // Played offline: nothing is posted until a state shows Lichess lacks it
+  CHECK(move.queue("c2c4", 7, false) == LichessMoveAction::NONE);
+  CHECK(move.stateReceived(6, true) == LichessMoveAction::POST);
+  move.queue("c2c4", 7, false);
+  CHECK(move.stateReceived(7, true) == LichessMoveAction::NONE);
+  CHECK(!move.active());
+
+  // A rebuilt board keeps the move only if Lichess has it
+  move.queue("b1c3", 9, true);
+  move.dropIfMissing(9);
+  CHECK(move.active());
+  move.dropIfMissing(8);
+  CHECK(!move.active());
+}
+
+// ---------------------------------------------------------------
+// Drop simulation: one own move played at some point of a game while the network drops
+// at arbitrary points. Mirrors what ChessLichess, LichessStream and LichessMoveSender do
+// with the two classes, against a fake Lichess server.
+
+#define SIM_STEP_MS 10
+#define SIM_POST_LATENCY_MS 300 // Request reaches the server halfway
+#define SIM_POST_TIMEOUT_MS 5000
+#define SIM_CONNECT_FAIL_MS 100
+
+struct Drop {
+  unsigned long start;
+  unsigned long end;
+  bool wifi; // WiFi itself is lost (the driver reports it), otherwise only the path to Lichess
+};
+
+// One POST handed to the sender
+struct Post {
+  unsigned long sentAt;
+  bool arrived;  // Reached the server (or was lost on the way)
+  bool accepted; // The server applied it
+  bool resolved; // The outcome is known
+  bool sent;     // The outcome: the board got Lichess' 200
+  unsigned long resultAt;
+};
+
+class DropSimulation {
+ public:
+  std::vector<Drop> drops;
+  unsigned long moveAt = 2000;
+  const int startPly = 10;
+
+  // Outcome
+  int serverPly = startPly;
+  int applied = 0;
+  int duplicates = 0; // POSTs that reached Lichess after it already had the move
+  int posts = 0;
+  bool gaveUp = false;
+
+  void run(unsigned long until) {
+    link.reset(0);
+    for (now = 0; now <= until; now += SIM_STEP_MS)
+      step();
+  }
+  bool settled() const { return !pending.active() && link.online() && streamConnected; }
+
+ private:
+  unsigned long now = 0;
+  LichessLinkMonitor link;
+  LichessPendingMove pending;
+  bool played = false;
+  bool posting = false;
+  Post request;
+
+  // Game stream
+  bool streamConnected = true;
+  unsigned long nextAttemptAt = 0;
+  unsigned long backoff = LICHESS_STREAM_BACKOFF_MIN_MS;
+  int deliveredPly = startPly; // Last state sent to the client
+  std::vector<int> states;     // States the client has yet to read
+
+  const Drop* dropAt(unsigned long t) const {
+    for (const Drop& drop : drops)
+      if (t >= drop.start && t < drop.end)
+        return &drop;
+    return nullptr;
+  }
+  bool netUp() const { return dropAt(now) == nullptr; }
+  bool wifiUp() const {
+    const Drop* drop = dropAt(now);
+    return !drop || !drop->wifi;
+  }
+
+  void reconnectStream() {
+    streamConnected = false;
+    nextAttemptAt = now;
+  }
+
+  void failStreamAttempt() {
+    nextAttemptAt = now + backoff;
+    backoff = min(backoff * 2, (unsigned long)LICHESS_STREAM_BACKOFF_MAX_MS);
+  }
+
+  // LichessStream
+  void stepStream() {
+    const Drop* drop = dropAt(now);
+    if (streamConnected && drop) {
+      // The stack notices a lost WiFi at once, a dead path only by the stream's idle timeout
+      if (drop->wifi || now - drop->start >= LICHESS_STREAM_IDLE_TIMEOUT_MS) {
+        streamConnected = false;
+        failStreamAttempt();
+      }
+    } else if (!streamConnected && now >= nextAttemptAt) {
+      if (netUp()) {
+        // Lichess starts every stream with gameFull
+        streamConnected = true;
+        backoff = LICHESS_STREAM_BACKOFF_MIN_MS;
+        states.push_back(serverPly);
+        deliveredPly = serverPly;
+      } else if (wifiUp()) {
+        failStreamAttempt();
+      } else {
+        nextAttemptAt = now + LICHESS_STREAM_BACKOFF_MIN_MS; // No WiFi: not counted as a failure
+      }
+    }
+    // gameState events; after a silent drop TCP delivers them once the path is back
+    if (streamConnected && netUp() && deliveredPly != serverPly) {
+      states.push_back(serverPly);
+      deliveredPly = serverPly;
+    }
+  }
+
+  // LichessMoveSender and the Lichess server
+  void stepPost() {
+    if (!posting || request.resolved)
+      return;
+    if (!request.arrived && now >= request.sentAt + SIM_POST_LATENCY_MS / 2) {
+      request.arrived = true;
+      if (netUp() && serverPly == startPly) {
+        serverPly++;
+        applied++;
+        request.accepted = true;
+      } else if (netUp()) {
+        duplicates++; // Lichess rejects it
+      }
+    }
+    if (request.arrived && now >= request.sentAt + SIM_POST_LATENCY_MS) {
+      // Without an answer the request runs into its timeout
+      bool answered = netUp() && (request.accepted || serverPly != startPly);
+      if (answered || now >= request.sentAt + SIM_POST_TIMEOUT_MS) {
+        request.resolved = true;
+        request.sent = answered && request.accepted;
+        request.resultAt = now;
+      }
+    }
+  }
+
+  void post() {
+    pending.posting();
+    posts++;
+    // forget() of an earlier request: nothing in this simulation is still in flight then
+    posting = true;
+    request = {now, false, false, false, false, 0};
+    if (!wifiUp()) {
+      // No connection can be opened
+      request.arrived = true;
+      request.resolved = true;
+      request.resultAt = now + SIM_CONNECT_FAIL_MS;
+    }
+  }
+
+  void step() {
+    stepPost();
+    stepStream();
+
+    // ChessLichess::update()
+    LichessLinkActions actions = link.update(wifiUp(), streamConnected, now);
+    if (actions.reopenStreams)
+      reconnectStream();
+
+    if (!played && now >= moveAt) {
+      played = true;
+      if (pending.queue("e2e4", startPly + 1, link.online()) == LichessMoveAction::POST)
+        post();
+    }
+
+    // checkPendingMove()
+    if (posting && request.resolved && now >= request.resultAt) {
+      posting = false;
+      if (pending.postResult(request.sent, link.online() && wifiUp()) == LichessMoveAction::RECONNECT)
+        reconnectStream();
+    }
+
+    // Game stream states: reconcilePendingMove(), then the link is back in sync
+    std::vector<int> arrived;
+    arrived.swap(states);
+    for (int ply : arrived) {
+      switch (pending.stateReceived(ply, true)) {
+        case LichessMoveAction::POST:
+          post();
+          break;
+        case LichessMoveAction::GIVE_UP:
+          gaveUp = true;
+          break;
+        default:
+          break;
+      }
+      link.stateReceived();
+    }
+  }
+};
+
+static void checkSettled(const DropSimulation& sim, const char* scenario, unsigned long a, unsigned long b) {
+  bool ok = sim.applied == 1 && sim.duplicates == 0 && !sim.gaveUp && sim.settled();
+  if (!ok)
+    printf("%s (%lu, %lu): applied %d, duplicates %d, posts %d, gave up %d, settled %d\n", scenario, a, b, sim.applied, sim.duplicates, sim.posts, sim.gaveUp, sim.settled());
+  CHECK(ok);
+}
+
+static void testSingleDrops() {
+  // Drops starting before, during and after the move (played at 2 s), with lengths from a blip to a long outage, both kinds
+  const unsigned long lengths[] = {20, 150, 290, 310, 1000, 4990, 5010, 9000, 19990, 20010, 45000, 120000};
+  for (int wifi = 0; wifi < 2; wifi++)
+    for (unsigned long length : lengths)
+      for (unsigned long start = 0; start <= 8000; start += 50) {
+        DropSimulation sim;
+        sim.drops.push_back({start, start + length, wifi == 1});
+        sim.run(start + length + 90000);
+        checkSettled(sim, wifi ? "WiFi drop" : "Path drop", start, length);
+      }
+}
+
+static void testRandomDrops() {
+  // Several drops of both kinds; the move may be posted more than once, but Lichess never
+  // sees it twice and it is only abandoned after online attempts Lichess did not take
+  std::mt19937 rng(2024);
+  int settledRuns = 0;
+  for (int run = 0; run < 2000; run++) {
+    DropSimulation sim;
+    sim.moveAt = 1000 + rng() % 5000;
+    unsigned long t = rng() % 8000;
+    int count = 1 + rng() % 4;
+    for (int i = 0; i < count; i++) {
+      unsigned long maxLength = rng() % 2 ? 800 : 30000;
+      unsigned long length = 10 + rng() % maxLength;
+      bool wifi = rng() % 2 == 0;
+      sim.drops.push_back({t, t + length, wifi});
+      t += length + 10 + rng() % 6000;
+    }
+    sim.run(t + 90000);
+    CHECK_EQ(sim.duplicates, 0);
+    CHECK(sim.applied <= 1);
+    if (sim.gaveUp) {
+      CHECK_EQ(sim.applied, 0);
+      CHECK(sim.posts >= LICHESS_MOVE_MAX_ATTEMPTS);
+    } else {
+      checkSettled(sim, "Random drops", run, count);
+      settledRuns++;
+    }
+  }
+  CHECK(settledRuns > 1900);
+}
+
+int main() {
+  testLinkStates();
+  testPendingMove();
+  testSingleDrops();
+  testRandomDrops();
+  return hostTestResult("test_lichess_link");
+}
@@ -0,0 +1,128 @@
+// LichessRateLimiter and LichessScheduler driven by a fake clock
+
+#include "host_test.h"
+#include "lichess_scheduler.h"
+
+static void testBurstAndRefill() {
+  LichessRateLimiter limiter;
+  limiter.reset(1000);
+  // A full bucket allows a burst, then one request per refill period
+  for (int i = 0; i < LICHESS_STREAM_BURST; i++)
+    CHECK(limiter.tryAcquire(LichessRequestKind::STREAM, 1000));
+  CHECK(!limiter.tryAcquire(LichessRequestKind::STREAM, 1000));
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::STREAM, 1000), LICHESS_STREAM_REFILL_MS);
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::STREAM, 2000), LICHESS_STREAM_REFILL_MS - 1000);
+  CHECK(!limiter.tryAcquire(LichessRequestKind::STREAM, 1000 + LICHESS_STREAM_REFILL_MS - 1));
+  CHECK(limiter.tryAcquire(LichessRequestKind::STREAM, 1000 + LICHESS_STREAM_REFILL_MS));
+  CHECK(!limiter.tryAcquire(LichessRequestKind::STREAM, 1000 + LICHESS_STREAM_REFILL_MS));
+
+  // Buckets are independent
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::API, 1000), 0);
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::MOVE, 1000), 0);
+}
+
+static void testRefillCapsAtBurst() {
+  LichessRateLimiter limiter;
+  limiter.reset(0);
+  // Idle time earns at most a full bucket, and no credit towards the next token
+  unsigned long now = 100000;
+  for (int i = 0; i < LICHESS_API_BURST; i++)
+    CHECK(limiter.tryAcquire(LichessRequestKind::API, now));
+  CHECK(!limiter.tryAcquire(LichessRequestKind::API, now));
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::API, now), LICHESS_API_REFILL_MS);
+
+  // Partial periods carry over: two tokens after two and a half periods, the next half a period later
+  now += 2 * LICHESS_API_REFILL_MS + LICHESS_API_REFILL_MS / 2;
+  CHECK(limiter.tryAcquire(LichessRequestKind::API, now));
+  CHECK(limiter.tryAcquire(LichessRequestKind::API, now));
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::API, now), LICHESS_API_REFILL_MS / 2);
+}
+
+static void testRateLimitCooldown() {
+  LichessRateLimiter limiter;
+  limiter.reset(5000);
+  CHECK(limiter.tryAcquire(LichessRequestKind::API, 5000));
+  limiter.report(LichessRequestKind::API, 429, 5000);
+  CHECK_EQ(limiter.getRateLimitedCount(), 1);
+
+  // A 429 holds back every kind, moves included, for the full minute
+  unsigned long end = 5000 + LICHESS_RATE_LIMIT_COOLDOWN_MS;
+  CHECK_EQ(limiter.cooldownRemainingMs(5000), LICHESS_RATE_LIMIT_COOLDOWN_MS);
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::MOVE, 5000), LICHESS_RATE_LIMIT_COOLDOWN_MS);
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::STREAM, end - 1), 1);
+  CHECK(!limiter.tryAcquire(LichessRequestKind::MOVE, end - 1));
+  CHECK(!limiter.tryAcquire(LichessRequestKind::API, end - 1));
+  CHECK_EQ(limiter.cooldownRemainingMs(end), 0);
+  CHECK(limiter.tryAcquire(LichessRequestKind::MOVE, end));
+  CHECK(limiter.tryAcquire(LichessRequestKind::STREAM, end));
+
+  // Other statuses do not start a cool-down
+  limiter.report(LichessRequestKind::STREAM, 500, end);
+  limiter.report(LichessRequestKind::STREAM, -1, end);
+  CHECK_EQ(limiter.cooldownRemainingMs(end), 0);
+  CHECK_EQ(limiter.getRateLimitedCount(), 1);
+
+  // The cool-down survives a clock wrap-around
+  unsigned long nearWrap = (unsigned long)-1000;
+  limiter.reset(nearWrap);
+  limiter.report(LichessRequestKind::API, 429, nearWrap);
+  CHECK_EQ(limiter.cooldownRemainingMs(nearWrap + 2000), LICHESS_RATE_LIMIT_COOLDOWN_MS - 2000);
+}
+
+static void testMovePriority() {
+  LichessRateLimiter limiter;
+  limiter.reset(0);
+  limiter.moveQueued();
+  // Polling steps back while a move waits or is in flight; the move itself does not
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::STREAM, 10), LICHESS_MOVE_PRIORITY_MS);
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::API, 10), LICHESS_MOVE_PRIORITY_MS);
+  CHECK(!limiter.tryAcquire(LichessRequestKind::STREAM, 10));
+  CHECK(limiter.tryAcquire(LichessRequestKind::MOVE, 10));
+  CHECK(!limiter.tryAcquire(LichessRequestKind::API, 20));
+  // Its report lets the others go again
+  limiter.report(LichessRequestKind::MOVE, 200, 300);
+  CHECK(limiter.tryAcquire(LichessRequestKind::STREAM, 300));
+  CHECK(limiter.tryAcquire(LichessRequestKind::API, 300));
+
+  // An exhausted move bucket still delays only for its own refill
+  limiter.reset(1000);
+  for (int i = 0; i < LICHESS_MOVE_BURST; i++)
+    CHECK(limiter.tryAcquire(LichessRequestKind::MOVE, 1000));
+  limiter.moveQueued();
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::MOVE, 1000), LICHESS_MOVE_REFILL_MS);
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::STREAM, 1000), LICHESS_MOVE_PRIORITY_MS);
+  limiter.moveDone();
+  limiter.moveDone(); // Extra calls do not go negative
+  CHECK_EQ(limiter.waitMs(LichessRequestKind::STREAM, 1000), 0);
+}
+
+static void testSchedulerWaits() {
+  // The firmware wrapper sleeps with delay(), which moves the fake clock
+  hostSetMillis(10000);
+  LichessScheduler::begin();
+  for (int i = 0; i < LICHESS_API_BURST; i++)
+    CHECK(LichessScheduler::acquire(LichessRequestKind::API));
+  CHECK(!LichessScheduler::acquire(LichessRequestKind::API));
+  CHECK_EQ(millis(), 10000);
+  CHECK(LichessScheduler::acquire(LichessRequestKind::API, LICHESS_API_REFILL_MS));
+  CHECK_EQ(millis(), 10000 + LICHESS_API_REFILL_MS);
+
+  // During the cool-down acquire() gives up at once when the wait exceeds its budget
+  LichessScheduler::report(LichessRequestKind::API, 429);
+  CHECK_EQ(LichessScheduler::getRateLimitedCount(), 1);
+  unsigned long start = millis();
+  CHECK(!LichessScheduler::acquire(LichessRequestKind::MOVE, 5000));
+  CHECK_EQ(millis(), start);
+  CHECK(LichessScheduler::acquire(LichessRequestKind::MOVE, LICHESS_RATE_LIMIT_COOLDOWN_MS));
+  CHECK_EQ(millis(), start + LICHESS_RATE_LIMIT_COOLDOWN_MS);
+  LichessScheduler::report(LichessRequestKind::MOVE, 201);
+}
+
+int main() {
+  testBurstAndRefill();
+  testRefillCapsAtBurst();
+  testRateLimitCooldown();
+  testMovePriority();
+  testSchedulerWaits();
+  return hostTestResult("test_lichess_scheduler");
+}
@@ -0,0 +1,174 @@
+// NdjsonDecoder fed by a mock Lichess stream that splits chunks and reads at arbitrary bytes
+
+#include "host_test.h"
+#include "ndjson_decoder.h"
+#include <random>
+#include <vector>
+
+static const std::vector<String> EVENTS = {
+    "{\"type\":\"gameFull\",\"id\":\"abcd1234\",\"state\":{\"type\":\"gameState\",\"moves\":\"e2e4 e7e5\",\"wtime\":180000,\"btime\":180000}}",
+    "{\"type\":\"gameState\",\"moves\":\"e2e4 e7e5 g1f3\",\"wtime\":178000,\"btime\":180000}",
+    "{\"type\":\"chatLine\",\"username\":\"lichess\",\"text\":\"Takeback sent\",\"room\":\"player\"}",
+    "{\"type\":\"gameState\",\"moves\":\"e2e4 e7e5 g1f3 b8c6\",\"wtime\":178000,\"btime\":176500,\"status\":\"started\"}",
+};
+
+// What Lichess sends for a game stream: NDJSON events with keep-alive empty lines in
+// between, framed with chunked transfer encoding the way the server chooses to split it
+class MockNdjsonServer {
+ public:
+  explicit MockNdjsonServer(uint32_t seed) : rng(seed) {}
+
+  std::string body(bool crlf) {
+    std::string out;
+    for (const String& event : EVENTS) {
+      out += event + (crlf ? "\r\n" : "\n");
+      if (rng() % 2)
+        out += "\n"; // Keep-alive
+    }
+    return out;
+  }
+
+  // chunkSize 0 picks a random size per chunk
+  std::string chunked(const std::string& payload, size_t chunkSize = 0) {
+    std::string out;
+    size_t pos = 0;
+    while (pos < payload.size()) {
+      size_t size = std::min(chunkSize ? chunkSize : 1 + rng() % 64, payload.size() - pos);
+      char head[32];
+      snprintf(head, sizeof(head), rng() % 2 ? "%zx" : "%zX", size);
+      out += head;
+      if (rng() % 4 == 0)
+        out += ";ext=1";
+      out += "\r\n" + payload.substr(pos, size) + "\r\n";
+      pos += size;
+    }
+    out += "0\r\n";
+    if (rng() % 2)
+      out += "X-Trailer: 1\r\n";
+    out += "\r\n";
+    return out;
+  }
+
+  // The socket hands over the bytes in reads of arbitrary size
+  std::vector<std::string> reads(const std::string& wire) {
+    std::vector<std::string> out;
+    size_t pos = 0;
+    while (pos < wire.size()) {
+      size_t size = std::min<size_t>(1 + rng() % 100, wire.size() - pos);
+      out.push_back(wire.substr(pos, size));
+      pos += size;
+    }
+    return out;
+  }
+
+ private:
+  std::mt19937 rng;
+};
+
+static std::vector<String> decode(NdjsonDecoder& decoder, const std::vector<std::string>& reads) {
+  std::vector<String> lines;
+  for (const std::string& read : reads)
+    for (char c : read)
+      if (decoder.push(c))
+        lines.push_back(decoder.line());
+  return lines;
+}
+
+static void testPlainBody() {
+  MockNdjsonServer server(1);
+  NdjsonDecoder decoder(false);
+  std::vector<String> lines = decode(decoder, server.reads(server.body(true)));
+  CHECK(lines == EVENTS);
+  CHECK(!decoder.failed());
+  CHECK(!decoder.ended());
+}
+
+static void testRandomChunkAndReadSplits() {
+  for (uint32_t seed = 0; seed < 500; seed++) {
+    MockNdjsonServer server(seed);
+    NdjsonDecoder decoder(true);
+    std::vector<String> lines = decode(decoder, server.reads(server.chunked(server.body(seed % 2))));
+    CHECK(lines == EVENTS);
+    CHECK(!decoder.failed());
+    CHECK(decoder.ended());
+  }
+}
+
+static void testEveryChunkSize() {
+  MockNdjsonServer server(7);
+  std::string payload = server.body(false);
+  for (size_t size = 1; size <= payload.size(); size++) {
+    NdjsonDecoder decoder(true);
+    std::vector<String> lines = decode(decoder, {server.chunked(payload, size)});
+    CHECK(lines == EVENTS);
+    CHECK(decoder.ended());
+  }
+}
+
+static void testEverySplitPoint() {
+  // One connection's bytes cut in two at every position; the decoder keeps its state between reads
+  MockNdjsonServer server(11);
+  std::string wire = server.chunked(server.body(true));
+  for (size_t cut = 0; cut <= wire.size(); cut++) {
+    NdjsonDecoder decoder(true);
+    std::vector<String> lines = decode(decoder, {wire.substr(0, cut), wire.substr(cut)});
+    CHECK(lines == EVENTS);
+    CHECK(!decoder.failed());
+  }
+}
+
+static void testLongLineSkipped() {
+  MockNdjsonServer server(3);
+  std::string payload = "{\"type\":\"gameState\"}\n" + std::string(NDJSON_MAX_LINE + 10, 'x') + "\n" + std::string(EVENTS[1]) + "\n";
+  NdjsonDecoder decoder(true);
+  std::vector<String> lines = decode(decoder, server.reads(server.chunked(payload)));
+  CHECK_EQ(lines.size(), 2);
+  CHECK(lines.size() == 2 && lines[0] == "{\"type\":\"gameState\"}" && lines[1] == EVENTS[1]);
+  CHECK(!decoder.failed());
+}
+
+static void testBrokenFraming() {
+  const char* broken[] = {
+      "zz\r\n",                // Not a chunk size
+      "\r\n",                  // Empty chunk size
+      "4\r\nabcdX",            // Chunk data not followed by CRLF
+      "4\rX",                  // CR without LF after the size
+      "FFFFFFFFF\r\n",         // Absurd chunk size
+  };
+  for (const char* wire : broken) {
+    NdjsonDecoder decoder(true);
+    decode(decoder, {wire});
+    CHECK(decoder.failed());
+  }
+  // Bare LF line endings in the framing are tolerated
+  NdjsonDecoder decoder(true);
+  std::vector<String> lines = decode(decoder, {"3\nab\n\n0\n\n"});
+  CHECK(!decoder.failed());
+  CHECK(decoder.ended());
+  CHECK(lines.size() == 1 && lines[0] == "ab");
+}
+
+static void testLineValidUntilNextPush() {
+  NdjsonDecoder decoder(false);
+  for (char c : std::string("{\"a\":1}"))
+    CHECK(!decoder.push(c));
+  CHECK(decoder.push('\n'));
+  CHECK(decoder.line() == "{\"a\":1}");
+  CHECK(!decoder.push('{'));
+  CHECK(decoder.line() == "{");
+  // reset() starts a new connection from scratch
+  decoder.reset(true);
+  CHECK(decoder.line() == "");
+  CHECK(!decoder.ended());
+}
+
+int main() {
+  testPlainBody();
+  testRandomChunkAndReadSplits();
+  testEveryChunkSize();
+  testEverySplitPoint();
+  testLongLineSkipped();
+  testBrokenFraming();
+  testLineValidUntilNextPush();
+  return hostTestResult("test_ndjson_decoder");
+}
@@ -0,0 +1,98 @@
+// NetTelemetry percentile math, directly and through synthetic request timings
+
+#include "host_test.h"
+#include "net_telemetry.h"
+#include <random>
+#include <vector>
+
+static NetSample sample(uint16_t firstByteMs, bool connected = false, int16_t status = 200) {
+  NetSample s = {};
+  s.endpoint = NetEndpoint::STOCKFISH;
+  s.connected = connected;
+  s.status = status;
+  s.firstByteMs = firstByteMs;
+  s.totalMs = firstByteMs + 20;
+  s.connectMs = connected ? firstByteMs / 2 : 0;
+  s.bytes = 100;
+  return s;
+}
+
+static void testNearestRank() {
+  CHECK_EQ(NetTelemetry::percentile(nullptr, 0, 50), 0);
+
+  uint16_t single[] = {42};
+  CHECK_EQ(NetTelemetry::percentile(single, 1, 1), 42);
+  CHECK_EQ(NetTelemetry::percentile(single, 1, 99), 42);
+
+  // 1..100 in random order: the p-th percentile is p
+  std::vector<uint16_t> values;
+  for (int i = 1; i <= 100; i++)
+    values.push_back(i);
+  std::shuffle(values.begin(), values.end(), std::mt19937(5));
+  for (int pct : {1, 25, 50, 95, 99, 100}) {
+    std::vector<uint16_t> copy = values;
+    CHECK_EQ(NetTelemetry::percentile(copy.data(), copy.size(), pct), pct);
+  }
+  // Sorted in place
+  NetTelemetry::percentile(values.data(), values.size(), 50);
+  CHECK(std::is_sorted(values.begin(), values.end()));
+
+  // A full ring of 32: rank = ceil(pct * 32 / 100)
+  uint16_t ring[NET_TELEMETRY_SAMPLES];
+  for (int i = 0; i < NET_TELEMETRY_SAMPLES; i++)
+    ring[i] = (NET_TELEMETRY_SAMPLES - i) * 10;
+  CHECK_EQ(NetTelemetry::percentile(ring, NET_TELEMETRY_SAMPLES, 50), 160);
+  CHECK_EQ(NetTelemetry::percentile(ring, NET_TELEMETRY_SAMPLES, 95), 310);
+  CHECK_EQ(NetTelemetry::percentile(ring, NET_TELEMETRY_SAMPLES, 99), 320);
+
+  // Small sets: p95 of 10 samples is the largest, p50 the 5th
+  uint16_t ten[] = {900, 100, 800, 200, 700, 300, 600, 400, 500, 1000};
+  CHECK_EQ(NetTelemetry::percentile(ten, 10, 50), 500);
+  CHECK_EQ(NetTelemetry::percentile(ten, 10, 95), 1000);
+  CHECK_EQ(NetTelemetry::percentile(ten, 10, 90), 900);
+}
+
+static void testEndpointStats() {
+  NetTelemetry::begin();
+  // 8 slow requests first, then a full ring of faster ones replaces them
+  for (int i = 0; i < 8; i++)
+    NetTelemetry::record(sample(5000, true, -1));
+  for (int i = 1; i <= NET_TELEMETRY_SAMPLES; i++)
+    NetTelemetry::record(sample(i * 10, i % 4 == 0, i == 3 ? 429 : 200));
+
+  NetEndpointStats stats;
+  NetTelemetry::getStats(NetEndpoint::STOCKFISH, stats);
+  CHECK_EQ(stats.requests, 8 + NET_TELEMETRY_SAMPLES);
+  CHECK_EQ(stats.errors, 8 + 1);
+  CHECK_EQ(stats.samples, NET_TELEMETRY_SAMPLES);
+  CHECK_EQ(stats.bytes, NET_TELEMETRY_SAMPLES * 100);
+  CHECK_EQ(stats.firstByte.p50, 160);
+  CHECK_EQ(stats.firstByte.p95, 310);
+  CHECK_EQ(stats.firstByte.p99, 320);
+  CHECK_EQ(stats.total.p50, 180);
+
+  // Connect times only count requests that opened a connection (every 4th: 40, 80, ..., 320)
+  CHECK_EQ(stats.connects, NET_TELEMETRY_SAMPLES / 4);
+  CHECK_EQ(stats.connect.p50, 80);
+  CHECK_EQ(stats.connect.p99, 160);
+
+  // Other endpoints are untouched
+  NetTelemetry::getStats(NetEndpoint::LICHESS, stats);
+  CHECK_EQ(stats.requests, 0);
+  CHECK_EQ(stats.firstByte.p95, 0);
+}
+
+static void testClassify() {
+  CHECK(NetTelemetry::classify("stockfish.online", "/api/s/v2.php?fen=x") == NetEndpoint::STOCKFISH);
+  CHECK(NetTelemetry::classify("lichess.org", "/api/board/game/abc/move/e2e4") == NetEndpoint::LICHESS);
+  CHECK(NetTelemetry::classify("lichess.org", "/api/board/game/stream/abc") == NetEndpoint::LICHESS_STREAM);
+  CHECK(NetTelemetry::classify("lichess.org", "/api/tv/feed") == NetEndpoint::LICHESS_STREAM);
+  CHECK(NetTelemetry::classify("api.github.com", "/repos/x/y/releases/latest") == NetEndpoint::OTA);
+}
+
+int main() {
+  testNearestRank();
+  testEndpointStats();
+  testClassify();
+  return hostTestResult("test_net_telemetry");
+}
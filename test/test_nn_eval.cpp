@@ -0,0 +1,131 @@
+// UI slave position evaluator: kernel sets, incremental updates and the weights file
+
+#include "host_test.h"
+#include "nn_eval.h"
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+
+static const char* WEIGHTS_PATH = "test_nn_eval.bin";
+static const char* START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// Material only: unit u counts own pieces of type u (4 each), the queen also on unit 5.
+// Divisor 1, so P/N/B/R/Q are worth 4 * 25, 4 * 75, 4 * 75, 4 * 125, 4 * (112 + 113) cp.
+static const int8_t UNIT_WEIGHTS[6] = {25, 75, 75, 125, 112, 113};
+
+struct TestNetwork {
+  int16_t ftBias[NN_HIDDEN];
+  int16_t ftWeights[NN_INPUTS][NN_HIDDEN];
+  int8_t outWeights[2 * NN_HIDDEN];
+  int32_t outBias;
+};
+
+enum class Corrupt { NONE, MAGIC, HIDDEN, TRUNCATED };
+
+static void writeWeights(const char* path, Corrupt corrupt = Corrupt::NONE) {
+  static TestNetwork net;
+  memset(&net, 0, sizeof(net));
+  for (int piece = 0; piece < 5; piece++)
+    for (int sq = 0; sq < 64; sq++)
+      net.ftWeights[piece * 64 + sq][piece] = 4;
+  for (int sq = 0; sq < 64; sq++)
+    net.ftWeights[4 * 64 + sq][5] = 4;
+  for (int unit = 0; unit < 6; unit++) {
+    net.outWeights[unit] = UNIT_WEIGHTS[unit];
+    net.outWeights[NN_HIDDEN + unit] = -UNIT_WEIGHTS[unit];
+  }
+
+  NnFileHeader header = {NN_FILE_MAGIC, NN_FILE_VERSION, NN_HIDDEN, 1};
+  if (corrupt == Corrupt::MAGIC)
+    header.magic ^= 1;
+  if (corrupt == Corrupt::HIDDEN)
+    header.hidden = NN_HIDDEN / 2;
+  FILE* f = fopen(path, "wb");
+  fwrite(&header, sizeof(header), 1, f);
+  fwrite(net.ftBias, sizeof(net.ftBias), 1, f);
+  fwrite(net.ftWeights, corrupt == Corrupt::TRUNCATED ? sizeof(net.ftWeights) / 2 : sizeof(net.ftWeights), 1, f);
+  if (corrupt != Corrupt::TRUNCATED) {
+    fwrite(net.outWeights, sizeof(net.outWeights), 1, f);
+    fwrite(&net.outBias, sizeof(net.outBias), 1, f);
+  }
+  fclose(f);
+}
+
+static int evaluateFen(const char* fen) {
+  NnAccumulator acc = {};
+  if (!nn_eval_set_position(&acc, fen))
+    return -99999;
+  return nn_eval_evaluate(&acc, strstr(fen, " b ") == nullptr);
+}
+
+static void testKernelsAgree() {
+  double evalsPerSec = 0;
+  CHECK(nn_eval_self_test(20000, &evalsPerSec));
+  CHECK(evalsPerSec > 0);
+  printf("nn_eval: %.0f full-refresh evals/s on this host\n", evalsPerSec);
+}
+
+static void testLoad() {
+  CHECK(!nn_eval_load("does_not_exist.bin"));
+  CHECK(!nn_eval_ready());
+  for (Corrupt corrupt : {Corrupt::MAGIC, Corrupt::HIDDEN, Corrupt::TRUNCATED}) {
+    writeWeights(WEIGHTS_PATH, corrupt);
+    CHECK(!nn_eval_load(WEIGHTS_PATH));
+    CHECK(!nn_eval_ready());
+  }
+  NnAccumulator acc = {};
+  CHECK(!nn_eval_set_position(&acc, START_FEN));
+  CHECK_EQ(nn_eval_evaluate(&acc, true), 0);
+
+  writeWeights(WEIGHTS_PATH);
+  CHECK(nn_eval_load(WEIGHTS_PATH));
+  CHECK(nn_eval_ready());
+  // A bad file later keeps the loaded network
+  writeWeights(WEIGHTS_PATH, Corrupt::MAGIC);
+  CHECK(!nn_eval_load(WEIGHTS_PATH));
+  CHECK(nn_eval_ready());
+  remove(WEIGHTS_PATH);
+}
+
+static void testMaterial() {
+  CHECK_EQ(evaluateFen(START_FEN), 0);
+  // Always from White's view, whoever is to move
+  CHECK_EQ(evaluateFen("rnb1kbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"), 900);
+  CHECK_EQ(evaluateFen("rnb1kbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq - 0 1"), 900);
+  CHECK_EQ(evaluateFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/R1BQKBNR b KQkq - 0 1"), -300);
+  CHECK_EQ(evaluateFen("4k3/8/8/8/8/8/4P3/4K2R w - - 0 1"), 600);
+  CHECK_EQ(evaluateFen("4k3/pppppppp/8/8/8/8/8/4K3 w - - 0 1"), -800);
+
+  CHECK_EQ(evaluateFen("8/8/8/8/8/8/8 w - - 0 1"), -99999);   // 7 ranks
+  CHECK_EQ(evaluateFen("4k3/8/8/8/8/8/4X3/4K3 w - - 0 1"), -99999);
+}
+
+static void testIncremental() {
+  // Play a game fragment on one accumulator; each step must match a fresh one
+  const char* game[] = {
+      START_FEN,
+      "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1",
+      "rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 2",
+      "rnbqkbnr/ppp1pppp/8/3P4/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0 2",
+      "rnb1kbnr/ppp1pppp/8/3q4/8/8/PPPP1PPP/RNBQKBNR w KQkq - 0 3",
+      "rnb1kbnr/ppp1pppp/8/3q4/8/2N5/PPPP1PPP/R1BQKBNR b KQkq - 1 3",
+      START_FEN, // Takeback to the start
+  };
+  NnAccumulator followed = {};
+  for (const char* fen : game) {
+    CHECK(nn_eval_set_position(&followed, fen));
+    NnAccumulator fresh = {};
+    CHECK(nn_eval_set_position(&fresh, fen));
+    CHECK(memcmp(followed.values, fresh.values, sizeof(fresh.values)) == 0);
+    CHECK_EQ(nn_eval_evaluate(&followed, true), nn_eval_evaluate(&fresh, true));
+  }
+  CHECK_EQ(nn_eval_evaluate(&followed, true), 0);
+}
+
+int main() {
+  testKernelsAgree();
+  testLoad();
+  testMaterial();
+  testIncremental();
+  return hostTestResult("test_nn_eval");
+}
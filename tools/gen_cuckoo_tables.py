@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Generate src/cuckoo_tables.h from the Zobrist keys in src/zobrist_keys.h.
+
+The tables hold one entry per reversible non-pawn move (both directions share
+it): key = Z[piece][from] ^ Z[piece][to] ^ Z[side]. ChessEngine looks a key up
+in slot H1 = key & 0x1FFF or H2 = (key >> 16) & 0x1FFF. Rerun this whenever the
+Zobrist keys change:
+
+    python3 tools/gen_cuckoo_tables.py
+    python3 tools/gen_cuckoo_tables.py --check   # exit 1 if the header is stale
+
+Squares are row * 8 + col with row 0 = rank 8, as in ZOBRIST_TABLE.
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+ZOBRIST_PATH = ROOT / "src" / "zobrist_keys.h"
+CUCKOO_PATH = ROOT / "src" / "cuckoo_tables.h"
+
+TABLE_SIZE = 8192
+PIECES = "PNBRQKpnbrqk"  # Zobrist piece index order
+
+KNIGHT = [(2, 1), (1, 2), (-1, 2), (-2, 1), (-2, -1), (-1, -2), (1, -2), (2, -1)]
+KING = [(1, 0), (-1, 0), (0, 1), (0, -1), (1, 1), (1, -1), (-1, 1), (-1, -1)]
+DIAGONAL = [(1, 1), (1, -1), (-1, 1), (-1, -1)]
+STRAIGHT = [(1, 0), (-1, 0), (0, 1), (0, -1)]
+
+
+def read_array(source, name):
+    match = re.search(name + r"[^=]*=\s*\{?(.*?)\}?;", source, re.S)
+    if not match:
+        sys.exit("%s not found in %s" % (name, ZOBRIST_PATH))
+    return [int(x, 16) for x in re.findall(r"0x([0-9A-Fa-f]+)", match.group(1))]
+
+
+def empty_board_attacks(piece_type, square):
+    """Squares a piece attacks from square on an empty board."""
+    row, col = divmod(square, 8)
+    if piece_type in "NK":
+        steps = KNIGHT if piece_type == "N" else KING
+        return [(row + dr) * 8 + col + dc for dr, dc in steps if 0 <= row + dr < 8 and 0 <= col + dc < 8]
+    directions = (DIAGONAL if piece_type in "BQ" else []) + (STRAIGHT if piece_type in "RQ" else [])
+    squares = []
+    for dr, dc in directions:
+        r, c = row + dr, col + dc
+        while 0 <= r < 8 and 0 <= c < 8:
+            squares.append(r * 8 + c)
+            r, c = r + dr, c + dc
+    return squares
+
+
+def h1(key):
+    return key & 0x1FFF
+
+
+def h2(key):
+    return (key >> 16) & 0x1FFF
+
+
+def build(zobrist, side):
+    keys = [0] * TABLE_SIZE
+    moves = [0] * TABLE_SIZE
+    count = 0
+    for index, piece in enumerate(PIECES):
+        if piece in "Pp":
+            continue
+        for low in range(64):
+            for high in sorted(empty_board_attacks(piece.upper(), low)):
+                if high <= low:
+                    continue
+                key = zobrist[index * 64 + low] ^ zobrist[index * 64 + high] ^ side
+                move = index << 12 | low << 6 | high
+                # Cuckoo insertion: evict the occupant to its other slot until one is free
+                slot = h1(key)
+                while True:
+                    keys[slot], key = key, keys[slot]
+                    moves[slot], move = move, moves[slot]
+                    if move == 0:
+                        break
+                    slot = h2(key) if slot == h1(key) else h1(key)
+                count += 1
+    return keys, moves, count
+
+
+def render(keys, moves, count):
+    lines = [
+        "#ifndef CUCKOO_TABLES_H",
+        "#define CUCKOO_TABLES_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// Cuckoo tables for upcoming-repetition detection, generated from zobrist_keys.h.",
+        "// Holds every reversible non-pawn move as key = Z[piece][from] ^ Z[piece][to] ^ Z[side]",
+        "// (%d moves, both directions share one entry). Lookup slots: H1 = key & 0x1FFF, H2 = (key >> 16) & 0x1FFF." % count,
+        "// Move encoding: bits 12-15 Zobrist piece index, bits 6-11 lower square, bits 0-5 higher square (0 = empty slot).",
+        "// Stored in flash (PROGMEM) like the Zobrist keys; rerun tools/gen_cuckoo_tables.py when those change.",
+        "",
+        "#define CUCKOO_TABLE_SIZE %d" % TABLE_SIZE,
+        "",
+        "static const uint64_t PROGMEM CUCKOO_KEYS[CUCKOO_TABLE_SIZE] = {",
+    ]
+    for i in range(0, TABLE_SIZE, 4):
+        row = ", ".join("0x%016XULL" % k for k in keys[i:i + 4])
+        lines.append("    " + row + ("};" if i + 4 >= TABLE_SIZE else ","))
+    lines += ["", "static const uint16_t PROGMEM CUCKOO_MOVES[CUCKOO_TABLE_SIZE] = {"]
+    for i in range(0, TABLE_SIZE, 16):
+        row = ", ".join("0x%04X" % m for m in moves[i:i + 16])
+        lines.append("    " + row + ("};" if i + 16 >= TABLE_SIZE else ","))
+    lines += ["", "#endif // CUCKOO_TABLES_H", ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="only compare with the committed header")
+    args = parser.parse_args()
+
+    source = ZOBRIST_PATH.read_text()
+    zobrist = read_array(source, "ZOBRIST_TABLE")
+    side = read_array(source, "ZOBRIST_SIDE_TO_MOVE")[0]
+    if len(zobrist) != 12 * 64:
+        sys.exit("ZOBRIST_TABLE has %d keys, expected %d" % (len(zobrist), 12 * 64))
+
+    header = render(*build(zobrist, side))
+    if args.check:
+        if CUCKOO_PATH.read_text() != header:
+            print("%s is out of date, run tools/gen_cuckoo_tables.py" % CUCKOO_PATH.relative_to(ROOT))
+            return 1
+        print("%s is up to date" % CUCKOO_PATH.relative_to(ROOT))
+        return 0
+    CUCKOO_PATH.write_text(header)
+    print("Wrote %s" % CUCKOO_PATH.relative_to(ROOT))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Write nn_eval.bin, the weights file of the UI slave's position evaluator
+(ui_slave/src/nn_eval.h).
+
+Convert a trained float network saved with numpy.savez:
+
+    python3 tools/nn_eval_weights.py --npz net.npz -o nn_eval.bin
+
+The .npz holds ft_bias [64], ft_weights [768, 64], out_weights [128] and
+out_bias (scalar), with a clipped ReLU to [0, 1] between the layers and the
+output in pawns from the side to move. Feature index = piece * 64 + square with
+pieces ordered PNBRQKpnbrqk as seen by the perspective (own pieces first) and
+square = row * 8 + col, row 0 = rank 8, mirrored vertically for Black.
+
+Or write a small hand-made network (material, minor piece centralisation, pawn
+advancement) so the evaluator can be tried without training anything:
+
+    python3 tools/nn_eval_weights.py --material -o nn_eval.bin
+
+Put the file in the working directory of the desktop simulator; the UI shows
+the evaluation next to the last move once it loads.
+"""
+
+import argparse
+import struct
+import sys
+
+INPUTS = 768
+HIDDEN = 64
+MAGIC = 0x4E4E434F  # "OCNN"
+VERSION = 1
+ACTIVATION_MAX = 127  # Clipped ReLU ceiling of the int16 accumulators
+
+
+def material_network():
+    """Each hidden unit counts something about the perspective's own pieces, so
+    it stays in the linear part of the clipped ReLU; the output layer weighs our
+    units against the opponent's."""
+    ft_bias = [0] * HIDDEN
+    ft_weights = [[0] * HIDDEN for _ in range(INPUTS)]
+    us = [0] * HIDDEN
+
+    # Units 0-5: 8 per own pawn, knight, bishop, rook, queen (two units, the weight
+    # does not fit one int8). Divisor 2, so a pawn is 8 * 25 / 2 = 100 cp.
+    material = [(0, 0, 25), (1, 1, 80), (2, 2, 82), (3, 3, 125), (4, 4, 112), (4, 5, 113)]
+    for piece, unit, weight in material:
+        for sq in range(64):
+            ft_weights[piece * 64 + sq][unit] = 8
+        us[unit] = weight
+
+    for sq in range(64):
+        row, col = divmod(sq, 8)
+        # Unit 6: centralisation of knights and bishops, up to 6 * 5 / 2 = 15 cp each
+        centre = min(row, 7 - row) + min(col, 7 - col)
+        for piece in (1, 2):
+            ft_weights[piece * 64 + sq][6] = centre
+        # Unit 7: pawn advancement, 5 cp per rank beyond the second
+        if 1 <= row <= 6:
+            ft_weights[sq][7] = 6 - row
+    us[6] = 5
+    us[7] = 10
+
+    out_weights = us + [-w for w in us]
+    return ft_bias, ft_weights, out_weights, 0, 2
+
+
+def quantize(values, scale, low, high, name):
+    out = []
+    clipped = 0
+    for v in values:
+        q = int(round(float(v) * scale))
+        if q < low or q > high:
+            clipped += 1
+            q = max(low, min(high, q))
+        out.append(q)
+    if clipped:
+        print("warning: %d %s values clipped to [%d, %d]" % (clipped, name, low, high), file=sys.stderr)
+    return out
+
+
+def npz_network(path, out_scale):
+    import numpy as np
+
+    net = np.load(path)
+    ft_weights = net["ft_weights"]
+    if ft_weights.shape != (INPUTS, HIDDEN):
+        sys.exit("ft_weights is %s, expected (%d, %d)" % (ft_weights.shape, INPUTS, HIDDEN))
+    if net["ft_bias"].shape != (HIDDEN,) or net["out_weights"].shape != (2 * HIDDEN,):
+        sys.exit("ft_bias must be [%d] and out_weights [%d]" % (HIDDEN, 2 * HIDDEN))
+
+    # Activations [0, 1] map to [0, 127]; raw output / divisor is centipawns
+    divisor = int(round(ACTIVATION_MAX * out_scale / 100.0))
+    if divisor < 1:
+        sys.exit("--out-scale is too small")
+    ft_bias = quantize(net["ft_bias"], ACTIVATION_MAX, -32768, 32767, "ft_bias")
+    rows = [quantize(row, ACTIVATION_MAX, -32768, 32767, "ft_weights") for row in ft_weights]
+    out_weights = quantize(net["out_weights"], out_scale, -128, 127, "out_weights")
+    out_bias = int(round(float(net["out_bias"]) * ACTIVATION_MAX * out_scale))
+    return ft_bias, rows, out_weights, out_bias, divisor
+
+
+def write(path, ft_bias, ft_weights, out_weights, out_bias, divisor):
+    with open(path, "wb") as f:
+        f.write(struct.pack("<IHHi", MAGIC, VERSION, HIDDEN, divisor))
+        f.write(struct.pack("<%dh" % HIDDEN, *ft_bias))
+        for row in ft_weights:
+            f.write(struct.pack("<%dh" % HIDDEN, *row))
+        f.write(struct.pack("<%db" % (2 * HIDDEN), *out_weights))
+        f.write(struct.pack("<i", out_bias))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--npz", help="trained float network to convert")
+    source.add_argument("--material", action="store_true", help="write the hand-made material network")
+    parser.add_argument("--out-scale", type=int, default=64, help="output weight quantisation (int8 units per 1.0)")
+    parser.add_argument("-o", "--output", default="nn_eval.bin")
+    args = parser.parse_args()
+
+    network = material_network() if args.material else npz_network(args.npz, args.out_scale)
+    write(args.output, *network)
+    print("wrote %s" % args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""
+Expose a UCI engine on the LAN for OpenChess' "LAN engine" bot backend.
+
+Each TCP connection gets its own engine process; lines are piped between the
+socket and the engine's stdin/stdout unchanged. The board keeps one connection
+open across moves and the engine is killed when it disconnects.
+
+    python3 tools/uci_tcp_bridge.py --port 4000 -- stockfish
+    python3 tools/uci_tcp_bridge.py -- ./my_scripted_fake.sh
+
+Then enter this computer's IP and port under "LAN Engine" on the OpenChess
+home page. Works with any program that speaks UCI on stdin/stdout.
+"""
+
+import argparse
+import socket
+import socketserver
+import subprocess
+import sys
+import threading
+
+
+class BridgeHandler(socketserver.StreamRequestHandler):
+    def handle(self):
+        peer = "%s:%d" % self.client_address
+        print("Connection from", peer, flush=True)
+        self.request.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        engine = subprocess.Popen(
+            self.server.engine_cmd,
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            bufsize=0,
+        )
+
+        def engine_to_socket():
+            try:
+                for line in engine.stdout:
+                    if self.server.verbose:
+                        print("<", line.decode(errors="replace").rstrip(), flush=True)
+                    self.wfile.write(line)
+            except OSError:
+                pass
+            finally:
+                # Engine exited: drop the connection so the board reconnects
+                try:
+                    self.request.shutdown(socket.SHUT_RDWR)
+                except OSError:
+                    pass
+
+        reader = threading.Thread(target=engine_to_socket, daemon=True)
+        reader.start()
+        try:
+            for line in self.rfile:
+                if self.server.verbose:
+                    print(">", line.decode(errors="replace").rstrip(), flush=True)
+                engine.stdin.write(line)
+        except OSError:
+            pass
+        finally:
+            engine.kill()
+            engine.wait()
+            print("Disconnected", peer, flush=True)
+
+
+class BridgeServer(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve a UCI engine over TCP")
+    parser.add_argument("--host", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=4000, help="port to listen on")
+    parser.add_argument("-v", "--verbose", action="store_true", help="log UCI traffic")
+    parser.add_argument("engine", nargs="+", help="engine command line (put it after --)")
+    args = parser.parse_args()
+
+    with BridgeServer((args.host, args.port), BridgeHandler) as server:
+        server.engine_cmd = args.engine
+        server.verbose = args.verbose
+        print("Serving %s on %s:%d" % (" ".join(args.engine), args.host, args.port), flush=True)
+        try:
+            server.serve_forever()
+        except KeyboardInterrupt:
+            pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
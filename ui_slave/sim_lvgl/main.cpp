@@ -5,6 +5,7 @@
  * All chess UI logic is in the shared chess_ui module.
  */
 #include "chess_ui.h"
+#include "nn_eval.h"
 #include <SDL2/SDL.h>
 #include <atomic>
 #include <chrono>
@@ -195,6 +196,12 @@ int main(int argc, char** argv) {
   // ---- Create shared chess UI ----
   chess_ui_create(screen_w, screen_h, &lv_font_montserrat_14, platformSend);
 
+  // ---- Evaluator kernels: both kernel sets must agree bit-for-bit ----
+  double evals_per_sec = 0;
+  bool kernels_match = nn_eval_self_test(20000, &evals_per_sec);
+  std::cout << "NN eval self-test: " << (kernels_match ? "OK" : "MISMATCH") << ", "
+            << (long)evals_per_sec << " evals/s\n";
+
   // ---- TCP server ----
   std::thread tcp_thread(tcp_server_thread);
 
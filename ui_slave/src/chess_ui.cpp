@@ -5,6 +5,7 @@
  * Works on both ESP32 (Arduino) and desktop (SDL simulator).
  */
 #include "chess_ui.h"
+#include "nn_eval.h"
 #include "pieces/pieces.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -72,6 +73,9 @@ static lv_color_t s_light_sq;
 static lv_color_t s_dark_sq;
 static int s_hl_from_r = -1, s_hl_from_c = -1;
 static int s_hl_to_r = -1, s_hl_to_c = -1;
+// Legal destinations per origin square from the master (MOVES message)
+static uint64_t s_legal_masks[64];
+static uint64_t s_dest_marked = 0; // squares currently showing legal destinations
 
 // Screen dimensions (cached for welcome screen layout)
 static int s_screen_w = 480;
@@ -88,10 +92,11 @@ static const char* MODE_NAMES[] = {
     "Human vs Human",     // 1
     "Human vs Stockfish", // 2
     "Online (Lichess)",   // 3
-    "Sensor Test"         // 4
+    "Sensor Test",        // 4
+    "Spectate (Lichess)"  // 5
 };
 
-// Current game mode (0=select, 1=HvH, 2=Stockfish, 3=Lichess, 4=SensorTest)
+// Current game mode (0=select, 1=HvH, 2=Stockfish, 3=Lichess, 4=SensorTest, 5=Spectate)
 static int s_current_mode = 0;
 
 // Clock configuration
@@ -99,6 +104,15 @@ static int s_clock_initial_sec = 10 * 60; // default 10 minutes per side
 static int s_clock_increment_sec = 0;     // Fischer increment per move
 static bool s_clock_started = false;      // set true on first move
 static bool s_no_clock = false;           // unlimited / no clock mode
+static int s_clock_elapsed_ms = 0;        // time counted towards the next local second
+static uint32_t s_clock_last_tick = 0;    // lv_tick_get() at the last clock timer run
+
+// Clock driven by TIME messages from the master (Lichess): remaining times as of
+// s_clock_sync_tick, interpolated locally until the next message
+static bool s_clock_synced = false;
+static int32_t s_white_time_ms = 0;
+static int32_t s_black_time_ms = 0;
+static uint32_t s_clock_sync_tick = 0;
 
 // Confirmation dialog
 static lv_obj_t* s_confirm_overlay = nullptr;
@@ -149,6 +163,12 @@ static void loadSettings() {
   fclose(f);
 }
 
+// Optional on-device evaluation (enabled when a weights file is present)
+static const char* NN_WEIGHTS_FILE = "nn_eval.bin";
+static NnAccumulator s_nn_acc = {};
+static bool s_nn_eval_valid = false;
+static int s_nn_eval_cp = 0;
+
 // HvH-specific widgets
 static lv_obj_t* s_white_area = nullptr; // bottom area (white buttons + moves)
 static lv_obj_t* s_black_area = nullptr; // top area (black buttons + moves, rotated)
@@ -295,7 +315,27 @@ static void updateClockDisplay() {
 
 static void clockTimerCb(lv_timer_t* t) {
   (void)t;
-  if (!s_clock_running || s_no_clock) return;
+  uint32_t elapsed = lv_tick_elaps(s_clock_last_tick);
+  s_clock_last_tick += elapsed;
+  if (!s_clock_running || s_no_clock) {
+    s_clock_elapsed_ms = 0;
+    return;
+  }
+  if (s_clock_synced) {
+    // Redraw only when the shown second changes; the timer runs often enough to
+    // flip it within a tenth of a second of the master's clock
+    int32_t remaining = (s_white_active ? s_white_time_ms : s_black_time_ms) - (int32_t)lv_tick_elaps(s_clock_sync_tick);
+    int sec = remaining > 0 ? remaining / 1000 : 0;
+    int* shown = s_white_active ? &s_white_time_sec : &s_black_time_sec;
+    if (*shown != sec) {
+      *shown = sec;
+      updateClockDisplay();
+    }
+    return;
+  }
+  s_clock_elapsed_ms += elapsed;
+  if (s_clock_elapsed_ms < 1000) return;
+  s_clock_elapsed_ms -= 1000;
   if (s_white_active) {
     if (s_white_time_sec > 0) s_white_time_sec--;
   } else {
@@ -477,6 +517,30 @@ static void highlightSquare(int r, int c) {
                             dark ? s_highlight_dark : s_highlight_light, 0);
 }
 
+// Remove legal-destination marks, keeping the last-move highlight intact
+static void clearDestinations() {
+  for (uint64_t m = s_dest_marked; m; m &= m - 1) {
+    int sq = __builtin_ctzll(m);
+    int r = sq / 8, c = sq % 8;
+    bool last_move = (r == s_hl_from_r && c == s_hl_from_c) || (r == s_hl_to_r && c == s_hl_to_c);
+    if (last_move)
+      highlightSquare(r, c);
+    else
+      lv_obj_set_style_bg_color(s_btns[r][c], squareColor(r, c), 0);
+  }
+  s_dest_marked = 0;
+}
+
+static void showDestinations(int r, int c) {
+  clearDestinations();
+  uint64_t mask = s_legal_masks[r * 8 + c];
+  for (uint64_t m = mask; m; m &= m - 1) {
+    int sq = __builtin_ctzll(m);
+    lv_obj_set_style_bg_color(s_btns[sq / 8][sq % 8], lv_color_hex(0x5B9BD5), 0);
+  }
+  s_dest_marked = mask;
+}
+
 void chess_ui_set_move(int fr, int fc, int tr, int tc, const char* text) {
   chess_ui_reset_highlight();
   s_hl_from_r = fr;
@@ -598,6 +662,12 @@ void chess_ui_handle_message(const char* line) {
         strncpy(fen_buf, fen_start, fen_len);
         fen_buf[fen_len] = '\0';
         chess_ui_render_fen(fen_buf);
+        // Incremental accumulator update: only the squares that changed
+        s_nn_eval_valid = nn_eval_set_position(&s_nn_acc, fen_buf);
+        if (s_nn_eval_valid) {
+          const char* stm = strchr(fen_buf, ' ');
+          s_nn_eval_cp = nn_eval_evaluate(&s_nn_acc, !stm || stm[1] != 'b');
+        }
       }
     }
     // Look for move=...
@@ -613,7 +683,12 @@ void chess_ui_handle_message(const char* line) {
         move_buf[move_len] = '\0';
         int fr, fc, tr, tc;
         if (parseUci(move_buf, &fr, &fc, &tr, &tc)) {
-          chess_ui_set_move(fr, fc, tr, tc, move_buf);
+          char move_text[32];
+          if (s_nn_eval_valid)
+            snprintf(move_text, sizeof(move_text), "%s  %+.2f", move_buf, s_nn_eval_cp / 100.0);
+          else
+            snprintf(move_text, sizeof(move_text), "%s", move_buf);
+          chess_ui_set_move(fr, fc, tr, tc, move_text);
           // Track move in history (HvH)
           if (s_move_count < MAX_MOVE_HISTORY) {
             strncpy(s_move_list[s_move_count], move_buf, 7);
@@ -625,7 +700,8 @@ void chess_ui_handle_message(const char* line) {
           if (s_swap_btn && s_move_count == 1 && s_current_mode == 1)
             lv_obj_add_flag(s_swap_btn, LV_OBJ_FLAG_HIDDEN);
           // Clock: start on first move, add increment, switch sides
-          if (!s_no_clock) {
+          // (a clock synced from the master switches with its TIME messages)
+          if (!s_no_clock && !s_clock_synced) {
             if (!s_clock_started) {
               s_clock_started = true;
               s_clock_running = true;
@@ -642,6 +718,20 @@ void chess_ui_handle_message(const char* line) {
         }
       }
     }
+  } else if (type_len == 5 && strncmp(line, "MOVES", 5) == 0) {
+    // MOVES|e2=<hex mask>;g1=<hex mask>... — legal destinations per origin
+    clearDestinations();
+    memset(s_legal_masks, 0, sizeof(s_legal_masks));
+    const char* p = payload;
+    while (*p) {
+      if (p[0] >= 'a' && p[0] <= 'h' && p[1] >= '1' && p[1] <= '8' && p[2] == '=') {
+        int sq = (8 - (p[1] - '0')) * 8 + (p[0] - 'a');
+        s_legal_masks[sq] = strtoull(p + 3, nullptr, 16);
+      }
+      const char* next = strchr(p, ';');
+      if (!next) break;
+      p = next + 1;
+    }
   } else if (type_len == 4 && strncmp(line, "HINT", 4) == 0) {
     const char* move_key = strstr(payload, "move=");
     if (move_key) {
@@ -661,6 +751,25 @@ void chess_ui_handle_message(const char* line) {
         }
       }
     }
+  } else if (type_len == 4 && strncmp(line, "TIME", 4) == 0) {
+    // TIME|w=<ms>;b=<ms>;active=w|b;run=0|1 — clock state from the master
+    const char* w_key = strstr(payload, "w=");
+    const char* b_key = strstr(payload, "b=");
+    const char* active_key = strstr(payload, "active=");
+    const char* run_key = strstr(payload, "run=");
+    if (w_key && b_key && active_key && run_key) {
+      s_white_time_ms = (int32_t)strtol(w_key + 2, nullptr, 10);
+      s_black_time_ms = (int32_t)strtol(b_key + 2, nullptr, 10);
+      s_clock_sync_tick = lv_tick_get();
+      s_white_time_sec = s_white_time_ms / 1000;
+      s_black_time_sec = s_black_time_ms / 1000;
+      s_white_active = active_key[7] != 'b';
+      s_clock_running = run_key[4] == '1';
+      s_clock_started = true;
+      s_clock_synced = true;
+      s_no_clock = false;
+      updateClockDisplay();
+    }
   } else if (type_len == 5 && strncmp(line, "ERROR", 5) == 0) {
     lv_label_set_text(s_status_label, "Error");
   } else if (type_len == 4 && strncmp(line, "MODE", 4) == 0) {
@@ -672,7 +781,7 @@ void chess_ui_handle_message(const char* line) {
       if (mode == 0) {
         // Back to selection screen
         chess_ui_show_welcome();
-      } else if (mode >= 1 && mode <= 4) {
+      } else if (mode >= 1 && mode <= 5) {
         chess_ui_show_game(MODE_NAMES[mode]);
       }
     }
@@ -691,6 +800,7 @@ static void cell_event_cb(lv_event_t* e) {
   intptr_t id = (intptr_t)lv_event_get_user_data(e);
   int r = (id >> 8) & 0xFF;
   int c = id & 0xFF;
+  showDestinations(r, c);
   char buf[64];
   snprintf(buf, sizeof(buf), "TOUCH|action=board;row=%d;col=%d\n", r, c);
   if (s_send_fn) s_send_fn(buf);
@@ -828,7 +938,7 @@ static void btn_clock_cb(lv_event_t* e) {
 // Play/pause button between the two clock panels
 static void clock_play_pause_cb(lv_event_t* e) {
   (void)e;
-  if (s_no_clock) return;
+  if (s_no_clock || s_clock_synced) return;
   if (!s_clock_started) {
     // First press — start white's clock
     s_clock_started = true;
@@ -845,7 +955,7 @@ static void clock_play_pause_cb(lv_event_t* e) {
 // White panel (bottom): white just moved → switch to black
 static void clock_white_tap_cb(lv_event_t* e) {
   (void)e;
-  if (s_no_clock) return;
+  if (s_no_clock || s_clock_synced) return;
   if (!s_white_active) return; // only respond when it's your turn
   if (!s_clock_started) {
     s_clock_started = true;
@@ -860,7 +970,7 @@ static void clock_white_tap_cb(lv_event_t* e) {
 // Black panel (top): black just moved → switch to white
 static void clock_black_tap_cb(lv_event_t* e) {
   (void)e;
-  if (s_no_clock) return;
+  if (s_no_clock || s_clock_synced) return;
   if (s_white_active) return; // only respond when it's your turn
   if (!s_clock_started) {
     s_clock_started = true;
@@ -905,6 +1015,7 @@ static void applyClockPreset(int time_sec, int increment_sec) {
   s_white_active = true;
   s_clock_running = false;
   s_clock_started = false;
+  s_clock_synced = false;
   updateClockDisplay();
   // Switch back to the originating screen
   if (s_clock_screen) lv_obj_add_flag(s_clock_screen, LV_OBJ_FLAG_HIDDEN);
@@ -1041,6 +1152,7 @@ void chess_ui_show_game(const char* mode_name) {
   s_white_active = true;
   s_clock_running = false;
   s_clock_started = false;
+  s_clock_synced = false;
   updateClockDisplay();
 
 #ifdef SIMULATOR
@@ -1099,7 +1211,7 @@ static void mode_btn_cb(lv_event_t* e) {
   snprintf(buf, sizeof(buf), "TOUCH|action=mode;value=%d\n", (int)mode);
   if (s_send_fn) s_send_fn(buf);
   // Switch to game screen right away
-  const char* name = (mode >= 1 && mode <= 4) ? MODE_NAMES[mode] : "Game";
+  const char* name = (mode >= 1 && mode <= 5) ? MODE_NAMES[mode] : "Game";
   chess_ui_show_game(name);
 }
 
@@ -1622,6 +1734,7 @@ void chess_ui_create(int screen_w, int screen_h,
   s_screen_w = screen_w;
   s_screen_h = screen_h;
   loadSettings();
+  nn_eval_load(NN_WEIGHTS_FILE);
 
   // Square colors
   s_light_sq = lv_color_hex(0xF0D9B5);
@@ -2087,7 +2200,8 @@ void chess_ui_create(int screen_w, int screen_h,
   }
 
   updateClockDisplay();
-  lv_timer_create(clockTimerCb, 1000, nullptr);
+  s_clock_last_tick = lv_tick_get();
+  lv_timer_create(clockTimerCb, 100, nullptr);
 
   // ---------- Settings cogwheel on game screen (bottom-left, very dim) ----------
   {
@@ -15,6 +15,7 @@
 
 #include "chess_ui.h"
 #include "lvgl_v8_port.h"
+#include "nn_eval.h"
 #include <Arduino.h>
 #include <ESP_Panel_Library.h>
 #include <lvgl.h>
@@ -55,6 +56,14 @@ void setup() {
   lvgl_port_unlock();
 
   Serial.println("UI ready");
+
+  Serial.printf("NN eval weights %s\n", nn_eval_ready() ? "loaded" : "not found");
+#ifdef NN_EVAL_SELF_TEST
+  // ---- Evaluator kernels: verify the PIE kernels against the scalar reference ----
+  double evalsPerSec = 0;
+  bool kernelsMatch = nn_eval_self_test(2000, &evalsPerSec);
+  Serial.printf("NN eval self-test: %s, %.0f evals/s\n", kernelsMatch ? "OK" : "MISMATCH", evalsPerSec);
+#endif
 }
 
 void loop() {
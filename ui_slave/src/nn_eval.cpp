@@ -0,0 +1,336 @@
+/*
+ * nn_eval.cpp — Quantized position evaluator (see nn_eval.h)
+ *
+ * No LVGL dependencies: builds for the ESP32-S3 (PIE kernels) and for the
+ * desktop simulator and host tests (portable kernels).
+ */
+#include "nn_eval.h"
+#ifdef ESP_PLATFORM
+#include <sdkconfig.h> // CONFIG_IDF_TARGET_*
+#endif
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#include <esp_heap_caps.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Network storage
+// ---------------------------------------------------------------------------
+
+struct alignas(16) NnWeights {
+  int16_t ft_bias[NN_HIDDEN];
+  int16_t ft_weights[NN_INPUTS][NN_HIDDEN];
+  int8_t out_weights[2 * NN_HIDDEN];
+  int32_t out_bias;
+  int32_t output_divisor;
+};
+
+static NnWeights* s_weights = nullptr; // ~98 KB, lands in PSRAM on the S3
+
+// ---------------------------------------------------------------------------
+// Kernels
+// ---------------------------------------------------------------------------
+
+struct NnKernels {
+  void (*add)(int16_t* acc, const int16_t* row);
+  void (*sub)(int16_t* acc, const int16_t* row);
+  int32_t (*output)(const int16_t* us, const int16_t* them, const int8_t* weights);
+};
+
+static inline int32_t clippedRelu(int16_t v) {
+  return v < 0 ? 0 : (v > 127 ? 127 : v);
+}
+
+// Scalar reference kernels
+static void addScalar(int16_t* acc, const int16_t* row) {
+  for (int i = 0; i < NN_HIDDEN; i++)
+    acc[i] = (int16_t)(acc[i] + row[i]);
+}
+
+static void subScalar(int16_t* acc, const int16_t* row) {
+  for (int i = 0; i < NN_HIDDEN; i++)
+    acc[i] = (int16_t)(acc[i] - row[i]);
+}
+
+static int32_t outputScalar(const int16_t* us, const int16_t* them, const int8_t* weights) {
+  int32_t sum = 0;
+  for (int i = 0; i < NN_HIDDEN; i++)
+    sum += clippedRelu(us[i]) * weights[i];
+  for (int i = 0; i < NN_HIDDEN; i++)
+    sum += clippedRelu(them[i]) * weights[NN_HIDDEN + i];
+  return sum;
+}
+
+static const NnKernels SCALAR_KERNELS = {addScalar, subScalar, outputScalar};
+
+// Output layer unrolled by four, shared by the fast kernel sets
+static int32_t outputUnrolled(const int16_t* us, const int16_t* them, const int8_t* weights) {
+  int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  for (int i = 0; i < NN_HIDDEN; i += 4) {
+    s0 += clippedRelu(us[i]) * weights[i];
+    s1 += clippedRelu(us[i + 1]) * weights[i + 1];
+    s2 += clippedRelu(us[i + 2]) * weights[i + 2];
+    s3 += clippedRelu(us[i + 3]) * weights[i + 3];
+  }
+  const int8_t* w = weights + NN_HIDDEN;
+  for (int i = 0; i < NN_HIDDEN; i += 4) {
+    s0 += clippedRelu(them[i]) * w[i];
+    s1 += clippedRelu(them[i + 1]) * w[i + 1];
+    s2 += clippedRelu(them[i + 2]) * w[i + 2];
+    s3 += clippedRelu(them[i + 3]) * w[i + 3];
+  }
+  return s0 + s1 + s2 + s3;
+}
+
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+// S3 kernels: the PIE vector unit adds or subtracts eight int16 lanes per
+// instruction (128-bit q registers, so rows and accumulators are 16-byte
+// aligned).  EE.VADDS/EE.VSUBS saturate where the scalar casts wrap; the two
+// agree as long as no accumulator leaves the int16 range, which a usable
+// network never gets near.
+static void addFast(int16_t* acc, const int16_t* row) {
+  int16_t* a = acc;
+  const int16_t* b = row;
+  for (int i = 0; i < NN_HIDDEN; i += 8)
+    asm volatile(
+        "ee.vld.128.ip q0, %0, 0\n"
+        "ee.vld.128.ip q1, %1, 16\n"
+        "ee.vadds.s16 q0, q0, q1\n"
+        "ee.vst.128.ip q0, %0, 16\n"
+        : "+r"(a), "+r"(b)
+        :
+        : "memory");
+}
+
+static void subFast(int16_t* acc, const int16_t* row) {
+  int16_t* a = acc;
+  const int16_t* b = row;
+  for (int i = 0; i < NN_HIDDEN; i += 8)
+    asm volatile(
+        "ee.vld.128.ip q0, %0, 0\n"
+        "ee.vld.128.ip q1, %1, 16\n"
+        "ee.vsubs.s16 q0, q0, q1\n"
+        "ee.vst.128.ip q0, %0, 16\n"
+        : "+r"(a), "+r"(b)
+        :
+        : "memory");
+}
+#else
+// Portable stand-in for the S3 kernels so the comparison also runs on the
+// host: two int16 lanes per 32-bit word with wrapping lane arithmetic
+// (identical to the scalar casts).  memcpy keeps it free of type punning.
+static void addFast(int16_t* acc, const int16_t* row) {
+  for (int i = 0; i < NN_HIDDEN; i += 2) {
+    uint32_t x, y;
+    memcpy(&x, acc + i, sizeof(x));
+    memcpy(&y, row + i, sizeof(y));
+    x = ((x & 0x7FFF7FFFu) + (y & 0x7FFF7FFFu)) ^ ((x ^ y) & 0x80008000u);
+    memcpy(acc + i, &x, sizeof(x));
+  }
+}
+
+static void subFast(int16_t* acc, const int16_t* row) {
+  for (int i = 0; i < NN_HIDDEN; i += 2) {
+    uint32_t x, y;
+    memcpy(&x, acc + i, sizeof(x));
+    memcpy(&y, row + i, sizeof(y));
+    x = ((x | 0x80008000u) - (y & 0x7FFF7FFFu)) ^ ((x ^ ~y) & 0x80008000u);
+    memcpy(acc + i, &x, sizeof(x));
+  }
+}
+#endif
+
+static const NnKernels FAST_KERNELS = {addFast, subFast, outputUnrolled};
+
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+static const NnKernels* s_kernels = &FAST_KERNELS;
+#else
+static const NnKernels* s_kernels = &SCALAR_KERNELS;
+#endif
+
+// Weights are read by the vector loads, so keep them 16-byte aligned
+static NnWeights* allocWeights() {
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+  return (NnWeights*)heap_caps_aligned_alloc(16, sizeof(NnWeights), MALLOC_CAP_DEFAULT);
+#else
+  return (NnWeights*)malloc(sizeof(NnWeights));
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Features
+// ---------------------------------------------------------------------------
+
+static int pieceIndex(char piece) {
+  const char* pieces = "PNBRQKpnbrqk";
+  const char* p = strchr(pieces, piece);
+  return (piece != '\0' && p) ? (int)(p - pieces) : -1;
+}
+
+// Feature index for each perspective: black sees the board mirrored with colors swapped
+static inline int featureIndex(int piece, int sq, int perspective) {
+  if (perspective == 0)
+    return piece * 64 + sq;
+  int swapped = piece < 6 ? piece + 6 : piece - 6;
+  return swapped * 64 + (sq ^ 56);
+}
+
+static void applyFeature(const NnKernels* k, const NnWeights* w, NnAccumulator* acc, char piece, int sq, bool add) {
+  int idx = pieceIndex(piece);
+  if (idx < 0) return;
+  for (int p = 0; p < 2; p++) {
+    const int16_t* row = w->ft_weights[featureIndex(idx, sq, p)];
+    if (add)
+      k->add(acc->values[p], row);
+    else
+      k->sub(acc->values[p], row);
+  }
+}
+
+static void refresh(const NnKernels* k, const NnWeights* w, NnAccumulator* acc, const char* board) {
+  for (int p = 0; p < 2; p++)
+    memcpy(acc->values[p], w->ft_bias, sizeof(w->ft_bias));
+  for (int sq = 0; sq < 64; sq++)
+    applyFeature(k, w, acc, board[sq], sq, true);
+  memcpy(acc->board, board, 64);
+  acc->valid = true;
+}
+
+static void update(const NnKernels* k, const NnWeights* w, NnAccumulator* acc, const char* board) {
+  if (!acc->valid) {
+    refresh(k, w, acc, board);
+    return;
+  }
+  for (int sq = 0; sq < 64; sq++) {
+    if (acc->board[sq] == board[sq]) continue;
+    applyFeature(k, w, acc, acc->board[sq], sq, false);
+    applyFeature(k, w, acc, board[sq], sq, true);
+    acc->board[sq] = board[sq];
+  }
+}
+
+static int evaluate(const NnKernels* k, const NnWeights* w, const NnAccumulator* acc, bool white_to_move) {
+  int stm = white_to_move ? 0 : 1;
+  int32_t raw = k->output(acc->values[stm], acc->values[stm ^ 1], w->out_weights) + w->out_bias;
+  int cp = raw / (w->output_divisor > 0 ? w->output_divisor : 1);
+  return white_to_move ? cp : -cp;
+}
+
+// Board part of a FEN into 64 squares (index = row * 8 + col, row 0 = rank 8)
+static bool fenToSquares(const char* fen, char* board) {
+  memset(board, ' ', 64);
+  int r = 0, c = 0;
+  for (const char* p = fen; *p && *p != ' '; p++) {
+    if (*p == '/') {
+      r++;
+      c = 0;
+    } else if (*p >= '1' && *p <= '8') {
+      c += *p - '0';
+    } else {
+      if (r > 7 || c > 7 || pieceIndex(*p) < 0) return false;
+      board[r * 8 + c] = *p;
+      c++;
+    }
+  }
+  return r == 7;
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool nn_eval_load(const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  NnFileHeader hdr;
+  bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == NN_FILE_MAGIC &&
+            hdr.version == NN_FILE_VERSION && hdr.hidden == NN_HIDDEN && hdr.output_divisor > 0;
+  NnWeights* w = ok ? allocWeights() : nullptr;
+  if (w) {
+    ok = fread(w->ft_bias, sizeof(w->ft_bias), 1, f) == 1 &&
+         fread(w->ft_weights, sizeof(w->ft_weights), 1, f) == 1 &&
+         fread(w->out_weights, sizeof(w->out_weights), 1, f) == 1 &&
+         fread(&w->out_bias, sizeof(w->out_bias), 1, f) == 1;
+    w->output_divisor = hdr.output_divisor;
+  }
+  fclose(f);
+  if (!ok || !w) {
+    free(w);
+    return false;
+  }
+  free(s_weights);
+  s_weights = w;
+  return true;
+}
+
+bool nn_eval_ready() {
+  return s_weights != nullptr;
+}
+
+bool nn_eval_set_position(NnAccumulator* acc, const char* fen) {
+  if (!s_weights || !fen) return false;
+  char board[64];
+  if (!fenToSquares(fen, board)) return false;
+  update(s_kernels, s_weights, acc, board);
+  return true;
+}
+
+int nn_eval_evaluate(const NnAccumulator* acc, bool white_to_move) {
+  if (!s_weights || !acc->valid) return 0;
+  return evaluate(s_kernels, s_weights, acc, white_to_move);
+}
+
+bool nn_eval_self_test(int positions, double* evals_per_sec) {
+  NnWeights* w = allocWeights();
+  if (!w) return false;
+
+  // Deterministic synthetic weights (xorshift32), large enough to hit the ReLU clip
+  uint32_t seed = 0x2545F491u;
+  auto next = [&seed]() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+  };
+  for (int i = 0; i < NN_HIDDEN; i++)
+    w->ft_bias[i] = (int16_t)((int)(next() % 129) - 32);
+  for (int f = 0; f < NN_INPUTS; f++)
+    for (int i = 0; i < NN_HIDDEN; i++)
+      w->ft_weights[f][i] = (int16_t)((int)(next() % 97) - 48);
+  for (int i = 0; i < 2 * NN_HIDDEN; i++)
+    w->out_weights[i] = (int8_t)((int)(next() % 255) - 127);
+  w->out_bias = 0;
+  w->output_divisor = 64;
+
+  // Random positions: both kernel sets follow the same sequence of incremental updates
+  static const char* PIECES = "PNBRQKpnbrqk";
+  NnAccumulator ref = {}, fast = {};
+  char board[64];
+  bool match = true;
+  for (int n = 0; n < positions && match; n++) {
+    memset(board, ' ', 64);
+    for (int i = 0, count = 2 + (int)(next() % 30); i < count; i++)
+      board[next() % 64] = PIECES[next() % 12];
+    update(&SCALAR_KERNELS, w, &ref, board);
+    update(&FAST_KERNELS, w, &fast, board);
+    match = memcmp(ref.values, fast.values, sizeof(ref.values)) == 0 &&
+            evaluate(&SCALAR_KERNELS, w, &ref, n & 1) == evaluate(&FAST_KERNELS, w, &fast, n & 1);
+  }
+
+  // Throughput of the active kernel set on full refreshes (worst case)
+  int32_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < positions; n++) {
+    board[n % 64] = PIECES[n % 12];
+    refresh(s_kernels, w, &fast, board);
+    sink += evaluate(s_kernels, w, &fast, true);
+  }
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (evals_per_sec) *evals_per_sec = (secs > 0 && sink != INT32_MIN) ? positions / secs : 0;
+
+  free(w);
+  return match;
+}
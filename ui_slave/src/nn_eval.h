@@ -0,0 +1,62 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * Quantized NNUE-style position evaluator for the UI slave.
+ *
+ * Network: 768 piece-square inputs -> NN_HIDDEN int16 accumulators per
+ * perspective -> clipped ReLU [0, 127] -> int8 output layer -> centipawns.
+ * The accumulators are updated incrementally from board diffs, so a normal
+ * move costs 2-4 weight-row additions instead of a full refresh.
+ *
+ * Two kernel sets exist: a scalar reference and a fast set.  On the
+ * ESP32-S3 the fast set updates the accumulators with the PIE vector unit
+ * (eight int16 lanes per instruction); elsewhere it is a portable packed
+ * stand-in.  Both must produce identical results (see nn_eval_self_test).
+ *
+ * tools/nn_eval_weights.py converts a trained network to the weights file
+ * or writes a hand-made material network.
+ */
+
+#define NN_INPUTS 768
+#define NN_HIDDEN 64
+
+/// Weights file: header followed by ft_bias[NN_HIDDEN] (int16),
+/// ft_weights[NN_INPUTS][NN_HIDDEN] (int16), out_weights[2 * NN_HIDDEN]
+/// (int8) and out_bias (int32), all little-endian.
+#define NN_FILE_MAGIC 0x4E4E434Fu // "OCNN"
+#define NN_FILE_VERSION 1
+
+struct NnFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t hidden;         // must equal NN_HIDDEN
+  int32_t output_divisor;  // raw output / divisor = centipawns
+};
+
+struct NnAccumulator {
+  alignas(16) int16_t values[2][NN_HIDDEN]; // [perspective: 0 = white, 1 = black], 16-byte aligned for PIE
+  char board[64];               // position the accumulator reflects (' ' = empty)
+  bool valid;
+};
+
+/// Load network weights from a file.  Returns false (and keeps the
+/// evaluator disabled) if the file is missing or malformed.
+bool nn_eval_load(const char* path);
+
+/// True once weights are loaded.
+bool nn_eval_ready();
+
+/// Update the accumulator to the board part of a FEN.  Applies only the
+/// squares that changed since the last call; does a full refresh the first
+/// time.  Returns false if the FEN board part is malformed.
+bool nn_eval_set_position(NnAccumulator* acc, const char* fen);
+
+/// Evaluate the accumulator's position in centipawns from White's view.
+int nn_eval_evaluate(const NnAccumulator* acc, bool white_to_move);
+
+/// Check the fast kernels against the scalar reference on synthetic
+/// weights (allocates a second ~98 KB network) and measure throughput.
+/// Returns true if both kernel sets agree on every position; writes
+/// full-refresh evaluations per second to *evals_per_sec.
+bool nn_eval_self_test(int positions, double* evals_per_sec);